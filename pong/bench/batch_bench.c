@@ -0,0 +1,231 @@
+/* ------------------------------------------------------------------
+ * batch_bench.c - Durchsatz: skalare Physik vs. Batch-Simulator
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ *
+ * Simuliert dieselben Spiele (KI gegen KI, Verfolger-KI) einmal mit
+ * den skalaren Funktionen in einer Schleife und einmal mit batch_step;
+ * gemessen wird ns pro laufendem Spiel-Tick. Beide Seiten starten
+ * aus denselben Lanes und ziehen den Aufschlag aus derselben
+ * xorshift32-Folge je Spiel – gleiche Arbeit, gleiche Tick-Zahl (wird
+ * vor der Messung einmal über SIM_TICKS Ticks geprüft). Nach SIM_TICKS
+ * Ticks oder wenn alle Spiele vorbei sind, beginnt die Runde neu.
+ *
+ * Aufruf: batch_bench [--json DATEI|-] [--label TEXT] [--trials N] ...
+ * (siehe bench_parse_args)
+ * ------------------------------------------------------------------ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "harness.h"
+#include "ai.h"
+#include "batch.h"
+#include "config.h"
+#include "physics.h"
+
+#define SIM_GAMES 4096
+#define SIM_TICKS 1000
+#define FIELD_W   80
+#define FIELD_H   24
+
+/* Zufall der skalaren Seite: Folge des gerade simulierten Spiels */
+static uint32_t *lane_rng;
+static int       lane_cur;
+
+/* ------------------------------------------------------------------
+ * lane_rand
+ * Zufallsquelle für physics_set_random_provider: ein xorshift32-
+ * Schritt der Lane lane_cur wie in batch.c; geliefert wird das Bit,
+ * das dort die Aufschlagrichtung wählt, als niedrigstes Bit.
+ *
+ * Parameter:
+ *   keine
+ *
+ * Rückgabe:
+ *   0 oder 1
+ * ------------------------------------------------------------------ */
+static unsigned int lane_rand(void)
+{
+    uint32_t r = lane_rng[lane_cur];
+    r ^= r << 13;
+    r ^= r >> 17;
+    r ^= r << 5;
+    lane_rng[lane_cur] = r;
+    return r >> 31;
+}
+
+/* ------------------------------------------------------------------
+ * player_chase
+ * Spieler-KI wie im Batch (player_dir == NULL): folgt dem Ball.
+ *
+ * Parameter:
+ *   g – Spielzustand
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void player_chase(game_state_t *g)
+{
+    float mid = g->player.x + g->player.width / 2.0f;
+    float dir = 0.0f;
+    if (fabsf(g->ball.x - mid) > 0.5f)
+        dir = (g->ball.x > mid) ? +1.0f : -1.0f;
+    update_paddle(&g->player, dir, physics_rate()->player_accel,
+                  physics_rate()->player_max_speed, g->field_width);
+}
+
+/* ---------------------------------------------------------------
+ * Skalare Seite: Array of Structs, ein Spiel pro Aufruf
+ * --------------------------------------------------------------- */
+typedef struct
+{
+    batch_t      *start;        /* Startzustand und Zufall je Lane   */
+    game_state_t *games;
+    bool         *alive;
+    int           t, running;
+    uint64_t      credit;       /* schon gelaufene, noch nicht verbuchte Ticks */
+} scalar_t;
+
+static void scalar_reset(scalar_t *sc)
+{
+    for (int i = 0; i < SIM_GAMES; ++i) {
+        sc->games[i] = physics_create_game(FIELD_W, FIELD_H);
+        batch_store(sc->start, i, &sc->games[i]);
+        lane_rng[i]  = sc->start->rng[i];
+        sc->alive[i] = true;
+    }
+    sc->t       = 0;
+    sc->running = SIM_GAMES;
+}
+
+/* Ein Tick aller laufenden Spiele; liefert deren Anzahl */
+static unsigned long scalar_tick(scalar_t *sc)
+{
+    unsigned long n = 0;
+    for (int i = 0; i < SIM_GAMES; ++i) {
+        if (!sc->alive[i])
+            continue;
+        lane_cur = i;
+        player_chase(&sc->games[i]);
+        ai_update(&sc->games[i]);
+        if (physics_update_ball_events(&sc->games[i]) & PHYS_EVENT_GAME_OVER) {
+            sc->alive[i] = false;
+            sc->running--;
+        }
+        n++;
+    }
+    if (++sc->t == SIM_TICKS || sc->running == 0)
+        scalar_reset(sc);
+    return n;
+}
+
+/* Eine Operation = ein Spiel-Tick; ganze Ticks laufen, der Überhang
+   wird beim nächsten Aufruf verrechnet */
+static void scalar_fn(void *ctx, uint64_t ops)
+{
+    scalar_t *sc = ctx;
+    while (sc->credit < ops)
+        sc->credit += scalar_tick(sc);
+    sc->credit -= ops;
+}
+
+/* ---------------------------------------------------------------
+ * Batch-Seite: Structure of Arrays, BATCH_LANES Spiele pro Befehl
+ * --------------------------------------------------------------- */
+typedef struct
+{
+    batch_t  *b;
+    int       t, running;
+    uint64_t  credit;
+} batch_sim_t;
+
+static bool batch_reset(batch_sim_t *bs)
+{
+    batch_destroy(bs->b);
+    bs->b       = batch_create(SIM_GAMES, FIELD_W, FIELD_H, 1u);
+    bs->t       = 0;
+    bs->running = SIM_GAMES;
+    return bs->b != NULL;
+}
+
+static unsigned long batch_tick(batch_sim_t *bs)
+{
+    unsigned long n = (unsigned long)bs->running;
+    bs->running = batch_step(bs->b, NULL);
+    /* tote Lanes abstoßen, sobald sie ein Achtel ausmachen */
+    if (bs->running < bs->b->active - bs->b->active / 8)
+        batch_compact(bs->b);
+    if (++bs->t == SIM_TICKS || bs->running == 0)
+        batch_reset(bs);
+    return n;
+}
+
+static void batch_fn(void *ctx, uint64_t ops)
+{
+    batch_sim_t *bs = ctx;
+    while (bs->credit < ops)
+        bs->credit += batch_tick(bs);
+    bs->credit -= ops;
+}
+
+int main(int argc, char *argv[])
+{
+    bench_opts_t  opts;
+    bench_suite_t suite;
+    if (!bench_parse_args(argc, argv, &opts)) {
+        fprintf(stderr, "usage: %s [--json FILE|-] [--label TEXT] [--trials N] "
+                        "[--trial-ms T] [--warmup-ms W] [--cpu C] [--no-pin] "
+                        "[--filter TEXT]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    ai_config_t ai;
+    ai_config_defaults(&ai);
+    ai.mode = AI_MODE_CHASE;                /* die KI des Batch‑Kernels */
+    ai_configure(&ai);
+
+    scalar_t    sc = { 0 };
+    batch_sim_t bs = { 0 };
+    sc.start = batch_create(SIM_GAMES, FIELD_W, FIELD_H, 1u);
+    sc.games = malloc(sizeof *sc.games * SIM_GAMES);
+    sc.alive = malloc(sizeof *sc.alive * SIM_GAMES);
+    lane_rng = malloc(sizeof *lane_rng * SIM_GAMES);
+    if (!sc.start || !sc.games || !sc.alive || !lane_rng || !batch_reset(&bs))
+        return EXIT_FAILURE;
+    physics_set_random_provider(lane_rand);
+
+    /* Gleiche Spiele → gleiche Tick-Zahl; sonst ist der Vergleich wertlos */
+    unsigned long scalar_ticks = 0, batch_ticks = 0;
+    scalar_reset(&sc);
+    for (int t = 0; t < SIM_TICKS; ++t) {
+        scalar_ticks += scalar_tick(&sc);
+        batch_ticks  += batch_tick(&bs);
+    }
+    if (scalar_ticks != batch_ticks) {
+        fprintf(stderr, "batch_bench: Arbeit ungleich (%lu vs. %lu Ticks)\n",
+                scalar_ticks, batch_ticks);
+        return EXIT_FAILURE;
+    }
+
+    FILE *out = opts.json && strcmp(opts.json, "-") == 0 ? stderr : stdout;
+    fprintf(out, "lanes=%d games=%d ticks<=%d\n", batch_lanes(), SIM_GAMES, SIM_TICKS);
+    bench_begin(&suite, &opts);
+
+    bench_run(&suite, "game_tick_scalar", scalar_fn, &sc);
+    physics_set_random_provider(NULL);
+    bench_run(&suite, "game_tick_batch", batch_fn, &bs);
+
+    /* Verhältnis nur, wenn beide Messungen gelaufen sind (--filter) */
+    if (suite.count == 2)
+        fprintf(out, "speedup: %.1fx\n",
+                suite.results[0].median_ns / suite.results[1].median_ns);
+
+    batch_destroy(bs.b);
+    batch_destroy(sc.start);
+    free(sc.games);
+    free(sc.alive);
+    free(lane_rng);
+    return bench_end(&suite) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,93 @@
+/* ------------------------------------------------------------------
+ * fixed_bench.c - Durchsatz: float- vs. Festkomma-Physik
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ *
+ * Simuliert dieselben Spiele (KI gegen KI, gleicher Seed) einmal mit
+ * PHYS_NUMERIC_FLOAT und einmal mit PHYS_NUMERIC_FIXED; gemessen wird
+ * ns pro Spiel-Tick. Ein Spiel endet mit Game Over oder nach
+ * SIM_TICKS Ticks, danach beginnt das nächste (Stream = Spielnummer),
+ * beide Modi spielen also dieselbe Folge von Partien.
+ *
+ * Aufruf: fixed_bench [--json DATEI|-] [--label TEXT] [--trials N] ...
+ * (siehe bench_parse_args)
+ * ------------------------------------------------------------------ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "harness.h"
+#include "ai.h"
+#include "physics.h"
+
+#define FIELD_W   80
+#define FIELD_H   24
+#define SIM_TICKS 1000
+
+static volatile float sink;
+
+/* ---------------------------------------------------------------
+ * Laufende Partie und Nummer für den Seed der nächsten
+ * --------------------------------------------------------------- */
+typedef struct
+{
+    game_state_t g;
+    uint64_t     game;
+    int          tick;
+} sim_t;
+
+static void sim_init(sim_t *s)
+{
+    s->game = 0;
+    s->tick = 0;
+    s->g    = physics_create_game_seeded(FIELD_W, FIELD_H, 1u, 0u);
+}
+
+/* Ein Spiel-Tick pro Operation im aktuell eingestellten Zahlenformat */
+static void sim_fn(void *ctx, uint64_t ops)
+{
+    sim_t *s = ctx;
+    for (uint64_t i = 0; i < ops; ++i) {
+        ai_player_update(&s->g);
+        ai_update(&s->g);
+        physics_event_t ev = physics_update_ball_events(&s->g);
+        if ((ev & PHYS_EVENT_GAME_OVER) || ++s->tick == SIM_TICKS) {
+            s->g    = physics_create_game_seeded(FIELD_W, FIELD_H, 1u, ++s->game);
+            s->tick = 0;
+        }
+    }
+    sink = s->g.ball.x;
+}
+
+static sim_t sim;
+
+int main(int argc, char *argv[])
+{
+    bench_opts_t  opts;
+    bench_suite_t suite;
+    if (!bench_parse_args(argc, argv, &opts)) {
+        fprintf(stderr, "usage: %s [--json FILE|-] [--label TEXT] [--trials N] "
+                        "[--trial-ms T] [--warmup-ms W] [--cpu C] [--no-pin] "
+                        "[--filter TEXT]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    bench_begin(&suite, &opts);
+
+    physics_set_numeric(PHYS_NUMERIC_FLOAT);
+    sim_init(&sim);
+    bench_run(&suite, "game_tick_float", sim_fn, &sim);
+
+    physics_set_numeric(PHYS_NUMERIC_FIXED);
+    sim_init(&sim);
+    bench_run(&suite, "game_tick_fixed", sim_fn, &sim);
+    physics_set_numeric(PHYS_NUMERIC_FLOAT);
+
+    /* Verhältnis nur, wenn beide Messungen gelaufen sind (--filter) */
+    if (suite.count == 2) {
+        FILE *out = opts.json && strcmp(opts.json, "-") == 0 ? stderr : stdout;
+        fprintf(out, "fixed/float: %.2fx\n",
+                suite.results[0].median_ns / suite.results[1].median_ns);
+    }
+
+    return bench_end(&suite) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,363 @@
+/* ------------------------------------------------------------------
+ * harness.c - Benchmark-Rahmen: Aufwärmen, Messläufe, Median/p99, JSON
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ *
+ * Jede Operation ist zu kurz für eine eigene Zeitmessung. Gemessen
+ * werden daher Messläufe fester Länge (ops Aufrufe, kalibriert auf
+ * trial_ms); Median und p99 beziehen sich auf die ns/op dieser Läufe.
+ * Der Prozess wird an einen Kern gebunden, damit Migrationen und
+ * kalte Caches nicht in die Streuung eingehen.
+ * ------------------------------------------------------------------ */
+
+#define _GNU_SOURCE             /* sched_setaffinity, sched_getcpu */
+#include <math.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "harness.h"
+
+/* ------------------------------------------------------------------
+ * bench_now_ns
+ * Monotone Zeit in Nanosekunden.
+ *
+ * Parameter:
+ *   keine
+ *
+ * Rückgabe:
+ *   Nanosekunden
+ * ------------------------------------------------------------------ */
+double bench_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/* ------------------------------------------------------------------
+ * bench_parse_args
+ * Standardwerte setzen und Kommandozeile auswerten:
+ *   --trials N  --trial-ms T  --warmup-ms W  --cpu C  --no-pin
+ *   --json DATEI|-  --label TEXT  --filter TEXT
+ *
+ * Parameter:
+ *   argc, argv – Kommandozeile
+ *   opts       – Ausgabe
+ *
+ * Rückgabe:
+ *   false bei unbekannter Option oder fehlendem Wert
+ * ------------------------------------------------------------------ */
+bool bench_parse_args(int argc, char *argv[], bench_opts_t *opts)
+{
+    opts->trials    = 101;
+    opts->trial_ms  = 2.0;
+    opts->warmup_ms = 50.0;
+    opts->cpu       = -1;
+    opts->pin       = true;
+    opts->json      = NULL;
+    opts->label     = "";
+    opts->filter    = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *name = argv[i];
+        if (strcmp(name, "--no-pin") == 0) {
+            opts->pin = false;
+            continue;
+        }
+        if (i + 1 >= argc)
+            return false;
+        const char *val = argv[++i];
+
+        if (strcmp(name, "--trials") == 0)         opts->trials    = atoi(val);
+        else if (strcmp(name, "--trial-ms") == 0)  opts->trial_ms  = atof(val);
+        else if (strcmp(name, "--warmup-ms") == 0) opts->warmup_ms = atof(val);
+        else if (strcmp(name, "--cpu") == 0)       opts->cpu       = atoi(val);
+        else if (strcmp(name, "--json") == 0)      opts->json      = val;
+        else if (strcmp(name, "--label") == 0)     opts->label     = val;
+        else if (strcmp(name, "--filter") == 0)    opts->filter    = val;
+        else return false;
+    }
+    return opts->trials >= 1 && opts->trials <= BENCH_MAX_TRIALS &&
+           opts->trial_ms > 0.0 && opts->warmup_ms >= 0.0;
+}
+
+/* ------------------------------------------------------------------
+ * bench_pin_cpu
+ * Bindet den Prozess an einen Kern.
+ *
+ * Parameter:
+ *   cpu – Kernnummer
+ *
+ * Rückgabe:
+ *   false, wenn das nicht möglich war
+ * ------------------------------------------------------------------ */
+bool bench_pin_cpu(int cpu)
+{
+    cpu_set_t set;
+    if (cpu < 0 || cpu >= CPU_SETSIZE)
+        return false;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof set, &set) == 0;
+}
+
+/* ------------------------------------------------------------------
+ * bench_begin
+ * Bindet den Prozess an einen Kern und gibt den Tabellenkopf aus.
+ *
+ * Parameter:
+ *   suite – Ausgabe
+ *   opts  – Optionen
+ *
+ * Rückgabe:
+ *   false, wenn kein Speicher verfügbar ist
+ * ------------------------------------------------------------------ */
+bool bench_begin(bench_suite_t *suite, const bench_opts_t *opts)
+{
+    memset(suite, 0, sizeof *suite);
+    suite->opts = *opts;
+    suite->cpu  = -1;
+
+    if (opts->pin) {
+        int cpu = opts->cpu >= 0 ? opts->cpu : sched_getcpu();
+        if (bench_pin_cpu(cpu))
+            suite->cpu = cpu;
+    }
+
+    /* Tabelle nach stderr, wenn JSON auf stdout geht */
+    FILE *out = opts->json && strcmp(opts->json, "-") == 0 ? stderr : stdout;
+    fprintf(out, "%-28s %12s %10s %10s %14s\n",
+            "benchmark", "ops/trial", "median ns", "p99 ns", "ops/s");
+    return true;
+}
+
+/* ------------------------------------------------------------------
+ * bench_percentile
+ * Perzentil nach Nearest-Rank.
+ *
+ * Parameter:
+ *   samples – Messwerte (werden sortiert)
+ *   n       – Anzahl (≥ 1)
+ *   p       – Perzentil 0…100
+ *
+ * Rückgabe:
+ *   Messwert auf Rang ceil(p/100 · n)
+ * ------------------------------------------------------------------ */
+static int cmp_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+double bench_percentile(double *samples, int n, double p)
+{
+    qsort(samples, (size_t)n, sizeof *samples, cmp_double);
+    int rank = (int)(p / 100.0 * n + 0.999999);
+    if (rank < 1) rank = 1;
+    if (rank > n) rank = n;
+    return samples[rank - 1];
+}
+
+/* ------------------------------------------------------------------
+ * bench_mann_whitney
+ * Rangsummentest für zwei unabhängige Stichproben ohne Annahme über
+ * die Verteilung (Laufzeiten sind schief und haben Ausreißer nach
+ * oben). U zählt die Paare, in denen b größer ist als a, halbe Punkte
+ * für Gleichstand. Der p-Wert kommt aus der Normalapproximation mit
+ * Bindungs- und Stetigkeitskorrektur, ausreichend ab etwa 8 Werten
+ * je Seite.
+ *
+ * Parameter:
+ *   a, na – Referenz (z. B. Baseline)
+ *   b, nb – Vergleich (z. B. aktueller Stand)
+ *   u_out – Ausgabe: U von b (darf NULL sein)
+ *
+ * Rückgabe:
+ *   p-Wert für "b ist stochastisch größer als a"
+ * ------------------------------------------------------------------ */
+typedef struct
+{
+    double v;
+    int    from_b;
+} ranked_t;
+
+static int cmp_ranked(const void *x, const void *y)
+{
+    double a = ((const ranked_t *)x)->v, b = ((const ranked_t *)y)->v;
+    return (a > b) - (a < b);
+}
+
+double bench_mann_whitney(const double *a, int na, const double *b, int nb,
+                          double *u_out)
+{
+    int       n   = na + nb;
+    ranked_t *all = malloc((size_t)n * sizeof *all);
+    if (!all || na < 1 || nb < 1) {
+        free(all);
+        return 1.0;
+    }
+    for (int i = 0; i < na; ++i) all[i]      = (ranked_t){ a[i], 0 };
+    for (int i = 0; i < nb; ++i) all[na + i] = (ranked_t){ b[i], 1 };
+    qsort(all, (size_t)n, sizeof *all, cmp_ranked);
+
+    /* Ränge (mittlerer Rang bei Gleichstand) und Bindungsterm Σ(t³ - t) */
+    double rank_b = 0.0, ties = 0.0;
+    for (int i = 0; i < n;) {
+        int j = i;
+        while (j < n && all[j].v == all[i].v)
+            ++j;
+        double mid = (i + 1 + j) / 2.0;           /* Ränge i+1 … j */
+        for (int k = i; k < j; ++k)
+            if (all[k].from_b)
+                rank_b += mid;
+        double t = j - i;
+        ties += t * t * t - t;
+        i = j;
+    }
+    free(all);
+
+    double u     = rank_b - nb * (nb + 1) / 2.0;
+    double mean  = na * (double)nb / 2.0;
+    double var   = na * (double)nb / 12.0 * ((n + 1) - ties / ((double)n * (n - 1)));
+    if (u_out)
+        *u_out = u;
+    if (var <= 0.0)
+        return u > mean ? 0.0 : 1.0;
+    double z = (u - mean - 0.5) / sqrt(var);
+    return 0.5 * erfc(z / sqrt(2.0));
+}
+
+/* ------------------------------------------------------------------
+ * bench_run
+ * Misst eine Arbeit: Aufwärmen (mindestens warmup_ms), ops pro Lauf
+ * so verdoppeln, dass ein Lauf trial_ms dauert, dann `trials` Läufe.
+ *
+ * Parameter:
+ *   suite – Sammlung der Ergebnisse
+ *   name  – Kennung (JSON-Schlüssel)
+ *   fn    – Arbeit
+ *   ctx   – Zustand der Arbeit
+ *
+ * Rückgabe:
+ *   false, wenn kein Speicher verfügbar ist
+ * ------------------------------------------------------------------ */
+bool bench_run(bench_suite_t *suite, const char *name, bench_fn_t fn, void *ctx)
+{
+    const bench_opts_t *o = &suite->opts;
+    if (o->filter && !strstr(name, o->filter))
+        return true;
+
+    if (suite->count == suite->cap) {
+        int cap = suite->cap ? suite->cap * 2 : 16;
+        bench_result_t *grown = realloc(suite->results, (size_t)cap * sizeof *grown);
+        if (!grown)
+            return false;
+        suite->results = grown;
+        suite->cap     = cap;
+    }
+
+    /* Aufwärmen und Kalibrieren in einem: verdoppeln bis trial_ms */
+    uint64_t ops     = 1;
+    double   started = bench_now_ns();
+    for (;;) {
+        double t0 = bench_now_ns();
+        fn(ctx, ops);
+        double dt = bench_now_ns() - t0;
+        if (dt >= o->trial_ms * 1e6 && t0 - started >= o->warmup_ms * 1e6)
+            break;
+        if (dt < o->trial_ms * 1e6)
+            ops *= 2;
+    }
+
+    double samples[BENCH_MAX_TRIALS];
+    for (int i = 0; i < o->trials; ++i) {
+        double t0 = bench_now_ns();
+        fn(ctx, ops);
+        samples[i] = (bench_now_ns() - t0) / (double)ops;
+    }
+
+    bench_result_t *r = &suite->results[suite->count++];
+    memset(r, 0, sizeof *r);
+    strncpy(r->name, name, sizeof r->name - 1);
+    r->ops         = ops;
+    r->trials      = o->trials;
+    r->p99_ns      = bench_percentile(samples, o->trials, 99.0);
+    r->median_ns   = bench_percentile(samples, o->trials, 50.0);
+    r->min_ns      = samples[0];
+    r->max_ns      = samples[o->trials - 1];
+    r->ops_per_sec = r->median_ns > 0.0 ? 1e9 / r->median_ns : 0.0;
+
+    FILE *out = o->json && strcmp(o->json, "-") == 0 ? stderr : stdout;
+    fprintf(out, "%-28s %12llu %10.2f %10.2f %14.0f\n", r->name,
+            (unsigned long long)r->ops, r->median_ns, r->p99_ns, r->ops_per_sec);
+    return true;
+}
+
+/* Schreibt s als JSON-String (Anführungszeichen, Backslash, Steuerzeichen) */
+static void json_string(FILE *f, const char *s)
+{
+    fputc('"', f);
+    for (; *s; ++s) {
+        if (*s == '"' || *s == '\\')
+            fprintf(f, "\\%c", *s);
+        else if ((unsigned char)*s < 0x20)
+            fprintf(f, "\\u%04x", (unsigned char)*s);
+        else
+            fputc(*s, f);
+    }
+    fputc('"', f);
+}
+
+/* ------------------------------------------------------------------
+ * bench_end
+ * Schreibt die Ergebnisse als JSON (falls gewünscht) und gibt den
+ * Speicher frei. Format:
+ *   { "label": ..., "compiler": ..., "cpu": N, "trials": N,
+ *     "results": [ { "name", "ops", "median_ns", "p99_ns",
+ *                    "min_ns", "max_ns", "ops_per_sec" }, ... ] }
+ *
+ * Parameter:
+ *   suite – Sammlung
+ *
+ * Rückgabe:
+ *   false, wenn die Datei nicht geschrieben werden konnte
+ * ------------------------------------------------------------------ */
+bool bench_end(bench_suite_t *suite)
+{
+    const bench_opts_t *o = &suite->opts;
+    bool ok = true;
+
+    if (o->json) {
+        bool  to_stdout = strcmp(o->json, "-") == 0;
+        FILE *f = to_stdout ? stdout : fopen(o->json, "w");
+        if (!f) {
+            free(suite->results);
+            return false;
+        }
+        fprintf(f, "{\n  \"label\": ");
+        json_string(f, o->label);
+        fprintf(f, ",\n  \"compiler\": ");
+        json_string(f, __VERSION__);
+        fprintf(f, ",\n  \"cpu\": %d,\n  \"trials\": %d,\n  \"results\": [\n",
+                suite->cpu, o->trials);
+        for (int i = 0; i < suite->count; ++i) {
+            const bench_result_t *r = &suite->results[i];
+            fprintf(f, "    { \"name\": ");
+            json_string(f, r->name);
+            fprintf(f, ", \"ops\": %llu, \"median_ns\": %.3f, "
+                       "\"p99_ns\": %.3f, \"min_ns\": %.3f, \"max_ns\": %.3f, "
+                       "\"ops_per_sec\": %.0f }%s\n",
+                    (unsigned long long)r->ops, r->median_ns, r->p99_ns,
+                    r->min_ns, r->max_ns, r->ops_per_sec,
+                    i + 1 < suite->count ? "," : "");
+        }
+        fprintf(f, "  ]\n}\n");
+        ok = !ferror(f);
+        if (!to_stdout)
+            ok = fclose(f) == 0 && ok;
+    }
+    free(suite->results);
+    suite->results = NULL;
+    return ok;
+}
@@ -0,0 +1,68 @@
+/* ------------------------------------------------------------------
+ * harness.h - Header des Benchmark-Rahmens
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#ifndef HARNESS_H
+#define HARNESS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define BENCH_MAX_TRIALS 1001
+#define BENCH_NAME_LEN   48
+
+/* Zu messende Arbeit: `ops` Operationen auf ctx ausführen */
+typedef void (*bench_fn_t)(void *ctx, uint64_t ops);
+
+typedef struct
+{
+    int         trials;         /* Messläufe (Median/p99 darüber)     */
+    double      trial_ms;       /* Ziel-Dauer eines Messlaufs         */
+    double      warmup_ms;      /* Aufwärmen vor der Kalibrierung     */
+    int         cpu;            /* Kern für Pinning, -1 = aktueller   */
+    bool        pin;
+    const char *json;           /* Ausgabedatei, NULL = keine, "-" = stdout */
+    const char *label;          /* z. B. Commit, landet im JSON       */
+    const char *filter;         /* nur Benchmarks, deren Name das enthält */
+} bench_opts_t;
+
+typedef struct
+{
+    char     name[BENCH_NAME_LEN];
+    uint64_t ops;               /* Operationen pro Messlauf           */
+    int      trials;
+    double   median_ns;         /* ns/op, Median der Messläufe        */
+    double   p99_ns;            /* ns/op, 99. Perzentil               */
+    double   min_ns;
+    double   max_ns;
+    double   ops_per_sec;       /* aus dem Median                     */
+} bench_result_t;
+
+typedef struct
+{
+    bench_opts_t   opts;
+    int            cpu;         /* tatsächlich gebundener Kern, -1 = keiner */
+    bench_result_t *results;
+    int            count, cap;
+} bench_suite_t;
+
+double bench_now_ns(void);
+bool   bench_parse_args(int argc, char *argv[], bench_opts_t *opts);
+bool   bench_begin(bench_suite_t *suite, const bench_opts_t *opts);
+bool   bench_run(bench_suite_t *suite, const char *name, bench_fn_t fn, void *ctx);
+bool   bench_end(bench_suite_t *suite);
+
+/* Kennzahlen einer Messreihe (sortiert samples in-place) */
+double bench_percentile(double *samples, int n, double p);
+
+/* Einseitiger Mann-Whitney-U-Test "b ist größer als a" (Normal-
+   approximation mit Bindungskorrektur); liefert den p-Wert */
+double bench_mann_whitney(const double *a, int na, const double *b, int nb,
+                          double *u_out);
+
+bool bench_pin_cpu(int cpu);
+
+#endif /* HARNESS_H */
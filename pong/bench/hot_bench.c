@@ -0,0 +1,219 @@
+/* ------------------------------------------------------------------
+ * hot_bench.c - ns/op der heißen Pfade: Ball, Paddle, KI, Rendern
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ *
+ * Ballwege laufen als Dauerrally zwischen zwei feldbreiten Paddles,
+ * deren Tempo nach jedem Treffer auf langsam, mittel bzw.
+ * BALL_MAX_SPEED zurückgesetzt wird. Paddle-Treffer (reflect_paddle)
+ * werden erzwungen, indem der Ball vor jedem Aufruf direkt über den
+ * Spieler gesetzt wird. KI und Rendern arbeiten auf einem Vorrat
+ * echter Spielzustände aus einer Bot-gegen-Bot-Partie; die Kopie
+ * des Zustands (~100 Bytes) ist in diesen Zahlen enthalten.
+ *
+ * Aufruf: hot_bench [--json DATEI|-] [--label TEXT] [--trials N] ...
+ * (siehe bench_parse_args)
+ * ------------------------------------------------------------------ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "harness.h"
+#include "physics.h"
+#include "ai.h"
+#include "render.h"
+#include "render_grid.h"
+#include "config.h"
+
+#define FIELD_W     80
+#define FIELD_H     24
+#define STATE_POOL  1024        /* Zweierpotenz */
+
+static volatile float sink;
+
+/* ---------------------------------------------------------------
+ * Ball-Rally mit festem Tempo
+ * --------------------------------------------------------------- */
+typedef struct
+{
+    game_state_t g;
+    float        speed;
+} rally_t;
+
+static void rally_init(rally_t *r, float speed)
+{
+    r->g = physics_create_game_seeded(FIELD_W, FIELD_H, 1u, 0u);
+    r->g.player.width = r->g.bot.width = FIELD_W - 1;
+    r->g.player.x     = r->g.bot.x     = 0.0f;
+    r->g.ball.vx = speed * 0.6f;
+    r->g.ball.vy = -speed * 0.8f;
+    r->speed = speed;
+}
+
+static void rally_fn(void *ctx, uint64_t ops)
+{
+    rally_t *r = ctx;
+    for (uint64_t i = 0; i < ops; ++i) {
+        physics_event_t ev = physics_update_ball_events(&r->g);
+        if (ev & (PHYS_EVENT_HIT_PLAYER | PHYS_EVENT_HIT_BOT)) {
+            /* Tempo festhalten: Bounce und Mindesttempo zurücksetzen */
+            float mag = hypotf(r->g.ball.vx, r->g.ball.vy);
+            r->g.ball.vx *= r->speed / mag;
+            r->g.ball.vy *= r->speed / mag;
+            r->g.paddle_hits = 0;
+        }
+    }
+    sink = r->g.ball.x;
+}
+
+/* ---------------------------------------------------------------
+ * Paddle-Treffer: jeder Aufruf endet in reflect_paddle
+ * --------------------------------------------------------------- */
+static void paddle_hit_fn(void *ctx, uint64_t ops)
+{
+    game_state_t *g = ctx;
+    float hits = 0.0f;
+    for (uint64_t i = 0; i < ops; ++i) {
+        g->ball.x  = g->player.x + (float)(i % (unsigned)g->player.width);
+        g->ball.y  = (float)g->player.y - 0.5f;
+        g->ball.vx = 0.3f;
+        g->ball.vy = 1.5f;
+        g->paddle_hits = 0;
+        hits += (physics_update_ball_events(g) & PHYS_EVENT_HIT_PLAYER) ? 1.0f : 0.0f;
+    }
+    sink = hits;
+}
+
+/* ---------------------------------------------------------------
+ * update_paddle: Beschleunigen, Ausrollen, Anschlag
+ * --------------------------------------------------------------- */
+static void paddle_fn(void *ctx, uint64_t ops)
+{
+    paddle_t *p = ctx;
+    for (uint64_t i = 0; i < ops; ++i) {
+        int phase = (int)(i >> 4) & 3;      /* rechts, still, links, still */
+        float dir = phase == 0 ? 1.0f : phase == 2 ? -1.0f : 0.0f;
+        update_paddle(p, dir, physics_rate()->player_accel,
+                      physics_rate()->player_max_speed, FIELD_W);
+    }
+    sink = p->x;
+}
+
+/* ---------------------------------------------------------------
+ * Zustandsvorrat für KI und Rendern
+ * --------------------------------------------------------------- */
+typedef struct
+{
+    game_state_t states[STATE_POOL];
+    bool         cold;          /* KI-Cache vor jedem Aufruf verwerfen */
+} pool_t;
+
+static void pool_init(pool_t *p)
+{
+    game_state_t g = physics_create_game_seeded(FIELD_W, FIELD_H, 7u, 0u);
+    for (int i = 0; i < STATE_POOL; ++i) {
+        ai_player_update(&g);
+        ai_update(&g);
+        physics_update_ball_events(&g);
+        p->states[i] = g;
+    }
+}
+
+static void ai_fn(void *ctx, uint64_t ops)
+{
+    pool_t *p = ctx;
+    float acc = 0.0f;
+    for (uint64_t i = 0; i < ops; ++i) {
+        game_state_t g = p->states[i & (STATE_POOL - 1)];
+        if (p->cold)
+            g.bot_ai.valid = false;
+        ai_update(&g);
+        acc += g.bot.x;
+    }
+    sink = acc;
+}
+
+static void render_fn(void *ctx, uint64_t ops)
+{
+    pool_t *p = ctx;
+    for (uint64_t i = 0; i < ops; ++i)
+        render_frame(&p->states[i & (STATE_POOL - 1)], PHYS_EVENT_NONE);
+}
+
+/* Kompletter Tick Bot gegen Bot (Referenz für die Summe); nach Game
+   Over beginnt ein neues Spiel, sonst würden nur Früh‑Ausstiege gemessen */
+static void tick_fn(void *ctx, uint64_t ops)
+{
+    game_state_t *g = ctx;
+    for (uint64_t i = 0; i < ops; ++i) {
+        ai_player_update(g);
+        ai_update(g);
+        if (physics_update_ball_events(g) & PHYS_EVENT_GAME_OVER)
+            *g = physics_create_game_seeded(FIELD_W, FIELD_H, 3u, 0u);
+    }
+    sink = g->ball.x;
+}
+
+static void set_ai_mode(ai_mode_t mode)
+{
+    ai_config_t ai;
+    ai_config_defaults(&ai);
+    ai.mode = mode;
+    ai_configure(&ai);
+}
+
+static pool_t pool;
+
+int main(int argc, char *argv[])
+{
+    bench_opts_t  opts;
+    bench_suite_t suite;
+    if (!bench_parse_args(argc, argv, &opts)) {
+        fprintf(stderr, "usage: %s [--json FILE|-] [--label TEXT] [--trials N] "
+                        "[--trial-ms T] [--warmup-ms W] [--cpu C] [--no-pin] "
+                        "[--filter TEXT]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    bench_begin(&suite, &opts);
+
+    rally_t rally;
+    rally_init(&rally, physics_rate()->ball_initial_speed);
+    bench_run(&suite, "ball_rally_slow", rally_fn, &rally);
+    rally_init(&rally, 2.0f);
+    bench_run(&suite, "ball_rally_medium", rally_fn, &rally);
+    rally_init(&rally, physics_rate()->ball_max_speed);
+    bench_run(&suite, "ball_rally_max", rally_fn, &rally);
+
+    game_state_t hit = physics_create_game_seeded(FIELD_W, FIELD_H, 2u, 0u);
+    bench_run(&suite, "paddle_hit_reflect", paddle_hit_fn, &hit);
+
+    paddle_t pad = hit.player;
+    bench_run(&suite, "update_paddle", paddle_fn, &pad);
+
+    set_ai_mode(AI_MODE_PREDICT);
+    pool_init(&pool);
+    set_ai_mode(AI_MODE_CHASE);
+    bench_run(&suite, "ai_update_chase", ai_fn, &pool);
+    set_ai_mode(AI_MODE_PREDICT);
+    bench_run(&suite, "ai_update_predict_cached", ai_fn, &pool);
+    pool.cold = true;
+    bench_run(&suite, "ai_update_predict_cold", ai_fn, &pool);
+    set_ai_mode(AI_MODE_CHASE);
+
+    game_state_t tick = physics_create_game_seeded(FIELD_W, FIELD_H, 3u, 0u);
+    bench_run(&suite, "game_tick_bot_vs_bot", tick_fn, &tick);
+
+    const char *backends[] = { "grid", "null" };
+    for (int i = 0; i < 2; ++i) {
+        char name[BENCH_NAME_LEN];
+        render_select(backends[i]);
+        render_grid_set_size(FIELD_W, FIELD_H);
+        if (!render_init())
+            continue;
+        snprintf(name, sizeof name, "render_frame_%s", backends[i]);
+        bench_run(&suite, name, render_fn, &pool);
+        render_shutdown();
+    }
+
+    return bench_end(&suite) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
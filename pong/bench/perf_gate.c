@@ -0,0 +1,299 @@
+/* ------------------------------------------------------------------
+ * perf_gate.c - Laufzeit-Schranke für die Headless-Spielschleife
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ *
+ * Feste, geseedete Arbeitslasten laufen durch loop_run (null-Renderer,
+ * virtuelle Uhr), also durch denselben Code wie das Spiel: Physik,
+ * KI, Zustandsautomat und render_frame. Jede Last wird mehrfach
+ * gemessen (ns pro Frame, geteilt durch eine danebenliegende
+ * Referenzarbeit) und per Mann-Whitney-U-Test mit der eingecheckten
+ * Baseline verglichen. Die Baseline gilt für die Maschine, auf der
+ * sie erzeugt wurde. Eine Verlangsamung gilt erst
+ * als Regression, wenn sie signifikant (p < alpha) UND größer als
+ * die Mindestschwelle ist; so schlagen weder Rauschen noch winzige,
+ * aber messbare Änderungen an.
+ *
+ * Aufruf: perf_gate [--baseline DATEI] [--update] [--reps N]
+ *                   [--alpha A] [--threshold PROZENT] [--cpu C]
+ * Rückgabe 0 = in Ordnung, 1 = Regression, 2 = Fehler.
+ * ------------------------------------------------------------------ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "harness.h"
+#include "loop.h"
+#include "render.h"
+#include "physics.h"
+#include "ai.h"
+#include "config.h"
+
+#define GATE_MAX_REPS   64
+#define GATE_FRAMES     600000
+#define FIELD_W         80
+#define FIELD_H         24
+
+/* ---------------------------------------------------------------
+ * Arbeitslasten
+ * --------------------------------------------------------------- */
+typedef struct
+{
+    const char *name;
+    uint64_t    seed;
+    int         start_score;     /* höherer Score → schnellerer Aufschlag */
+    float       bot_error;       /* großer KI-Fehler → der Bot verfehlt oft */
+} workload_t;
+
+static const workload_t workloads[] = {
+    { "long_rallies",     11u,  0,  0.0f },
+    { "high_speed",       12u, 30,  0.0f },
+    { "frequent_scoring", 13u,  0, 40.0f },
+};
+#define WORKLOAD_COUNT ((int)(sizeof workloads / sizeof workloads[0]))
+
+/* Skript-Spieler: folgt dem Ball wie ai_player_update */
+static input_action_t follow_poll(void *user)
+{
+    const game_state_t *g = user;
+    float mid = g->player.x + g->player.width / 2.0f;
+    int   dx  = 0;
+    if (fabsf(g->ball.x - mid) > 0.5f)
+        dx = g->ball.x > mid ? 1 : -1;
+    input_action_t a = { dx, 0, 0, 0, 0 };
+    return a;
+}
+
+/* ------------------------------------------------------------------
+ * run_workload
+ * Eine Messung: GATE_FRAMES Frames loop_run. Endet ein Spiel mit
+ * Game Over, beginnt das nächste (Seed + Spielnummer als Stream),
+ * bis die Frames erreicht sind – die Last ist damit fest.
+ *
+ * Parameter:
+ *   w     – Arbeitslast
+ *   games – Ausgabe: Anzahl gespielter Spiele
+ *
+ * Rückgabe:
+ *   ns pro Frame
+ * ------------------------------------------------------------------ */
+static double run_workload(const workload_t *w, unsigned long *games)
+{
+    ai_config_t ai;
+    ai_config_defaults(&ai);
+    ai.mode       = AI_MODE_PREDICT;
+    ai.error_base = w->bot_error > 0.0f ? w->bot_error : ai.error_base;
+    ai_configure(&ai);
+
+    unsigned long frames = 0;
+    double        ns     = 0.0;
+    *games = 0;
+    while (frames < GATE_FRAMES) {
+        game_state_t g = physics_create_game_seeded(FIELD_W, FIELD_H, w->seed, *games);
+        if (w->start_score > 0) {
+            float v0    = physics_rate()->ball_initial_speed;
+            float scale = (v0 + w->start_score * SPEED_PER_POINT) /
+                          hypotf(g.ball.vx, g.ball.vy);
+            g.score    = w->start_score;
+            g.ball.vx *= scale;
+            g.ball.vy *= scale;
+        }
+
+        loop_config_t cfg = { .headless = true, .max_frames = GATE_FRAMES - frames,
+                              .poll = follow_poll, .user = &g };
+        loop_result_t res;
+        double t0 = bench_now_ns();
+        loop_run(&g, &cfg, &res);
+        ns += bench_now_ns() - t0;
+
+        frames += res.frames;
+        (*games)++;
+    }
+    return ns / (double)frames;
+}
+
+/* ------------------------------------------------------------------
+ * calibrate
+ * Feste Referenzarbeit ohne Bezug zum Spielcode (Ganzzahl-Hash und
+ * abhängige Gleitkomma-Kette). Sie läuft direkt neben jeder Messung;
+ * geteilt durch sie heben sich Taktänderungen und Störungen durch
+ * andere Prozesse weitgehend heraus.
+ *
+ * Parameter:
+ *   keine
+ *
+ * Rückgabe:
+ *   ns pro Iteration
+ * ------------------------------------------------------------------ */
+static volatile float calib_sink;
+
+static double calibrate(void)
+{
+    enum { CALIB_ITERS = 2000000 };
+    uint32_t x = 2463534242u;
+    float    f = 1.0f;
+    double   t0 = bench_now_ns();
+    for (int i = 0; i < CALIB_ITERS; ++i) {
+        x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+        f = f * 0.999f + (float)(x & 0xFFu) * 1e-3f;
+    }
+    double dt = bench_now_ns() - t0;
+    calib_sink = f;
+    return dt / CALIB_ITERS;
+}
+
+/* ---------------------------------------------------------------
+ * Baseline-Datei: eine Zeile je Last
+ *   name spiele kosten_1 … kosten_n
+ * Kosten = ns pro Frame / ns pro Referenz-Iteration (calibrate).
+ * '#' leitet Kommentare ein.
+ * --------------------------------------------------------------- */
+typedef struct
+{
+    unsigned long games;         /* Spiele je Messung (Kontrollwert) */
+    double        ns[GATE_MAX_REPS];    /* ns pro Frame                 */
+    double        rel[GATE_MAX_REPS];   /* ns pro Frame / Referenz      */
+    int           n;
+} series_t;
+
+static bool load_baseline(const char *path, series_t base[WORKLOAD_COUNT])
+{
+    FILE *f = fopen(path, "r");
+    if (!f)
+        return false;
+    char line[4096];
+    while (fgets(line, sizeof line, f)) {
+        if (line[0] == '#' || line[0] == '\n')
+            continue;
+        char *save = NULL;
+        char *name = strtok_r(line, " \t\n", &save);
+        char *games = strtok_r(NULL, " \t\n", &save);
+        if (!name || !games)
+            continue;
+        for (int w = 0; w < WORKLOAD_COUNT; ++w) {
+            if (strcmp(name, workloads[w].name) != 0)
+                continue;
+            base[w].games = strtoul(games, NULL, 10);
+            base[w].n      = 0;
+            char *tok;
+            while ((tok = strtok_r(NULL, " \t\n", &save)) && base[w].n < GATE_MAX_REPS)
+                base[w].rel[base[w].n++] = atof(tok);
+        }
+    }
+    fclose(f);
+    return true;
+}
+
+static bool save_baseline(const char *path, const series_t cur[WORKLOAD_COUNT])
+{
+    FILE *f = fopen(path, "w");
+    if (!f)
+        return false;
+    fprintf(f, "# perf_gate baseline (make perf-baseline): name games cost/frame...\n");
+    for (int w = 0; w < WORKLOAD_COUNT; ++w) {
+        fprintf(f, "%s %lu", workloads[w].name, cur[w].games);
+        for (int i = 0; i < cur[w].n; ++i)
+            fprintf(f, " %.4f", cur[w].rel[i]);
+        fputc('\n', f);
+    }
+    return fclose(f) == 0;
+}
+
+static double median(const double *v, int n)
+{
+    double tmp[GATE_MAX_REPS];
+    memcpy(tmp, v, (size_t)n * sizeof *v);
+    return bench_percentile(tmp, n, 50.0);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *baseline  = "bench/perf_baseline.txt";
+    bool        update    = false;
+    int         reps      = 15;
+    double      alpha     = 0.01;
+    double      threshold = 10.0;       /* Prozent */
+    int         cpu       = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--update") == 0) { update = true; continue; }
+        if (i + 1 >= argc)
+            goto usage;
+        const char *val = argv[++i];
+        if (strcmp(argv[i - 1], "--baseline") == 0)       baseline  = val;
+        else if (strcmp(argv[i - 1], "--reps") == 0)      reps      = atoi(val);
+        else if (strcmp(argv[i - 1], "--alpha") == 0)     alpha     = atof(val);
+        else if (strcmp(argv[i - 1], "--threshold") == 0) threshold = atof(val);
+        else if (strcmp(argv[i - 1], "--cpu") == 0)       cpu       = atoi(val);
+        else goto usage;
+    }
+    if (reps < 2 || reps > GATE_MAX_REPS)
+        goto usage;
+
+    bench_pin_cpu(cpu);
+    if (!render_select("null") || !render_init()) {
+        fprintf(stderr, "perf_gate: null-Renderer nicht verfügbar\n");
+        return 2;
+    }
+
+    /* Messen: Lasten verschränkt, damit Drift (Takt, Temperatur)
+       alle gleich trifft; eine Aufwärmrunde wird verworfen */
+    static series_t cur[WORKLOAD_COUNT];
+    for (int r = -1; r < reps; ++r) {
+        for (int w = 0; w < WORKLOAD_COUNT; ++w) {
+            double ref = calibrate();
+            double ns  = run_workload(&workloads[w], &cur[w].games);
+            if (r >= 0) {
+                cur[w].ns[cur[w].n]  = ns;
+                cur[w].rel[cur[w].n] = ns / ref;
+                cur[w].n++;
+            }
+        }
+    }
+    render_shutdown();
+
+    if (update) {
+        if (!save_baseline(baseline, cur)) {
+            fprintf(stderr, "perf_gate: %s kann nicht geschrieben werden\n", baseline);
+            return 2;
+        }
+        printf("perf_gate: Baseline %s mit %d Messungen je Last geschrieben\n", baseline, reps);
+        return 0;
+    }
+
+    static series_t base[WORKLOAD_COUNT];
+    if (!load_baseline(baseline, base)) {
+        fprintf(stderr, "perf_gate: %s fehlt (make perf-baseline)\n", baseline);
+        return 2;
+    }
+
+    int regressions = 0;
+    printf("%-18s %6s %10s %10s %8s %8s %9s  %s\n", "workload", "games",
+           "base cost", "now cost", "change", "p", "now ns/f", "verdict");
+    for (int w = 0; w < WORKLOAD_COUNT; ++w) {
+        double ns = median(cur[w].ns, cur[w].n);
+        double mc = median(cur[w].rel, cur[w].n);
+        if (base[w].n < 2) {
+            printf("%-18s %6lu %10s %10.3f %8s %8s %9.1f  no baseline\n", workloads[w].name,
+                   cur[w].games, "-", mc, "-", "-", ns);
+            continue;
+        }
+        double mb     = median(base[w].rel, base[w].n);
+        double change = (mc / mb - 1.0) * 100.0;
+        double p      = bench_mann_whitney(base[w].rel, base[w].n, cur[w].rel, cur[w].n, NULL);
+        bool   slower = p < alpha && change > threshold;
+        if (slower)
+            regressions++;
+        printf("%-18s %6lu %10.3f %10.3f %+7.1f%% %8.4f %9.1f  %s%s\n", workloads[w].name,
+               cur[w].games, mb, mc, change, p, ns,
+               slower ? "SLOWER" : p < alpha && change > 0.0 ? "slower (below threshold)" : "ok",
+               base[w].games != cur[w].games ? " (workload changed)" : "");
+    }
+    return regressions ? 1 : 0;
+
+usage:
+    fprintf(stderr, "usage: %s [--baseline FILE] [--update] [--reps N] [--alpha A] "
+                    "[--threshold PCT] [--cpu C]\n", argv[0]);
+    return 2;
+}
@@ -0,0 +1,105 @@
+/* ------------------------------------------------------------------
+ * snapshot_bench.c - Kosten von Snapshot, Restore und Ring-Rückspulen
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ *
+ * Misst physics_save/physics_restore, snapshot_take/snapshot_apply
+ * und snap_ring_push/snap_ring_rewind in ns pro Aufruf und stellt
+ * ein reines memcpy derselben Größe daneben.
+ *
+ * Aufruf: snapshot_bench [--json DATEI|-] [--label TEXT] [--trials N] ...
+ * (siehe bench_parse_args)
+ * ------------------------------------------------------------------ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "harness.h"
+#include "physics.h"
+#include "snapshot.h"
+
+static volatile uint64_t sink;
+
+typedef struct
+{
+    game_state_t       g;
+    physics_snapshot_t ps;
+    snapshot_t         s, copy;
+    snap_ring_t        ring;
+    uint64_t           tick;
+} snap_ctx_t;
+
+static void physics_fn(void *ctx, uint64_t ops)
+{
+    snap_ctx_t *c = ctx;
+    for (uint64_t i = 0; i < ops; ++i) {
+        c->g.paddle_hits = (int)i;
+        physics_save(&c->g, i, &c->ps);
+        physics_restore(&c->g, NULL, &c->ps);
+        sink += (uint64_t)c->g.paddle_hits;
+    }
+}
+
+static void snapshot_fn(void *ctx, uint64_t ops)
+{
+    snap_ctx_t *c = ctx;
+    for (uint64_t i = 0; i < ops; ++i) {
+        c->g.paddle_hits = (int)i;
+        snapshot_take(&c->s, &c->g, i);
+        snapshot_apply(&c->s, &c->g, NULL);
+        sink += (uint64_t)c->g.paddle_hits;
+    }
+}
+
+/* Referenz: dieselbe Größe hin und zurück kopieren */
+static void memcpy_fn(void *ctx, uint64_t ops)
+{
+    snap_ctx_t *c = ctx;
+    for (uint64_t i = 0; i < ops; ++i) {
+        c->s.phys.tick = i;
+        memcpy(&c->copy, &c->s, sizeof c->s);
+        memcpy(&c->s, &c->copy, sizeof c->s);
+        sink += c->copy.phys.tick;
+    }
+}
+
+/* Ring: pro Tick ablegen, alle 8 Ticks 4 zurückspulen */
+static void ring_fn(void *ctx, uint64_t ops)
+{
+    snap_ctx_t *c = ctx;
+    for (uint64_t i = 0; i < ops; ++i) {
+        snap_ring_push(&c->ring, &c->g, c->tick++);
+        if ((i & 7u) == 7u)
+            snap_ring_rewind(&c->ring, c->tick - 4, &c->g, &c->tick);
+    }
+    sink += c->tick;
+}
+
+static snap_ctx_t snap_ctx;
+
+int main(int argc, char *argv[])
+{
+    bench_opts_t  opts;
+    bench_suite_t suite;
+    if (!bench_parse_args(argc, argv, &opts)) {
+        fprintf(stderr, "usage: %s [--json FILE|-] [--label TEXT] [--trials N] "
+                        "[--trial-ms T] [--warmup-ms W] [--cpu C] [--no-pin] "
+                        "[--filter TEXT]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    FILE *out = opts.json && strcmp(opts.json, "-") == 0 ? stderr : stdout;
+    fprintf(out, "snapshot_t: %zu bytes (physics %zu)\n",
+            sizeof(snapshot_t), sizeof(physics_snapshot_t));
+    bench_begin(&suite, &opts);
+
+    snap_ctx.g = physics_create_game(80, 24);
+    snapshot_take(&snap_ctx.s, &snap_ctx.g, 0u);
+    bench_run(&suite, "physics_save_restore", physics_fn, &snap_ctx);
+    bench_run(&suite, "snapshot_take_apply", snapshot_fn, &snap_ctx);
+    bench_run(&suite, "memcpy_x2_reference", memcpy_fn, &snap_ctx);
+
+    snap_ring_reset(&snap_ctx.ring);
+    bench_run(&suite, "ring_push_rewind8", ring_fn, &snap_ctx);
+
+    return bench_end(&suite) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -8,10 +8,94 @@
 #include "config.h"
 #include <math.h>     
 
+/* Aktives Bot-Verhalten (Standard: Ball verfolgen) */
+static ai_config_t ai_cfg = {
+    AI_MODE_CHASE, AI_ERROR_BASE, AI_ERROR_PER_SECOND, AI_ERROR_PER_POINT
+};
+
+/* ------------------------------------------------------------------
+ * ai_config_defaults / ai_configure / ai_get_config
+ * Standardwerte aus config.h, neues Bot-Verhalten setzen bzw. das
+ * aktive auslesen.
+ *
+ * Parameter:
+ *   cfg – Konfiguration
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void ai_config_defaults(ai_config_t *cfg)
+{
+    cfg->mode            = AI_MODE_CHASE;
+    cfg->error_base      = AI_ERROR_BASE;
+    cfg->error_per_sec   = AI_ERROR_PER_SECOND;
+    cfg->error_per_point = AI_ERROR_PER_POINT;
+}
+
+void ai_configure(const ai_config_t *cfg)
+{
+    ai_cfg = *cfg;
+}
+
+void ai_get_config(ai_config_t *cfg)
+{
+    *cfg = ai_cfg;
+}
+
+/* ------------------------------------------------------------------
+ * predict_target
+ * Liefert die x-Position, auf die der Bot die Paddlemitte steuert.
+ * Solange der Ball mit unveränderter Geschwindigkeit fliegt, bleibt
+ * der Zielpunkt im Cache; sonst wird der Auftreffpunkt auf der Bot-
+ * Zeile neu berechnet und mit dem Fehlermodell verrauscht. Fliegt der
+ * Ball vom Bot weg, folgt der Bot einfach der Ball-x.
+ *
+ * Parameter:
+ *   g – Zeiger auf den Spielzustand (Cache, Zufall)
+ *
+ * Rückgabe:
+ *   Ziel-x
+ * ------------------------------------------------------------------ */
+static float predict_target(game_state_t *g)
+{
+    ai_target_t *c = &g->bot_ai;
+
+    /* Ball fliegt weg: unter dem Ball bleiben, Ziel erst beim Rückweg */
+    if (g->ball.vy >= 0.0f) {
+        c->valid = false;
+        return g->ball.x;
+    }
+    if (c->valid && c->ball_vx == g->ball.vx && c->ball_vy == g->ball.vy)
+        return c->target_x;
+
+    c->valid   = true;
+    c->ball_vx = g->ball.vx;
+    c->ball_vy = g->ball.vy;
+
+    physics_intercept_t hit;
+    if (!physics_predict_intercept(g, g->bot.y + 1, &hit)) {
+        c->target_x = g->ball.x;       /* schon an der Bot-Zeile vorbei */
+        return c->target_x;
+    }
+
+    /* Vorlauf hit.t in Ticks → Streuung je Tick der aktiven Rate */
+    float per_tick = (float)((double)ai_cfg.error_per_sec / physics_tick_rate());
+    float spread   = (ai_cfg.error_base + per_tick * hit.t) /
+                   (1.0f + ai_cfg.error_per_point * g->score);
+    if (spread > 0.0f) {
+        /* Dreiecksverteilung auf [-1, 1) aus zwei gleichverteilten Zahlen */
+        float u = (float)physics_rand(g) * (1.0f / 4294967296.0f);
+        float v = (float)physics_rand(g) * (1.0f / 4294967296.0f);
+        hit.x += spread * (u + v - 1.0f);
+    }
+    c->target_x = hit.x;
+    return c->target_x;
+}
+
 /* ------------------------------------------------------------------
  * ai_update
  * Aktualisiert die Position und Beschleunigung des Bot‑Paddles,
- * damit es dem Ball folgt.
+ * damit es dem Ball (CHASE) bzw. dessen Auftreffpunkt (PREDICT) folgt.
  *
  * Parameter:
  *   g – Zeiger auf den aktuellen Spielzustand.
@@ -21,19 +105,47 @@
  * ------------------------------------------------------------------ */
 void ai_update(game_state_t *g)
 {
-    /* x-Koordinate der Ballmitte und des Bot-Mittelpunkts            */
-    float ball_mid = g->ball.x;
-    float bot_mid  = g->bot.x + g->bot.width / 2.0f;
+    float bot_mid = g->bot.x + g->bot.width / 2.0f;
+    int   dir     = 0;
+
+    if (ai_cfg.mode == AI_MODE_PREDICT) {
+        /* Festes Ziel: so steuern, dass das Paddle ohne Eingabe genau dort
+           ausrollt (Dämpfung: Reststrecke = vx · d / (1 - d))           */
+        float damp  = physics_rate()->damping;
+        float coast = g->bot.vx * damp / (1.0f - damp);
+        float diff  = predict_target(g) - bot_mid - coast;
+        if (fabsf(diff) > 0.5f)
+            dir = (diff > 0.0f) ? +1 : -1;
+    } else {
+        /* x-Koordinate der Ballmitte und des Bot-Mittelpunkts            */
+        float ball_mid = g->ball.x;
+        if (fabsf(ball_mid - bot_mid) > 0.5f)
+            dir = (ball_mid > bot_mid) ? +1 : -1;
+    }
+
+    physics_bot_update(g, dir);
+}
 
-    float dir = 0.0f;
-    if (fabsf(ball_mid - bot_mid) > 0.5f)
-        dir = (ball_mid > bot_mid) ? +1.0f : -1.0f;
+/* ------------------------------------------------------------------
+ * ai_player_update
+ * Steuert das Spieler‑Paddle wie einen Bot (gleiche Zielregel wie
+ * ai_update, aber mit Spieler-Beschleunigung). Für Headless-Läufe,
+ * in denen niemand die Tasten drückt.
+ *
+ * Parameter:
+ *   g – Zeiger auf den aktuellen Spielzustand.
+ *
+ * Rückgabe:
+ *   keine (Spielzustand wird in‑place modifiziert)
+ * ------------------------------------------------------------------ */
+void ai_player_update(game_state_t *g)
+{
+    float ball_mid   = g->ball.x;
+    float player_mid = g->player.x + g->player.width / 2.0f;
 
-    float accel = BOT_BASE_ACCELERATION +
-                  BOT_ACCEL_PER_POINT * g->score;
+    int dir = 0;
+    if (fabsf(ball_mid - player_mid) > 0.5f)
+        dir = (ball_mid > player_mid) ? +1 : -1;
 
-    update_paddle(&g->bot, dir,
-                  accel,
-                  BOT_MAX_SPEED,
-                  g->field_width);
+    physics_player_update(g, dir);
 }
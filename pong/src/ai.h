@@ -10,6 +10,35 @@
 #include "physics.h"
 #include "config.h"
 
+/* ---------------------------------------------------------------
+ * Bot-Verhalten
+ * CHASE folgt der aktuellen Ball-x. PREDICT steuert den berechneten
+ * Auftreffpunkt auf der Bot-Zeile an (physics_predict_intercept) und
+ * rechnet ihn nur neu, wenn sich die Ballgeschwindigkeit ändert
+ * (Paddle- oder Wandkontakt, Aufschlag); fliegt der Ball weg, folgt
+ * der Bot der Ball-x. Gesteuert wird mit Blick auf die Strecke, die
+ * das Paddle gedämpft noch ausrollt. Der Fehler ist gleichverteilt
+ * dreieckig mit Breite (error_base + error_per_sec · Vorlauf) /
+ * (1 + error_per_point · Score) und kommt aus dem Spielgenerator.
+ * --------------------------------------------------------------- */
+typedef enum {
+    AI_MODE_CHASE = 0,
+    AI_MODE_PREDICT,
+} ai_mode_t;
+
+typedef struct
+{
+    ai_mode_t mode;
+    float     error_base;        /* Zellen                          */
+    float     error_per_sec;     /* Zellen je Sekunde bis zum Auftreffen */
+    float     error_per_point;   /* Abnahme je Score-Punkt          */
+} ai_config_t;
+
+void ai_config_defaults(ai_config_t *cfg);
+void ai_configure(const ai_config_t *cfg);
+void ai_get_config(ai_config_t *cfg);
+
 void ai_update(game_state_t *game);
+void ai_player_update(game_state_t *game);   /* Spieler per KI (Headless) */
 
 #endif /* AI_H */
@@ -0,0 +1,940 @@
+/* ------------------------------------------------------------------
+ * batch.c - Batch-Simulator: viele Spiele als Structure-of-Arrays
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ *
+ * Dieselbe Physik wie physics.c/ai.c (analytischer Löser), aber für
+ * BATCH_LANES Spiele pro Befehl. Statt Verzweigungen werden für jede
+ * Kontaktart Masken berechnet und Ergebnisse per Select übernommen.
+ *
+ * Zwei Durchläufe pro Tick: der erste bewegt Paddles und alle Bälle,
+ * die sicher nichts berühren; nur die übrigen Spiele (typisch < 20 %)
+ * werden dicht gepackt durch die volle Kontaktschleife geschickt.
+ *
+ * Die Rechenreihenfolge entspricht Operation für Operation dem
+ * skalaren Code, ohne Zufall sind die Ergebnisse daher bitgleich.
+ * Der Bot ist immer die Verfolger-KI (AI_MODE_CHASE) und der Zufall
+ * ein eigener xorshift je Lane – Farm-Statistiken sind daher nur
+ * statistisch mit der skalaren Engine vergleichbar, nicht identisch.
+ * ------------------------------------------------------------------ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "batch.h"
+#include "config.h"
+
+/* ---------------------------------------------------------------
+ * Vektor-Abstraktion: AVX2 (8 Lanes), SSE2 (4 Lanes) oder skalar.
+ * vf = Float-Vektor, vm = Maske (Ergebnis eines Vergleichs),
+ * vi = 32‑Bit‑Integer‑Vektor (Zufall und Events).
+ * --------------------------------------------------------------- */
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BATCH_LANES 8
+typedef __m256  vf;
+typedef __m256  vm;
+typedef __m256i vi;
+#define vf_load(p)        _mm256_load_ps(p)
+#define vf_loadu(p)       _mm256_loadu_ps(p)
+#define vf_store(p, a)    _mm256_store_ps(p, a)
+#define vf_set(c)         _mm256_set1_ps(c)
+#define vf_add            _mm256_add_ps
+#define vf_sub            _mm256_sub_ps
+#define vf_mul            _mm256_mul_ps
+#define vf_div            _mm256_div_ps
+#define vf_min            _mm256_min_ps
+#define vf_max            _mm256_max_ps
+#define vf_sqrt           _mm256_sqrt_ps
+#define vf_lt(a, b)       _mm256_cmp_ps(a, b, _CMP_LT_OQ)
+#define vf_le(a, b)       _mm256_cmp_ps(a, b, _CMP_LE_OQ)
+#define vf_gt(a, b)       _mm256_cmp_ps(a, b, _CMP_GT_OQ)
+#define vf_ge(a, b)       _mm256_cmp_ps(a, b, _CMP_GE_OQ)
+#define vf_eq(a, b)       _mm256_cmp_ps(a, b, _CMP_EQ_OQ)
+#define vf_sel(m, a, b)   _mm256_blendv_ps(b, a, m)
+#define vf_neg(a)         _mm256_xor_ps(a, _mm256_set1_ps(-0.0f))
+#define vf_abs(a)         _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a)
+#define vf_copysign(a, s) _mm256_or_ps(vf_abs(a), \
+                              _mm256_and_ps(_mm256_set1_ps(-0.0f), s))
+#define vm_and            _mm256_and_ps
+#define vm_or             _mm256_or_ps
+#define vm_andnot(a, b)   _mm256_andnot_ps(a, b)          /* ~a & b */
+#define vm_bits(m)        _mm256_movemask_ps(m)
+#define vm_any(m)         (_mm256_movemask_ps(m) != 0)
+#define vm_load(p)        _mm256_castsi256_ps(_mm256_load_si256((const __m256i *)(p)))
+#define vm_store(p, m)    _mm256_store_si256((__m256i *)(p), _mm256_castps_si256(m))
+#define vf_gather(p, ix)  _mm256_i32gather_ps(p, ix, 4)
+#define vi_gather(p, ix)  _mm256_i32gather_epi32((const int *)(p), ix, 4)
+#define vi_zero()         _mm256_setzero_si256()
+#define vi_load(p)        _mm256_load_si256((const __m256i *)(p))
+#define vi_store(p, a)    _mm256_store_si256((__m256i *)(p), a)
+#define vi_xor            _mm256_xor_si256
+#define vi_shl            _mm256_slli_epi32
+#define vi_shr            _mm256_srli_epi32
+#define vi_sel(m, a, b)   _mm256_castps_si256(vf_sel(m, _mm256_castsi256_ps(a), \
+                                                       _mm256_castsi256_ps(b)))
+#define vi_sign_mask(a)   _mm256_castsi256_ps(_mm256_srai_epi32(a, 31))
+#define vi_or_bit(a, m, bit) _mm256_or_si256(a, _mm256_and_si256( \
+                              _mm256_castps_si256(m), _mm256_set1_epi32(bit)))
+
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define BATCH_LANES 4
+typedef __m128  vf;
+typedef __m128  vm;
+typedef __m128i vi;
+#define vf_load(p)        _mm_load_ps(p)
+#define vf_loadu(p)       _mm_loadu_ps(p)
+#define vf_store(p, a)    _mm_store_ps(p, a)
+#define vf_set(c)         _mm_set1_ps(c)
+#define vf_add            _mm_add_ps
+#define vf_sub            _mm_sub_ps
+#define vf_mul            _mm_mul_ps
+#define vf_div            _mm_div_ps
+#define vf_min            _mm_min_ps
+#define vf_max            _mm_max_ps
+#define vf_sqrt           _mm_sqrt_ps
+#define vf_lt             _mm_cmplt_ps
+#define vf_le             _mm_cmple_ps
+#define vf_gt             _mm_cmpgt_ps
+#define vf_ge             _mm_cmpge_ps
+#define vf_eq             _mm_cmpeq_ps
+#define vf_sel(m, a, b)   _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b))
+#define vf_neg(a)         _mm_xor_ps(a, _mm_set1_ps(-0.0f))
+#define vf_abs(a)         _mm_andnot_ps(_mm_set1_ps(-0.0f), a)
+#define vf_copysign(a, s) _mm_or_ps(vf_abs(a), _mm_and_ps(_mm_set1_ps(-0.0f), s))
+#define vm_and            _mm_and_ps
+#define vm_or             _mm_or_ps
+#define vm_andnot(a, b)   _mm_andnot_ps(a, b)             /* ~a & b */
+#define vm_bits(m)        _mm_movemask_ps(m)
+#define vm_any(m)         (_mm_movemask_ps(m) != 0)
+#define vm_load(p)        _mm_castsi128_ps(_mm_load_si128((const __m128i *)(p)))
+#define vm_store(p, m)    _mm_store_si128((__m128i *)(p), _mm_castps_si128(m))
+#define vf_gather(p, ix)  _mm_set_ps((p)[(ix)[3]], (p)[(ix)[2]], (p)[(ix)[1]], (p)[(ix)[0]])
+#define vi_gather(p, ix)  _mm_set_epi32((int)(p)[(ix)[3]], (int)(p)[(ix)[2]], \
+                                        (int)(p)[(ix)[1]], (int)(p)[(ix)[0]])
+#define vi_zero()         _mm_setzero_si128()
+#define vi_load(p)        _mm_load_si128((const __m128i *)(p))
+#define vi_store(p, a)    _mm_store_si128((__m128i *)(p), a)
+#define vi_xor            _mm_xor_si128
+#define vi_shl            _mm_slli_epi32
+#define vi_shr            _mm_srli_epi32
+#define vi_sel(m, a, b)   _mm_castps_si128(vf_sel(m, _mm_castsi128_ps(a), \
+                                                    _mm_castsi128_ps(b)))
+#define vi_sign_mask(a)   _mm_castsi128_ps(_mm_srai_epi32(a, 31))
+#define vi_or_bit(a, m, bit) _mm_or_si128(a, _mm_and_si128( \
+                              _mm_castps_si128(m), _mm_set1_epi32(bit)))
+
+#else
+/* Skalarer Fallback: eine Lane, Masken als int (0/1) */
+#define BATCH_LANES 1
+typedef float    vf;
+typedef int      vm;
+typedef uint32_t vi;
+#define vf_load(p)        (*(p))
+#define vf_loadu(p)       (*(p))
+#define vf_store(p, a)    (*(p) = (a))
+#define vf_set(c)         ((float)(c))
+#define vf_add(a, b)      ((a) + (b))
+#define vf_sub(a, b)      ((a) - (b))
+#define vf_mul(a, b)      ((a) * (b))
+#define vf_div(a, b)      ((a) / (b))
+#define vf_min            fminf
+#define vf_max            fmaxf
+#define vf_sqrt           sqrtf
+#define vf_lt(a, b)       ((a) <  (b))
+#define vf_le(a, b)       ((a) <= (b))
+#define vf_gt(a, b)       ((a) >  (b))
+#define vf_ge(a, b)       ((a) >= (b))
+#define vf_eq(a, b)       ((a) == (b))
+#define vf_sel(m, a, b)   ((m) ? (a) : (b))
+#define vf_neg(a)         (-(a))
+#define vf_abs            fabsf
+#define vf_copysign       copysignf
+#define vm_and(a, b)      ((a) & (b))
+#define vm_or(a, b)       ((a) | (b))
+#define vm_andnot(a, b)   ((!(a)) & (b))
+#define vm_bits(m)        ((m) != 0)
+#define vm_any(m)         ((m) != 0)
+#define vm_load(p)        (*(p) != 0)
+#define vm_store(p, m)    (*(p) = (m) ? 0xFFFFFFFFu : 0u)
+#define vf_gather(p, ix)  ((p)[*(ix)])
+#define vi_gather(p, ix)  ((p)[*(ix)])
+#define vi_zero()         0u
+#define vi_load(p)        (*(p))
+#define vi_store(p, a)    (*(p) = (a))
+#define vi_xor(a, b)      ((a) ^ (b))
+#define vi_shl(a, n)      ((a) << (n))
+#define vi_shr(a, n)      ((a) >> (n))
+#define vi_sel(m, a, b)   ((m) ? (a) : (b))
+#define vi_sign_mask(a)   (((a) >> 31) != 0)
+#define vi_or_bit(a, m, bit) ((a) | ((m) ? (uint32_t)(bit) : 0u))
+#endif
+
+/* Ausrichtung der Arrays: passt für alle Vektorbreiten */
+#define BATCH_ALIGN 32
+
+/* Kontaktarten als Float-Codes (Reihenfolge = Priorität wie in physics.c) */
+#define K_NONE   0.0f
+#define K_WALL   1.0f
+#define K_BOT    2.0f
+#define K_PLAYER 3.0f
+#define K_SCORE  4.0f
+#define K_OUT    5.0f
+
+int batch_lanes(void) { return BATCH_LANES; }
+
+/* ------------------------------------------------------------------
+ * xorshift32
+ * Ein Schritt des Zufallsgenerators einer einzelnen Lane.
+ *
+ * Parameter:
+ *   r – Zustand (ungleich 0)
+ *
+ * Rückgabe:
+ *   neuer Zustand
+ * ------------------------------------------------------------------ */
+static uint32_t xorshift32(uint32_t r)
+{
+    r ^= r << 13;
+    r ^= r >> 17;
+    r ^= r << 5;
+    return r;
+}
+
+/* ------------------------------------------------------------------
+ * v_xorshift
+ * Ein Schritt xorshift32 in jeder Lane.
+ *
+ * Parameter:
+ *   r – Zustand je Lane
+ *
+ * Rückgabe:
+ *   neuer Zustand
+ * ------------------------------------------------------------------ */
+static inline vi v_xorshift(vi r)
+{
+    r = vi_xor(r, vi_shl(r, 13));
+    r = vi_xor(r, vi_shr(r, 17));
+    r = vi_xor(r, vi_shl(r, 5));
+    return r;
+}
+
+/* ------------------------------------------------------------------
+ * v_update_paddle
+ * Vektor-Version von update_paddle: Beschleunigung bzw. Dämpfung,
+ * Deckel, Position und Randbehandlung, alles über Masken.
+ *
+ * Parameter:
+ *   x, vx  – Position/Geschwindigkeit (in-place)
+ *   dir    – Richtung je Lane (-1, 0, +1)
+ *   accel  – Beschleunigung je Lane
+ *   v_max  – Maximalgeschwindigkeit
+ *   max_x  – rechte Grenze (Feldbreite - Paddlebreite - 1)
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static inline void v_update_paddle(vf *x, vf *vx, vf dir, vf accel,
+                                   vf v_max, vf max_x)
+{
+    const vf zero = vf_set(0.0f);
+
+    /* Schritt 1: Beschleunigung oder Dämpfung */
+    vf v_acc  = vf_add(*vx, vf_mul(accel, dir));
+    const physics_rate_t *r = physics_rate();
+    vf v_damp = vf_mul(*vx, vf_set(r->damping));
+    v_damp    = vf_sel(vf_lt(vf_abs(v_damp), vf_set(r->stop_eps)), zero, v_damp);
+    vm active = vm_or(vf_lt(dir, zero), vf_gt(dir, zero));
+    vf v      = vf_sel(active, v_acc, v_damp);
+
+    /* Schritt 2: Deckel */
+    v = vf_min(v, v_max);
+    v = vf_max(v, vf_neg(v_max));
+
+    /* Schritt 3 + 4: Position und Grenzen */
+    vf nx = vf_add(*x, v);
+    vm left = vf_lt(nx, zero);
+    nx = vf_sel(left, zero, nx);
+    v  = vf_sel(left, zero, v);
+
+    vm snap = vm_and(vf_gt(dir, zero), vf_ge(nx, vf_sub(max_x, vf_set(1.0f))));
+    vm over = vm_or(snap, vf_gt(nx, max_x));
+    *x  = vf_sel(over, max_x, nx);
+    *vx = vf_sel(over, zero, v);
+}
+
+/* ------------------------------------------------------------------
+ * v_chase_dir
+ * Richtung, mit der ein Paddle dem Ball folgt (wie ai_update).
+ *
+ * Parameter:
+ *   ball_x – Ball-x je Lane
+ *   pad_x  – Paddle-x je Lane
+ *   half   – halbe Paddlebreite
+ *
+ * Rückgabe:
+ *   -1, 0 oder +1 je Lane
+ * ------------------------------------------------------------------ */
+static inline vf v_chase_dir(vf ball_x, vf pad_x, vf half)
+{
+    vf mid = vf_add(pad_x, half);
+    vf dir = vf_sel(vf_gt(ball_x, mid), vf_set(1.0f), vf_set(-1.0f));
+    return vf_sel(vf_gt(vf_abs(vf_sub(ball_x, mid)), vf_set(0.5f)), dir, vf_set(0.0f));
+}
+
+/* ------------------------------------------------------------------
+ * v_slab
+ * Slab-Schnitt wie slab_entry in physics.c; bei v == 0 ergibt sich
+ * (-inf, inf) innerhalb bzw. ein leeres Intervall außerhalb.
+ *
+ * Parameter:
+ *   p0, v  – Startposition und Geschwindigkeit
+ *   lo, hi – Intervallgrenzen
+ *   t0, t1 – Ausgabe: Zeitintervall
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static inline void v_slab(vf p0, vf v, vf lo, vf hi, vf *t0, vf *t1)
+{
+    const vf inf  = vf_set(INFINITY);
+    const vf ninf = vf_set(-INFINITY);
+    vm still  = vf_eq(v, vf_set(0.0f));
+    vf vs     = vf_sel(still, vf_set(1.0f), v);     /* keine Division durch 0 */
+    vf a      = vf_div(vf_sub(lo, p0), vs);
+    vf b      = vf_div(vf_sub(hi, p0), vs);
+    vm inside = vm_and(vf_ge(p0, lo), vf_le(p0, hi));
+
+    *t0 = vf_sel(still, vf_sel(inside, ninf, inf), vf_min(a, b));
+    *t1 = vf_sel(still, vf_sel(inside, inf, ninf), vf_max(a, b));
+}
+
+/* ------------------------------------------------------------------
+ * v_paddle_toi
+ * Vektor-Version von paddle_toi. vy darf hier nicht 0 sein (Lanes
+ * ohne vertikale Bewegung verwirft der Aufrufer).
+ *
+ * Parameter:
+ *   x, y, vx, vy – Ball je Lane
+ *   px, width    – Paddle-x je Lane, Paddlebreite
+ *   y_lo, y_hi   – Trefferband je Lane
+ *   t_max        – verbleibende Zeit je Lane
+ *
+ * Rückgabe:
+ *   Kontaktzeit oder INFINITY je Lane
+ * ------------------------------------------------------------------ */
+static inline vf v_paddle_toi(vf x, vf y, vf vx, vf vy, vf px, vf width,
+                              vf y_lo, vf y_hi, vf t_max)
+{
+    vf tx0, tx1;
+    v_slab(x, vx, px, vf_add(px, width), &tx0, &tx1);
+
+    vf a   = vf_div(vf_sub(y_lo, y), vy);
+    vf b   = vf_div(vf_sub(y_hi, y), vy);
+    vf ty0 = vf_min(a, b);
+    vf ty1 = vf_max(a, b);
+
+    vf t_in  = vf_max(vf_max(tx0, ty0), vf_set(0.0f));
+    vf t_out = vf_min(tx1, ty1);
+    vm ok    = vm_and(vf_le(t_in, t_out), vf_le(t_in, t_max));
+    return vf_sel(ok, t_in, vf_set(INFINITY));
+}
+
+/* ------------------------------------------------------------------
+ * v_reflect
+ * Vektor-Version von reflect_paddle (Offset, Spin, Bounce, Edge‑Drop,
+ * Geschwindigkeitsgrenzen, Mindest-Steigung).
+ *
+ * Parameter:
+ *   bx      – Ball-x je Lane
+ *   vx, vy  – Ballgeschwindigkeit (in-place)
+ *   px, pvx – Position/Geschwindigkeit des getroffenen Paddles
+ *   half    – halbe Paddlebreite
+ *   hits    – Paddle-Hits seit Reset (bereits erhöht)
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static inline void v_reflect(vf bx, vf *vx, vf *vy, vf px, vf pvx,
+                             vf half, vf hits)
+{
+    const physics_rate_t *r = physics_rate();
+    const vf one  = vf_set(1.0f);
+    const vf vmax = vf_set(r->ball_max_speed);
+
+    vf speed = vf_sqrt(vf_add(vf_mul(*vx, *vx), vf_mul(*vy, *vy)));
+
+    vf offset = vf_div(vf_sub(bx, vf_add(px, half)), half);
+    offset = vf_max(offset, vf_set(-1.0f));
+    offset = vf_min(offset, one);
+    vf abs_off = vf_abs(offset);
+
+    vf nvx = vf_mul(speed, offset);
+    vf nvy = vf_neg(vf_copysign(
+                 vf_mul(speed, vf_sqrt(vf_sub(one, vf_mul(abs_off, abs_off)))), *vy));
+
+    nvx = vf_add(nvx, vf_mul(pvx, vf_set(0.30f)));
+
+    vf bounce = vf_add(vf_set(BALL_BOUNCE_MULTIPLIER), vf_mul(hits, vf_set(BALL_BOUNCE_INC)));
+    nvx = vf_mul(nvx, bounce);
+    nvy = vf_mul(nvy, bounce);
+
+    vf edge_drop = vf_sub(one, vf_mul(vf_set(BALL_EDGE_SLOWDOWN), abs_off));
+    nvx = vf_mul(nvx, edge_drop);
+    nvy = vf_mul(nvy, edge_drop);
+
+    /* Grenzen */
+    vf mag = vf_sqrt(vf_add(vf_mul(nvx, nvx), vf_mul(nvy, nvy)));
+
+    vm fast = vf_gt(mag, vmax);
+    vf s    = vf_div(vmax, mag);
+    nvx = vf_sel(fast, vf_mul(nvx, s), nvx);
+    nvy = vf_sel(fast, vf_mul(nvy, s), nvy);
+    mag = vf_sel(fast, vmax, mag);
+
+    vf dyn_min = vf_mul(vf_set(r->ball_min_speed),
+                        vf_add(one, vf_mul(hits, vf_set(BALL_MIN_SPEED_INC))));
+    dyn_min = vf_min(dyn_min, vmax);
+    vm slow = vf_lt(mag, dyn_min);
+    s   = vf_div(dyn_min, mag);
+    nvx = vf_sel(slow, vf_mul(nvx, s), nvx);
+    nvy = vf_sel(slow, vf_mul(nvy, s), nvy);
+    mag = vf_sel(slow, dyn_min, mag);
+
+    /* Mindest-Steigung */
+    vf vy_t = vf_mul(mag, vf_set(BALL_MIN_VY_FRAC));
+    vm flat = vf_lt(vf_abs(nvy), vy_t);
+    vf vx_t = vf_sqrt(vf_max(vf_sub(vf_mul(mag, mag), vf_mul(vy_t, vy_t)), vf_set(0.0f)));
+    *vy = vf_sel(flat, vf_mul(vf_copysign(one, nvy), vy_t), nvy);
+    *vx = vf_sel(flat, vf_copysign(vx_t, nvx), nvx);
+}
+
+/* Gather-Puffer: ein Block "busy" Spiele für die Kontaktschleife */
+typedef union { vf v; float    f[BATCH_LANES]; } lane_f;
+typedef union { vi v; uint32_t u[BATCH_LANES]; } lane_u;
+
+typedef struct
+{
+    lane_f x, y, vx, vy;
+    lane_f plx, plv, btx, btv;
+    lane_f score, hits;
+    lane_u alive, rng, events;
+} ball_block_t;
+
+/* Abstand, den der Ball im Schnellpfad zu Wänden und Trefferbändern hält */
+#define BATCH_SAFE_MARGIN 0.5f
+
+/* ------------------------------------------------------------------
+ * step_paddles
+ * Erster Durchlauf für BATCH_LANES Spiele ab Index i: bewegt Spieler
+ * und Bot und – für Bälle, die diesen Tick sicher nichts berühren –
+ * auch den Ball (x += vx, y += vy, bitgleich zum Löser). Alle anderen
+ * laufenden Spiele landen in der Arbeitsliste.
+ *
+ * Parameter:
+ *   b      – Batch
+ *   i      – erster Spielindex (Vielfaches von BATCH_LANES)
+ *   dir_p  – Spielerrichtungen dieses Blocks oder NULL (KI)
+ *   n_busy – Füllstand der Arbeitsliste b->work (in-place)
+ *
+ * Rückgabe:
+ *   Anzahl laufender Spiele im Block (vor dem Ball-Update)
+ * ------------------------------------------------------------------ */
+static inline int step_paddles(batch_t *b, int i, const float *dir_p, int *n_busy)
+{
+    vm alive = vm_load(b->alive + i);
+    vi_store(b->events + i, vi_zero());
+    if (!vm_any(alive))
+        return 0;
+
+    const vf half  = vf_set(b->paddle_width / 2.0f);
+    const vf max_x = vf_set((float)b->field_width - b->paddle_width - 1.0f);
+
+    vf x   = vf_load(b->ball_x + i),   y   = vf_load(b->ball_y + i);
+    vf vx  = vf_load(b->ball_vx + i),  vy  = vf_load(b->ball_vy + i);
+    vf plx = vf_load(b->player_x + i), plv = vf_load(b->player_vx + i);
+    vf btx = vf_load(b->bot_x + i),    btv = vf_load(b->bot_vx + i);
+
+    /* --- Paddles (Spieler vor Bot, wie in der Spielschleife) ----- */
+    vf dir = dir_p ? vf_loadu(dir_p) : v_chase_dir(x, plx, half);
+    const physics_rate_t *r = physics_rate();
+    vf nx = plx, nv = plv;
+    v_update_paddle(&nx, &nv, dir, vf_set(r->player_accel),
+                    vf_set(r->player_max_speed), max_x);
+    vf_store(b->player_x + i,  vf_sel(alive, nx, plx));
+    vf_store(b->player_vx + i, vf_sel(alive, nv, plv));
+
+    vf accel = vf_add(vf_set(r->bot_accel),
+                      vf_mul(vf_set(r->bot_accel_per_point), vf_load(b->score + i)));
+    nx = btx; nv = btv;
+    v_update_paddle(&nx, &nv, v_chase_dir(x, btx, half), accel,
+                    vf_set(r->bot_max_speed), max_x);
+    vf_store(b->bot_x + i,  vf_sel(alive, nx, btx));
+    vf_store(b->bot_vx + i, vf_sel(alive, nv, btv));
+
+    /* --- Schnellpfad: Start und Ziel im sicheren Innenbereich ---- */
+    const vf x_lo = vf_set(BATCH_SAFE_MARGIN);
+    const vf x_hi = vf_set((float)(b->field_width - 1) - BATCH_SAFE_MARGIN);
+    const vf y_lo = vf_set((float)b->bot_y + 1.0f + BATCH_SAFE_MARGIN);
+    const vf y_hi = vf_set((float)b->player_y - 1.0f - BATCH_SAFE_MARGIN);
+
+    vf x_end = vf_add(x, vx);
+    vf y_end = vf_add(y, vy);
+    vm safe  = vm_and(vm_and(vf_gt(x, x_lo), vf_lt(x, x_hi)),
+                      vm_and(vf_gt(x_end, x_lo), vf_lt(x_end, x_hi)));
+    safe     = vm_and(safe, vm_and(vm_and(vf_gt(y, y_lo), vf_lt(y, y_hi)),
+                                   vm_and(vf_gt(y_end, y_lo), vf_lt(y_end, y_hi))));
+    safe     = vm_and(safe, alive);
+
+    vf_store(b->ball_x + i, vf_sel(safe, x_end, x));
+    vf_store(b->ball_y + i, vf_sel(safe, y_end, y));
+
+    /* --- Rest in die Arbeitsliste ------------------------------- */
+    int bits = vm_bits(vm_andnot(safe, alive));
+    for (int l = 0; bits; ++l, bits >>= 1)
+        if (bits & 1)
+            b->work[(*n_busy)++] = i + l;
+
+    int running = 0;
+    for (bits = vm_bits(alive); bits; bits &= bits - 1)
+        running++;
+    return running;
+}
+
+/* ------------------------------------------------------------------
+ * ball_contacts
+ * Vollständiger analytischer Löser für einen Gather-Block: Kontakt
+ * für Kontakt, bis in keiner Lane mehr einer im Tick liegt.
+ *
+ * Parameter:
+ *   b – Batch (Feldgeometrie)
+ *   k – Block (in-place)
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static inline void ball_contacts(const batch_t *b, ball_block_t *k)
+{
+    const vf zero   = vf_set(0.0f);
+    const vf one    = vf_set(1.0f);
+    const vf inf    = vf_set(INFINITY);
+    const vf width  = vf_set((float)b->paddle_width);
+    const vf half   = vf_set(b->paddle_width / 2.0f);
+    const vf right  = vf_set((float)(b->field_width - 1));
+    const vf height = vf_set((float)b->field_height);
+    const vf bot_lo = vf_set((float)b->bot_y);
+    const vf bot_hi = vf_set((float)b->bot_y + 1.0f);
+    const vf pl_lo  = vf_set((float)b->player_y - 1.0f);
+    const vf pl_hi  = vf_set((float)b->player_y);
+
+    vf x  = k->x.v,  y  = k->y.v,  vx = k->vx.v, vy = k->vy.v;
+    vf plx = k->plx.v, plv = k->plv.v, btx = k->btx.v, btv = k->btv.v;
+    vf score = k->score.v, hits = k->hits.v;
+    vm alive = vm_load(k->alive.u);
+    vi ev    = vi_zero();
+
+    vf t_rem = one;
+    vm run   = alive;
+
+    for (int n = 0; n < PHYS_MAX_CONTACTS && vm_any(run); ++n)
+    {
+        vm left  = vf_lt(vx, zero), rightw = vf_gt(vx, zero);
+        vm up    = vf_lt(vy, zero), down   = vf_gt(vy, zero);
+        vf vx_s  = vf_sel(vm_or(left, rightw), vx, one);
+        vf vy_s  = vf_sel(vm_or(up, down), vy, one);
+
+        /* Seitenwände: eine Division, Zähler je nach Richtung */
+        vf t_hit = vf_max(vf_div(vf_sel(left, vf_neg(x), vf_sub(right, x)), vx_s), zero);
+        vm m     = vm_and(vm_or(left, rightw), vf_le(t_hit, t_rem));
+        t_hit    = vf_sel(m, t_hit, inf);
+        vf kind  = vf_sel(m, vf_set(K_WALL), vf_set(K_NONE));
+
+        /* Paddle in Flugrichtung: Bot auf dem Weg nach oben, sonst Spieler */
+        vf t = v_paddle_toi(x, y, vx, vy_s, vf_sel(up, btx, plx), width,
+                            vf_sel(up, bot_lo, pl_lo), vf_sel(up, bot_hi, pl_hi), t_rem);
+        m     = vm_and(vm_or(up, down), vf_lt(t, t_hit));
+        t_hit = vf_sel(m, t, t_hit);
+        kind  = vf_sel(m, vf_sel(up, vf_set(K_BOT), vf_set(K_PLAYER)), kind);
+
+        /* Torlinie oben bzw. Aus unten */
+        vf y_end = vf_add(y, vf_mul(vy, t_rem));
+        t     = vf_max(vf_div(vf_sel(up, vf_neg(y), vf_sub(height, y)), vy_s), zero);
+        m     = vm_or(vm_and(up, vf_lt(y_end, zero)), vm_and(down, vf_gt(y_end, height)));
+        m     = vm_and(m, vf_lt(t, t_hit));
+        t_hit = vf_sel(m, t, t_hit);
+        kind  = vf_sel(m, vf_sel(up, vf_set(K_SCORE), vf_set(K_OUT)), kind);
+
+        /* Lanes ohne Kontakt laufen bis zum Tick-Ende und sind fertig */
+        vm has  = vm_andnot(vf_eq(kind, vf_set(K_NONE)), run);
+        vf t_go = vf_sel(has, t_hit, t_rem);
+        x     = vf_sel(run, vf_add(x, vf_mul(vx, t_go)), x);
+        y     = vf_sel(run, vf_add(y, vf_mul(vy, t_go)), y);
+        t_rem = vf_sel(run, vf_sub(t_rem, t_go), t_rem);
+        run   = has;
+        if (!vm_any(has))
+            break;
+
+        /* Wand */
+        m  = vm_and(has, vf_eq(kind, vf_set(K_WALL)));
+        vx = vf_sel(m, vf_neg(vx), vx);
+        x  = vf_sel(m, vf_min(vf_max(x, zero), right), x);
+
+        /* Paddles */
+        vm m_bot = vm_and(has, vf_eq(kind, vf_set(K_BOT)));
+        vm m_pl  = vm_and(has, vf_eq(kind, vf_set(K_PLAYER)));
+        m = vm_or(m_bot, m_pl);
+        if (vm_any(m)) {
+            hits = vf_sel(m, vf_add(hits, one), hits);
+            vf nvx = vx, nvy = vy;
+            v_reflect(x, &nvx, &nvy, vf_sel(m_bot, btx, plx),
+                      vf_sel(m_bot, btv, plv), half, hits);
+            vx = vf_sel(m, nvx, vx);
+            vy = vf_sel(m, nvy, vy);
+            ev = vi_or_bit(ev, m_bot, PHYS_EVENT_HIT_BOT);
+            ev = vi_or_bit(ev, m_pl,  PHYS_EVENT_HIT_PLAYER);
+        }
+
+        /* Punkt: Score erhöhen, Ball zurücksetzen, Tick fertig */
+        m = vm_and(has, vf_eq(kind, vf_set(K_SCORE)));
+        if (vm_any(m)) {
+            score = vf_sel(m, vf_add(score, one), score);
+
+            const physics_rate_t *rate = physics_rate();
+            vf base = vf_mul(vf_set(rate->ball_initial_speed),
+                             vf_add(one, vf_mul(score, vf_set(SPEED_PER_POINT))));
+            base = vf_min(base, vf_set(rate->ball_max_speed));
+
+            vi r_old = k->rng.v;
+            vi r     = vi_sel(m, v_xorshift(r_old), r_old);
+            k->rng.v = r;
+
+            x    = vf_sel(m, vf_set(b->field_width / 2.0f), x);
+            y    = vf_sel(m, vf_set((float)(b->bot_y + 1)), y);
+            vx   = vf_sel(m, vf_sel(vi_sign_mask(r), base, vf_neg(base)), vx);
+            vy   = vf_sel(m, base, vy);
+            hits = vf_sel(m, zero, hits);
+            ev   = vi_or_bit(ev, m, PHYS_EVENT_SCORED);
+            run  = vm_andnot(m, run);
+        }
+
+        /* Aus: Spiel beendet, Lane wird eingefroren */
+        m = vm_and(has, vf_eq(kind, vf_set(K_OUT)));
+        ev    = vi_or_bit(ev, m, PHYS_EVENT_GAME_OVER);
+        alive = vm_andnot(m, alive);
+        run   = vm_andnot(m, run);
+    }
+
+    /* Sicherheitsnetz erreicht: Rest des Ticks ohne Kontakt */
+    x = vf_sel(run, vf_add(x, vf_mul(vx, t_rem)), x);
+    y = vf_sel(run, vf_add(y, vf_mul(vy, t_rem)), y);
+
+    k->x.v = x;  k->y.v = y;  k->vx.v = vx;  k->vy.v = vy;
+    k->score.v = score;
+    k->hits.v  = hits;
+    vm_store(k->alive.u, alive);
+    k->events.v = ev;
+}
+
+/* ------------------------------------------------------------------
+ * batch_step
+ * Rückt alle Spiele des Batches um einen Tick vor: erst Paddles und
+ * Schnellpfad blockweise, dann die Kontaktschleife für die übrigen
+ * Spiele, dicht gepackt (Gather → Kernel → Scatter).
+ *
+ * Parameter:
+ *   b          – Batch
+ *   player_dir – Spielerrichtung je Lane (active Einträge) oder NULL
+ *
+ * Rückgabe:
+ *   Anzahl noch laufender Spiele
+ * ------------------------------------------------------------------ */
+int batch_step(batch_t *b, const float *player_dir)
+{
+    int full    = b->active - b->active % BATCH_LANES;
+    int n_busy  = 0;
+    int running = 0;
+
+    for (int i = 0; i < full; i += BATCH_LANES)
+        running += step_paddles(b, i, player_dir ? player_dir + i : NULL, &n_busy);
+
+    /* Restblock: Richtungen in einen aufgefüllten Puffer kopieren */
+    if (full < b->active) {
+        float tail[BATCH_LANES] = {0};
+        if (player_dir)
+            memcpy(tail, player_dir + full, sizeof(float) * (size_t)(b->active - full));
+        running += step_paddles(b, full, player_dir ? tail : NULL, &n_busy);
+    }
+
+    /* Arbeitsliste auf volle Blöcke auffüllen (Duplikate werden
+       mitgerechnet, aber nicht zurückgeschrieben) */
+    for (int l = 0; n_busy > 0 && l < BATCH_LANES; ++l)
+        b->work[n_busy + l] = b->work[n_busy - 1];
+
+    for (int w = 0; w < n_busy; w += BATCH_LANES) {
+        const int *ix = b->work + w;
+        int n = (n_busy - w < BATCH_LANES) ? n_busy - w : BATCH_LANES;
+        ball_block_t k;
+#if defined(__AVX2__)
+        vi idx = _mm256_loadu_si256((const __m256i *)ix);
+#else
+        const int *idx = ix;
+#endif
+        k.x.v   = vf_gather(b->ball_x, idx);    k.y.v   = vf_gather(b->ball_y, idx);
+        k.vx.v  = vf_gather(b->ball_vx, idx);   k.vy.v  = vf_gather(b->ball_vy, idx);
+        k.plx.v = vf_gather(b->player_x, idx);  k.plv.v = vf_gather(b->player_vx, idx);
+        k.btx.v = vf_gather(b->bot_x, idx);     k.btv.v = vf_gather(b->bot_vx, idx);
+        k.score.v = vf_gather(b->score, idx);   k.hits.v = vf_gather(b->paddle_hits, idx);
+        k.alive.v = vi_gather(b->alive, idx);   k.rng.v  = vi_gather(b->rng, idx);
+
+        ball_contacts(b, &k);
+
+        for (int l = 0; l < n; ++l) {
+            int g = ix[l];
+            b->ball_x[g]  = k.x.f[l];     b->ball_y[g]  = k.y.f[l];
+            b->ball_vx[g] = k.vx.f[l];    b->ball_vy[g] = k.vy.f[l];
+            b->score[g]   = k.score.f[l]; b->paddle_hits[g] = k.hits.f[l];
+            b->alive[g]   = k.alive.u[l]; b->rng[g]    = k.rng.u[l];
+            b->events[g]  = k.events.u[l];
+            running -= (k.events.u[l] & PHYS_EVENT_GAME_OVER) != 0;
+        }
+    }
+    return running;
+}
+
+
+/* ------------------------------------------------------------------
+ * swap_lanes
+ * Vertauscht den kompletten Zustand zweier Lanes.
+ *
+ * Parameter:
+ *   b    – Batch
+ *   i, j – Lanes
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void swap_lanes(batch_t *b, int i, int j)
+{
+    float *f[] = { b->ball_x, b->ball_y, b->ball_vx, b->ball_vy,
+                   b->player_x, b->player_vx, b->bot_x, b->bot_vx,
+                   b->score, b->paddle_hits };
+    for (size_t k = 0; k < sizeof f / sizeof f[0]; ++k) {
+        float t = f[k][i]; f[k][i] = f[k][j]; f[k][j] = t;
+    }
+    uint32_t *u[] = { b->alive, b->rng, b->events };
+    for (size_t k = 0; k < sizeof u / sizeof u[0]; ++k) {
+        uint32_t t = u[k][i]; u[k][i] = u[k][j]; u[k][j] = t;
+    }
+    int t = b->id[i]; b->id[i] = b->id[j]; b->id[j] = t;
+}
+
+/* ------------------------------------------------------------------
+ * batch_compact
+ * Sortiert laufende Spiele nach vorne (Reihenfolge der beendeten
+ * Spiele ist danach beliebig) und setzt active auf ihre Anzahl.
+ *
+ * Parameter:
+ *   b – Batch
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void batch_compact(batch_t *b)
+{
+    int i = 0, j = b->active - 1;
+    while (i <= j) {
+        if (b->alive[i])       i++;
+        else if (!b->alive[j]) j--;
+        else                   swap_lanes(b, i++, j--);
+    }
+    b->active = i;
+}
+
+/* ------------------------------------------------------------------
+ * lane_alloc
+ * Legt ein ausgerichtetes, genulltes Array für capacity Lanes an.
+ *
+ * Parameter:
+ *   capacity – Anzahl Einträge (je 4 Byte)
+ *
+ * Rückgabe:
+ *   Zeiger oder NULL
+ * ------------------------------------------------------------------ */
+static void *lane_alloc(int capacity)
+{
+    void *p = NULL;
+    size_t bytes = sizeof(float) * (size_t)capacity;
+    if (posix_memalign(&p, BATCH_ALIGN, bytes) != 0)
+        return NULL;
+    memset(p, 0, bytes);
+    return p;
+}
+
+/* ------------------------------------------------------------------
+ * batch_create
+ * Legt count Spiele im Anfangszustand von physics_create_game an;
+ * die Startrichtung des Balls kommt aus dem Zufall der jeweiligen
+ * Lane.
+ *
+ * Parameter:
+ *   count  – Anzahl Spiele (>= 1)
+ *   width  – Spielfeldbreite
+ *   height – Spielfeldhöhe
+ *   seed   – Startwert für die Zufallsfolgen
+ *
+ * Rückgabe:
+ *   Batch oder NULL
+ * ------------------------------------------------------------------ */
+batch_t *batch_create(int count, int width, int height, uint32_t seed)
+{
+    if (count < 1)
+        return NULL;
+
+    batch_t *b = calloc(1, sizeof *b);
+    if (!b)
+        return NULL;
+
+    game_state_t g = physics_create_game(width, height);
+    b->count        = count;
+    b->capacity     = (count + BATCH_LANES - 1) / BATCH_LANES * BATCH_LANES;
+    b->active       = count;
+    b->field_width  = g.field_width;
+    b->field_height = g.field_height;
+    b->paddle_width = g.player.width;
+    b->player_y     = g.player.y;
+    b->bot_y        = g.bot.y;
+
+    float **farr[] = { &b->ball_x, &b->ball_y, &b->ball_vx, &b->ball_vy,
+                       &b->player_x, &b->player_vx, &b->bot_x, &b->bot_vx,
+                       &b->score, &b->paddle_hits };
+    for (size_t k = 0; k < sizeof farr / sizeof farr[0]; ++k)
+        if (!(*farr[k] = lane_alloc(b->capacity))) { batch_destroy(b); return NULL; }
+    if (!(b->alive  = lane_alloc(b->capacity)) ||
+        !(b->rng    = lane_alloc(b->capacity)) ||
+        !(b->events = lane_alloc(b->capacity)) ||
+        !(b->id     = lane_alloc(b->capacity)) ||
+        !(b->work   = lane_alloc(b->capacity + BATCH_LANES))) {
+        batch_destroy(b);
+        return NULL;
+    }
+
+    for (int i = 0; i < b->capacity; ++i) {
+        uint32_t r = seed ^ (uint32_t)(i + 1) * 0x9E3779B9u;
+        b->id[i] = i;
+        if (i < count)
+            batch_load(b, i, &g);
+        batch_seed(b, i, r);
+    }
+    return b;
+}
+
+/* ------------------------------------------------------------------
+ * batch_seed
+ * Setzt die Zufallsfolge einer Lane neu und lost daraus die
+ * Startrichtung des Balls; nur vor dem ersten batch_step sinnvoll.
+ * So hängt der Zufall eines Spiels allein von seinem Startwert ab,
+ * nicht von seiner Lane.
+ *
+ * Parameter:
+ *   b    – Batch
+ *   i    – Lane
+ *   seed – Startwert (0 wird ersetzt, Fixpunkt von xorshift)
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void batch_seed(batch_t *b, int i, uint32_t seed)
+{
+    b->rng[i] = seed ? seed : 0x6D2B79F5u;
+    if (i < b->count) {
+        b->rng[i] = xorshift32(b->rng[i]);
+        float v0 = physics_rate()->ball_initial_speed;
+        b->ball_vx[i] = (b->rng[i] >> 31) ? v0 : -v0;
+    }
+}
+
+/* ------------------------------------------------------------------
+ * batch_destroy
+ * Gibt alle Arrays und den Batch frei.
+ *
+ * Parameter:
+ *   b – Batch (darf NULL sein)
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void batch_destroy(batch_t *b)
+{
+    if (!b)
+        return;
+    free(b->ball_x);   free(b->ball_y);    free(b->ball_vx); free(b->ball_vy);
+    free(b->player_x); free(b->player_vx); free(b->bot_x);   free(b->bot_vx);
+    free(b->score);    free(b->paddle_hits);
+    free(b->alive);    free(b->rng);       free(b->events);
+    free(b->id);       free(b->work);
+    free(b);
+}
+
+/* ------------------------------------------------------------------
+ * batch_load
+ * Übernimmt Ball, Paddles und Zähler eines Spiels in Lane i.
+ *
+ * Parameter:
+ *   b – Batch
+ *   i – Spielindex
+ *   g – Quelle (gleiche Feldgröße wie der Batch)
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void batch_load(batch_t *b, int i, const game_state_t *g)
+{
+    b->ball_x[i]      = g->ball.x;
+    b->ball_y[i]      = g->ball.y;
+    b->ball_vx[i]     = g->ball.vx;
+    b->ball_vy[i]     = g->ball.vy;
+    b->player_x[i]    = g->player.x;
+    b->player_vx[i]   = g->player.vx;
+    b->bot_x[i]       = g->bot.x;
+    b->bot_vx[i]      = g->bot.vx;
+    b->score[i]       = (float)g->score;
+    b->paddle_hits[i] = (float)g->paddle_hits;
+    b->alive[i]       = 0xFFFFFFFFu;
+    b->events[i]      = 0;
+}
+
+/* ------------------------------------------------------------------
+ * batch_store
+ * Schreibt Lane i in einen vollständigen Spielzustand zurück.
+ *
+ * Parameter:
+ *   b – Batch
+ *   i – Spielindex
+ *   g – Ziel
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void batch_store(const batch_t *b, int i, game_state_t *g)
+{
+    g->field_width  = b->field_width;
+    g->field_height = b->field_height;
+
+    g->player.width = g->bot.width = b->paddle_width;
+    g->player.y     = b->player_y;
+    g->bot.y        = b->bot_y;
+    g->player.x     = b->player_x[i];
+    g->player.vx    = b->player_vx[i];
+    g->bot.x        = b->bot_x[i];
+    g->bot.vx       = b->bot_vx[i];
+    g->player.ax    = g->bot.ax = 0.0f;
+
+    g->ball.x  = b->ball_x[i];
+    g->ball.y  = b->ball_y[i];
+    g->ball.vx = b->ball_vx[i];
+    g->ball.vy = b->ball_vy[i];
+
+    g->score       = (int)b->score[i];
+    g->paddle_hits = (int)b->paddle_hits[i];
+}
@@ -0,0 +1,73 @@
+/* ------------------------------------------------------------------
+ * batch.h - Header des Batch-Simulators (viele Spiele gleichzeitig)
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "physics.h"
+
+/* ---------------------------------------------------------------
+ * N Spiele als Structure-of-Arrays. Alle Spiele teilen Feldgröße
+ * und Paddle-Breite; die Arrays sind auf die Vektorbreite
+ * ausgerichtet und aufgefüllt (Füll-Lanes sind nie "alive").
+ * Alle Arrays sind nach Lane indiziert; bis zum ersten
+ * batch_compact gilt Lane i = Spiel i, danach liefert id[i] das
+ * ursprüngliche Spiel.
+ * --------------------------------------------------------------- */
+typedef struct
+{
+    int    count;          /* Anzahl Spiele                          */
+    int    capacity;       /* count, aufgerundet auf BATCH_LANES     */
+    int    active;         /* nur Lanes [0, active) werden simuliert */
+    int    field_width;
+    int    field_height;
+    int    paddle_width;
+    int    player_y;
+    int    bot_y;
+
+    float *ball_x, *ball_y, *ball_vx, *ball_vy;
+    float *player_x, *player_vx;
+    float *bot_x, *bot_vx;
+    float *score;          /* als float, damit die Kernel rein SIMD bleiben */
+    float *paddle_hits;
+
+    uint32_t *alive;       /* 0xFFFFFFFF = läuft, 0 = Game Over      */
+    uint32_t *rng;         /* Zufallszustand je Spiel (xorshift32)   */
+    uint32_t *events;      /* physics_event_t-Bitmaske des letzten Ticks */
+
+    int      *id;          /* ursprünglicher Spielindex je Lane      */
+    int      *work;        /* intern: Lanes, die den vollen Löser brauchen */
+} batch_t;
+
+/* Vektorbreite, mit der batch_step arbeitet (8 = AVX2, 4 = SSE2, 1 = skalar) */
+int batch_lanes(void);
+
+/* NULL bei ungültigen Parametern oder fehlendem Speicher */
+batch_t *batch_create(int count, int width, int height, uint32_t seed);
+void     batch_destroy(batch_t *b);
+
+/* Zufall einer Lane neu setzen (vor dem ersten batch_step) */
+void batch_seed(batch_t *b, int i, uint32_t seed);
+
+/* Lane i aus einem bzw. in einen game_state_t kopieren (gleiche Feldgröße) */
+void batch_load(batch_t *b, int i, const game_state_t *g);
+void batch_store(const batch_t *b, int i, game_state_t *g);
+
+/* Beendete Spiele hinter die laufenden tauschen und active kürzen,
+   damit tote Lanes keine Vektorbreite mehr kosten */
+void batch_compact(batch_t *b);
+
+/* ---------------------------------------------------------------
+ * Ein Tick für alle Spiele: Spieler-Paddle, Bot-KI, Ball.
+ * player_dir: Richtung je Lane (-1/0/+1); NULL = Spieler folgt
+ * dem Ball wie der Bot (KI gegen KI).
+ * Rückgabe: Anzahl Spiele, die nach dem Tick noch laufen.
+ * --------------------------------------------------------------- */
+int batch_step(batch_t *b, const float *player_dir);
+
+#endif /* BATCH_H */
@@ -0,0 +1,156 @@
+/* ------------------------------------------------------------------
+ * cells.c - Komponiert einen Frame in einen Zellpuffer
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#include <math.h>
+#include <stdio.h>
+#include "cells.h"
+#include "config.h"
+
+/* ------------------------------------------------------------------
+ * put_cell
+ * Schreibt eine Zelle, sofern sie im Puffer liegt.
+ *
+ * Parameter:
+ *   buf, cols, rows – Zielpuffer und dessen Größe
+ *   y, x            – Position
+ *   glyph, attr     – Zellinhalt
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void put_cell(cell_t *buf, int cols, int rows,
+                     int y, int x, unsigned char glyph, unsigned char attr)
+{
+    if (y < 0 || y >= rows || x < 0 || x >= cols)
+        return;
+    buf[y * cols + x].glyph = glyph;
+    buf[y * cols + x].attr  = attr;
+}
+
+/* ------------------------------------------------------------------
+ * put_text
+ * Schreibt einen ASCII‑Text ab der angegebenen Position.
+ *
+ * Parameter:
+ *   buf, cols, rows – Zielpuffer und dessen Größe
+ *   y, x            – Startposition
+ *   txt             – nullterminierter Text
+ *   attr            – Attribut für alle Zeichen
+ *
+ * Rückgabe:
+ *   Spalte hinter dem letzten Zeichen
+ * ------------------------------------------------------------------ */
+static int put_text(cell_t *buf, int cols, int rows,
+                    int y, int x, const char *txt, unsigned char attr)
+{
+    for (; *txt; ++txt, ++x)
+        put_cell(buf, cols, rows, y, x, (unsigned char)*txt, attr);
+    return x;
+}
+
+/* ------------------------------------------------------------------
+ * cells_clear
+ * Füllt den Puffer mit Leerzeichen ohne Attribute.
+ *
+ * Parameter:
+ *   buf, cols, rows – Zielpuffer und dessen Größe
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void cells_clear(cell_t *buf, int cols, int rows)
+{
+    for (int i = 0; i < cols * rows; ++i) {
+        buf[i].glyph = ' ';
+        buf[i].attr  = 0;
+    }
+}
+
+/* ------------------------------------------------------------------
+ * cells_compose
+ * Zeichnet einen kompletten Frame (Rahmen, HUD, Paddles, Ball,
+ * Overlays) in den Zellpuffer. Layout und Farben entsprechen dem
+ * ncurses-Renderer.
+ *
+ * Parameter:
+ *   buf, cols, rows – Zielpuffer und dessen Größe
+ *   g               – Zeiger auf aktuellen Spielzustand
+ *   fx              – Positionen (pose) und UI‑Effekte (Flash,
+ *                     Countdown, Game Over)
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void cells_compose(cell_t *buf, int cols, int rows,
+                   const game_state_t *g, const render_fx_t *fx)
+{
+    cells_clear(buf, cols, rows);
+
+    /* 1.  Spielfeld-Rahmen ------------------------------------------ */
+    int top    = g->bot.y - 1;
+    int bottom = g->player.y + 1;
+    int right  = g->field_width - 1;
+
+    for (int x = 1; x < right; ++x) {
+        put_cell(buf, cols, rows, top,    x, GLYPH_HLINE, CELL_DIM);
+        put_cell(buf, cols, rows, bottom, x, GLYPH_HLINE, CELL_DIM);
+    }
+    for (int y = top + 1; y < bottom; ++y) {
+        put_cell(buf, cols, rows, y, 0,     GLYPH_VLINE, CELL_DIM);
+        put_cell(buf, cols, rows, y, right, GLYPH_VLINE, CELL_DIM);
+    }
+    put_cell(buf, cols, rows, top,    0,     GLYPH_ULCORNER, CELL_DIM);
+    put_cell(buf, cols, rows, top,    right, GLYPH_URCORNER, CELL_DIM);
+    put_cell(buf, cols, rows, bottom, 0,     GLYPH_LLCORNER, CELL_DIM);
+    put_cell(buf, cols, rows, bottom, right, GLYPH_LRCORNER, CELL_DIM);
+
+    /* 2.  HUD ------------------------------------------------------- */
+    char txt[48];
+    float bot_acc = BOT_BASE_ACCELERATION + BOT_ACCEL_PER_POINT * g->score;
+    float ball_sp = sqrtf(g->ball.vx * g->ball.vx + g->ball.vy * g->ball.vy) *
+                    physics_tick_rate();                        /* Zellen / s */
+
+    snprintf(txt, sizeof txt, "Score: %d   (q = quit)", g->score);
+    put_text(buf, cols, rows, 0, 2, txt, 5 | CELL_BOLD);
+
+    int col = g->field_width - 25;
+    col = put_text(buf, cols, rows, 0, col, "Bot a:", 0);
+    snprintf(txt, sizeof txt, "%4.1f", bot_acc);
+    col = put_text(buf, cols, rows, 0, col, txt, 6 | CELL_BOLD);
+    col = put_text(buf, cols, rows, 0, col, "  Ball: ", 0);
+    snprintf(txt, sizeof txt, "%4.1f", ball_sp);
+    put_text(buf, cols, rows, 0, col, txt, 7 | CELL_BOLD);
+
+    /* 2a. Leistungs-Overlay in der unteren Rahmenzeile, vor der Ecke
+           abgeschnitten                                              */
+    if (fx->perf) {
+        for (int i = 0; fx->perf[i] && 2 + i < right; ++i)
+            put_cell(buf, cols, rows, bottom, 2 + i,
+                     (unsigned char)fx->perf[i], 0);
+    }
+
+    /* 3.  Spielobjekte --------------------------------------------- */
+    int px = (int)lroundf(fx->pose.player_x);
+    int bx = (int)lroundf(fx->pose.bot_x);
+    for (int i = 0; i < g->player.width; ++i)
+        put_cell(buf, cols, rows, g->player.y, px + i, GLYPH_BLOCK,
+                 3 | (fx->player_flash ? CELL_REVERSE : 0));
+    for (int i = 0; i < g->bot.width; ++i)
+        put_cell(buf, cols, rows, g->bot.y, bx + i, GLYPH_BLOCK,
+                 4 | (fx->bot_flash ? CELL_REVERSE : 0));
+
+    put_cell(buf, cols, rows, (int)fx->pose.ball_y, (int)fx->pose.ball_x,
+             GLYPH_DIAMOND, 2 | CELL_BOLD);
+
+    /* 4.  Overlays ------------------------------------------------- */
+    if (fx->game_over) {
+        put_text(buf, cols, rows, g->field_height / 2, 2,
+                 "Game over - press any key", 0);
+    } else if (fx->countdown > 0) {
+        snprintf(txt, sizeof txt, "%d", fx->countdown);
+        put_text(buf, cols, rows, rows / 2, cols / 2 - 1, txt, 0);
+    }
+}
@@ -0,0 +1,42 @@
+/* ------------------------------------------------------------------
+ * cells.h - Zellbasiertes Bildmodell (Glyph + Attribut je Zelle)
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#ifndef CELLS_H
+#define CELLS_H
+
+#include <stdbool.h>
+#include "physics.h"
+#include "render.h"
+
+/* Sonder-Glyphen; alle anderen Werte sind druckbares ASCII */
+enum {
+    GLYPH_HLINE = 1,
+    GLYPH_VLINE,
+    GLYPH_ULCORNER,
+    GLYPH_URCORNER,
+    GLYPH_LLCORNER,
+    GLYPH_LRCORNER,
+    GLYPH_BLOCK,
+    GLYPH_DIAMOND,
+};
+
+/* Attribut-Byte: Bits 0-2 = Farbpaar (0 = Standard), Rest = Flags */
+#define CELL_COLOR_MASK  0x07u
+#define CELL_BOLD        0x08u
+#define CELL_DIM         0x10u
+#define CELL_REVERSE     0x20u
+
+typedef struct
+{
+    unsigned char glyph;
+    unsigned char attr;
+} cell_t;
+
+void cells_clear(cell_t *buf, int cols, int rows);
+void cells_compose(cell_t *buf, int cols, int rows,
+                   const game_state_t *g, const render_fx_t *fx);
+
+#endif /* CELLS_H */
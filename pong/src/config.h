@@ -15,29 +15,42 @@
 /* Verhältnis zur Berechnung der Paddle-Breite */
 #define PADDLE_WIDTH_RATIO    6
 
+/* ----- Physik-Takt ---------------------------------------------- */
+/* Ticks pro Sekunde, beim Start wählbar (--hz). Alle Tempo-Werte
+   unten gelten je Sekunde; physics_set_tick_rate rechnet sie einmal
+   auf den Tick um. Bei 10 Hz ergeben sich genau die früheren Werte
+   je Physik-Frame.                                                   */
+#define PHYSICS_HZ_DEFAULT   10
+#define PHYSICS_HZ_MIN       10
+#define PHYSICS_HZ_MAX       1000
+
 /* ----- Paddle-Geschwindigkeiten ----------------------------------- */
-/* -------------  NEUE, frame-basierte Beschleunigungs-Physik ------------- */
-#define PLAYER_ACCELERATION        0.70f   /* Zellen / Physik-Frame²   */
-#define PLAYER_MAX_SPEED           12.0f   /* Zellen / Physik-Frame    */
+#define PLAYER_ACCELERATION        70.0f   /* Zellen / s²              */
+#define PLAYER_MAX_SPEED           120.0f  /* Zellen / s               */
 
-#define BOT_BASE_ACCELERATION      0.20f
-#define BOT_ACCEL_PER_POINT        0.04f   /* +a pro Score-Punkt       */
-#define BOT_MAX_SPEED              10.0f
+#define BOT_BASE_ACCELERATION      20.0f   /* Zellen / s²              */
+#define BOT_ACCEL_PER_POINT        4.0f    /* +a pro Score-Punkt       */
+#define BOT_MAX_SPEED              100.0f  /* Zellen / s               */
 
 /* --------- Allgemeine Paddle-Physik --------- */
-/* 0.0 … 1.0 – Faktor, wie stark vx pro Physik‑Frame erhalten bleibt */
-#define PADDLE_DAMPING          0.80f
-/* Schwelle, unter der vx sofort auf 0 gesetzt wird */
-#define PADDLE_STOP_EPS         0.05f
-
-/* ----- Ball-Geschwindigkeiten ------------------------------------- */
-#define BALL_INITIAL_SPEED         0.5f
-#define BALL_BOUNCE_MULTIPLIER     1.03f       /* Basis-Bounce-Factor     */
+/* 0.0 … 1.0 – Anteil von vx, der nach einer Sekunde ohne Eingabe
+   bleibt (0.80 je Frame bei 10 Hz = 0.80^10)                        */
+#define PADDLE_DAMPING          0.1073741824f
+/* Schwelle in Zellen / s, unter der vx sofort auf 0 gesetzt wird */
+#define PADDLE_STOP_EPS         0.5f
+
+/* Wie lange ein Tastendruck das Paddle antreibt; das Terminal meldet
+   gehaltene Tasten nur mit der Wiederholrate                         */
+#define INPUT_HOLD_MS           100
+
+/* ----- Ball-Geschwindigkeiten (Zellen / s) ------------------------ */
+#define BALL_INITIAL_SPEED         5.0f
+#define BALL_BOUNCE_MULTIPLIER     1.03f       /* Faktor je Paddle-Hit    */
 #define SPEED_PER_POINT            0.15f
-#define BALL_MAX_SPEED             5.0f
+#define BALL_MAX_SPEED             50.0f
 
 /* Mindesttempo + Steigungs-Limit                                      */
-#define BALL_MIN_SPEED             1.0f        /* Baseline-Tempo          */
+#define BALL_MIN_SPEED             10.0f       /* Baseline-Tempo          */
 #define BALL_MIN_VY_FRAC           0.25f       /* ≥ 25 % Vertikalanteil   */
 
 /* *** NEU: Skalierungsfaktoren je Paddle-Hit ************************* */
@@ -47,9 +60,17 @@
 /* Wie stark Rand­treffer abbremsen? */
 #define BALL_EDGE_SLOWDOWN  0.25f   
 
+/* ----- Bot-KI, Vorhersage-Modus (AI_MODE_PREDICT) ---------------- */
+/* Streuung des Zielpunkts in Zellen: (Basis + je Sekunde Vorlauf),
+   geteilt durch (1 + Faktor · Score) → Bot wird mit dem Score genauer */
+#define AI_ERROR_BASE          0.5f
+#define AI_ERROR_PER_SECOND    1.5f
+#define AI_ERROR_PER_POINT     0.10f
+
 /* ----- UI / Renderer-Parameter ----------------------------------- */
 #define FLASH_FRAMES           4      /* Frames, die Paddles aufblinken */
 #define COUNTDOWN_STEPS        3      /* 3-2-1 */
 #define COUNTDOWN_DELAY_MS     400    /* pro Zahl in Millisekunden */
+#define PERF_TEXT_FRAMES       16     /* Leistungs-Overlay alle n Frames neu */
 
 #endif /* CONFIG_H */
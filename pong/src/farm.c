@@ -0,0 +1,557 @@
+/* ------------------------------------------------------------------
+ * farm.c - Headless-Farm: viele unabhängige Spiele auf vielen Threads
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ *
+ * Die Spiele werden in Pakete fester Größe zerlegt. Jeder Thread
+ * besitzt zu Beginn einen zusammenhängenden Bereich von Paketen und
+ * arbeitet ihn von vorne ab; ist er leer, stiehlt er das letzte Paket
+ * des Threads mit der meisten Restarbeit. Ein Bereich ist ein
+ * 64‑Bit‑Wort (next | end), Besitzer und Dieb arbeiten per CAS darauf.
+ *
+ * Jedes Spiel hat seinen eigenen, allein aus seed und Spielindex
+ * abgeleiteten Zufall (PCG-Stream bzw. Batch-Lane-Seed);
+ * Statistiken sind reine Ganzzahlsummen. Das Ergebnis hängt damit
+ * nicht von Thread-Zahl, Paketgröße oder Verteilung ab.
+ * ------------------------------------------------------------------ */
+
+#define _GNU_SOURCE             /* pthread_setaffinity_np, CPU_SET */
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "farm.h"
+#include "ai.h"
+#include "batch.h"
+#include "physics.h"
+
+#define FARM_CHUNK_SCALAR  16   /* Spiele pro Paket, skalarer Kern  */
+#define FARM_CHUNK_BATCH   256  /* Spiele pro Paket, Batch-Kern     */
+#define FARM_CACHE_LINE    64
+
+/* Arbeitsbereich eines Threads, eigene Cache-Zeile gegen False Sharing */
+typedef struct
+{
+    uint64_t range;             /* untere 32 Bit: next, obere: end */
+    char     pad[FARM_CACHE_LINE - sizeof(uint64_t)];
+} farm_queue_t;
+
+typedef struct farm_ctx farm_ctx_t;
+
+typedef struct
+{
+    farm_ctx_t   *ctx;
+    int           index;
+    farm_result_t stats;        /* Teilergebnis dieses Threads */
+} farm_worker_t;
+
+struct farm_ctx
+{
+    const farm_config_t *cfg;
+    int                  chunk;
+    int                  n_chunks;
+    int                  n_threads;
+    farm_queue_t        *queues;
+};
+
+/* ------------------------------------------------------------------
+ * farm_mix
+ * Leitet aus Seed und Index einen unabhängigen 32‑Bit‑Startwert ab
+ * (splitmix64‑Finalisierer), niemals 0.
+ *
+ * Parameter:
+ *   seed  – globaler Seed
+ *   index – Spielindex
+ *
+ * Rückgabe:
+ *   Startwert
+ * ------------------------------------------------------------------ */
+static uint32_t farm_mix(uint32_t seed, uint32_t index)
+{
+    uint64_t z = ((uint64_t)seed << 32 | index) + 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    z ^= z >> 31;
+    uint32_t r = (uint32_t)(z >> 32);
+    return r ? r : 0x6D2B79F5u;
+}
+
+/* ------------------------------------------------------------------
+ * hist_add / hist_add_log2
+ * Zählen einen Wert in ein Histogramm: linear (letzter Bucket =
+ * Überlauf) bzw. logarithmisch (Bucket k = [2^(k-1), 2^k), 0 → 0).
+ *
+ * Parameter:
+ *   hist  – Histogramm mit FARM_HIST_BUCKETS Einträgen
+ *   value – Wert
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void hist_add(unsigned long *hist, unsigned long value)
+{
+    hist[value < FARM_HIST_BUCKETS ? value : FARM_HIST_BUCKETS - 1]++;
+}
+
+static void hist_add_log2(unsigned long *hist, unsigned long value)
+{
+    int k = 0;
+    while (value && k < FARM_HIST_BUCKETS - 1) {
+        value >>= 1;
+        k++;
+    }
+    hist[k]++;
+}
+
+/* ------------------------------------------------------------------
+ * record_rally / record_game
+ * Tragen einen beendeten Ballwechsel bzw. ein beendetes Spiel in die
+ * Statistik ein.
+ * ------------------------------------------------------------------ */
+static void record_rally(farm_result_t *s, unsigned long hits)
+{
+    s->rallies++;
+    s->rally_hits += hits;
+    if (hits > s->rally_max)
+        s->rally_max = hits;
+    hist_add_log2(s->rally_hist, hits);
+}
+
+static void record_game(farm_result_t *s, int score, bool over)
+{
+    s->games++;
+    s->game_overs += over;
+    s->score_sum  += (unsigned long)score;
+    if (s->games == 1 || score < s->score_min) s->score_min = score;
+    if (s->games == 1 || score > s->score_max) s->score_max = score;
+    hist_add(s->score_hist, (unsigned long)score);
+}
+
+/* Anzahl Paddle-Treffer in einer Event-Maske (beide in einem Tick möglich) */
+static unsigned long hit_count(uint32_t ev)
+{
+    return ((ev & PHYS_EVENT_HIT_PLAYER) != 0) + ((ev & PHYS_EVENT_HIT_BOT) != 0);
+}
+
+/* ------------------------------------------------------------------
+ * run_chunk_scalar
+ * Simuliert die Spiele [first, first + n) einzeln mit den skalaren
+ * Funktionen, beide Paddles per KI.
+ *
+ * Parameter:
+ *   cfg   – Farm-Konfiguration
+ *   first – erster Spielindex
+ *   n     – Anzahl Spiele
+ *   s     – Statistik (in-place)
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void run_chunk_scalar(const farm_config_t *cfg, int first, int n,
+                             farm_result_t *s)
+{
+    for (int i = first; i < first + n; ++i) {
+        game_state_t g = physics_create_game_seeded(cfg->width, cfg->height,
+                                                    cfg->seed, (uint64_t)i);
+
+        unsigned long rally = 0, t = 0;
+        bool over = false;
+        while (t < cfg->ticks && !over) {
+            ai_player_update(&g);
+            ai_update(&g);
+            physics_event_t ev = physics_update_ball_events(&g);
+            t++;
+
+            rally += hit_count(ev);
+            if (ev & (PHYS_EVENT_SCORED | PHYS_EVENT_GAME_OVER)) {
+                record_rally(s, rally);
+                rally = 0;
+            }
+            over = (ev & PHYS_EVENT_GAME_OVER) != 0;
+        }
+        if (!over)
+            record_rally(s, rally);          /* vom Tick-Limit abgebrochen */
+        s->ticks += t;
+        record_game(s, g.score, over);
+    }
+}
+
+/* ------------------------------------------------------------------
+ * run_chunk_batch
+ * Simuliert die Spiele [first, first + n) als ein Batch (KI gegen KI),
+ * beendete Spiele werden laufend aus dem simulierten Bereich
+ * kompaktiert. Jedes Spiel wird über seinen Spielindex geseedet, die
+ * Paketgröße beeinflusst also nur die Aufteilung, nicht das Ergebnis.
+ *
+ * Parameter:
+ *   cfg   – Farm-Konfiguration
+ *   first – erster Spielindex
+ *   n     – Anzahl Spiele
+ *   s     – Statistik (in-place)
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void run_chunk_batch(const farm_config_t *cfg, int first, int n,
+                            farm_result_t *s)
+{
+    batch_t *b = batch_create(n, cfg->width, cfg->height, cfg->seed);
+    unsigned long *rally = calloc((size_t)n, sizeof *rally);
+    if (!b || !rally) {
+        batch_destroy(b);
+        free(rally);
+        return;
+    }
+    for (int l = 0; l < n; ++l)
+        batch_seed(b, l, farm_mix(cfg->seed, (uint32_t)(first + l)));
+
+    int running = n;
+    for (unsigned long t = 0; t < cfg->ticks && running > 0; ++t) {
+        int active = b->active;
+        s->ticks += (unsigned long)running;
+        running = batch_step(b, NULL);
+
+        for (int l = 0; l < active; ++l) {
+            uint32_t ev = b->events[l];
+            if (!ev)
+                continue;
+            int g = b->id[l];
+            rally[g] += hit_count(ev);
+            if (ev & (PHYS_EVENT_SCORED | PHYS_EVENT_GAME_OVER)) {
+                record_rally(s, rally[g]);
+                rally[g] = 0;
+            }
+            if (ev & PHYS_EVENT_GAME_OVER)
+                record_game(s, (int)b->score[l], true);
+        }
+        if (running < b->active - b->active / 8)
+            batch_compact(b);
+    }
+
+    /* Spiele, die das Tick-Limit erreicht haben */
+    for (int l = 0; l < b->active; ++l) {
+        if (!b->alive[l])
+            continue;
+        record_rally(s, rally[b->id[l]]);
+        record_game(s, (int)b->score[l], false);
+    }
+
+    free(rally);
+    batch_destroy(b);
+}
+
+/* ------------------------------------------------------------------
+ * pack / take_front / steal_back
+ * Arbeitsbereich (next, end) als ein 64‑Bit‑Wort. Der Besitzer nimmt
+ * vorne, Diebe nehmen hinten; beide per CAS auf dasselbe Wort.
+ * Rückgabe jeweils Paketindex oder -1.
+ * ------------------------------------------------------------------ */
+static uint64_t pack(uint32_t next, uint32_t end)
+{
+    return (uint64_t)end << 32 | next;
+}
+
+static int take_front(farm_queue_t *q)
+{
+    uint64_t r = __atomic_load_n(&q->range, __ATOMIC_ACQUIRE);
+    for (;;) {
+        uint32_t next = (uint32_t)r, end = (uint32_t)(r >> 32);
+        if (next >= end)
+            return -1;
+        if (__atomic_compare_exchange_n(&q->range, &r, pack(next + 1, end), false,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+            return (int)next;
+    }
+}
+
+static int steal_back(farm_queue_t *q)
+{
+    uint64_t r = __atomic_load_n(&q->range, __ATOMIC_ACQUIRE);
+    for (;;) {
+        uint32_t next = (uint32_t)r, end = (uint32_t)(r >> 32);
+        if (next >= end)
+            return -1;
+        if (__atomic_compare_exchange_n(&q->range, &r, pack(next, end - 1), false,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+            return (int)(end - 1);
+    }
+}
+
+/* ------------------------------------------------------------------
+ * next_chunk
+ * Nächstes Paket für Thread self: erst aus dem eigenen Bereich, dann
+ * vom Thread mit der meisten Restarbeit.
+ *
+ * Parameter:
+ *   ctx  – Farm-Kontext
+ *   self – eigener Thread-Index
+ *
+ * Rückgabe:
+ *   Paketindex oder -1, wenn keine Arbeit mehr übrig ist
+ * ------------------------------------------------------------------ */
+static int next_chunk(farm_ctx_t *ctx, int self)
+{
+    int c = take_front(&ctx->queues[self]);
+    while (c < 0) {
+        int      victim = -1;
+        uint32_t most   = 0;
+        for (int t = 0; t < ctx->n_threads; ++t) {
+            uint64_t r    = __atomic_load_n(&ctx->queues[t].range, __ATOMIC_RELAXED);
+            uint32_t next = (uint32_t)r, end = (uint32_t)(r >> 32);
+            if (end > next && end - next > most) {
+                most   = end - next;
+                victim = t;
+            }
+        }
+        if (victim < 0)
+            return -1;
+        c = steal_back(&ctx->queues[victim]);
+    }
+    return c;
+}
+
+/* ------------------------------------------------------------------
+ * pin_to_core
+ * Bindet den aufrufenden Thread an einen Kern (Round-Robin über die
+ * Online-Kerne). Fehler werden ignoriert – Pinning ist nur ein Hinweis.
+ *
+ * Parameter:
+ *   index – Thread-Index
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void pin_to_core(int index)
+{
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cores < 1)
+        return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET((int)(index % cores), &set);
+    pthread_setaffinity_np(pthread_self(), sizeof set, &set);
+}
+
+/* ------------------------------------------------------------------
+ * worker_main
+ * Thread-Funktion: holt Pakete, bis keine Arbeit mehr übrig ist.
+ *
+ * Parameter:
+ *   arg – farm_worker_t dieses Threads
+ *
+ * Rückgabe:
+ *   NULL
+ * ------------------------------------------------------------------ */
+static void *worker_main(void *arg)
+{
+    farm_worker_t       *w   = arg;
+    farm_ctx_t          *ctx = w->ctx;
+    const farm_config_t *cfg = ctx->cfg;
+
+    if (cfg->pin)
+        pin_to_core(w->index);
+
+    for (int c; (c = next_chunk(ctx, w->index)) >= 0; ) {
+        int first = c * ctx->chunk;
+        int n     = cfg->games - first < ctx->chunk ? cfg->games - first : ctx->chunk;
+        if (cfg->engine == FARM_ENGINE_BATCH)
+            run_chunk_batch(cfg, first, n, &w->stats);
+        else
+            run_chunk_scalar(cfg, first, n, &w->stats);
+    }
+    return NULL;
+}
+
+/* ------------------------------------------------------------------
+ * merge_stats
+ * Addiert ein Thread-Teilergebnis in das Gesamtergebnis.
+ *
+ * Parameter:
+ *   dst – Gesamtergebnis
+ *   src – Teilergebnis
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void merge_stats(farm_result_t *dst, const farm_result_t *src)
+{
+    if (src->games > 0) {
+        if (dst->games == 0 || src->score_min < dst->score_min) dst->score_min = src->score_min;
+        if (dst->games == 0 || src->score_max > dst->score_max) dst->score_max = src->score_max;
+    }
+    dst->games      += src->games;
+    dst->ticks      += src->ticks;
+    dst->game_overs += src->game_overs;
+    dst->score_sum  += src->score_sum;
+    dst->rallies    += src->rallies;
+    dst->rally_hits += src->rally_hits;
+    if (src->rally_max > dst->rally_max)
+        dst->rally_max = src->rally_max;
+    for (int i = 0; i < FARM_HIST_BUCKETS; ++i) {
+        dst->score_hist[i] += src->score_hist[i];
+        dst->rally_hist[i] += src->rally_hist[i];
+    }
+}
+
+/* ------------------------------------------------------------------
+ * farm_config_defaults
+ * Füllt eine Farm-Konfiguration mit Standardwerten.
+ *
+ * Parameter:
+ *   cfg – Konfiguration
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void farm_config_defaults(farm_config_t *cfg)
+{
+    memset(cfg, 0, sizeof *cfg);
+    cfg->games  = 1000;
+    cfg->ticks  = 10000;
+    cfg->seed   = 1;
+    cfg->engine = FARM_ENGINE_SCALAR;
+    cfg->width  = 80;
+    cfg->height = 24;
+}
+
+/* ------------------------------------------------------------------
+ * farm_run
+ * Verteilt cfg->games Spiele auf den Thread-Pool und sammelt die
+ * Statistik.
+ *
+ * Parameter:
+ *   cfg – Konfiguration
+ *   res – Ausgabe: Gesamtergebnis
+ *
+ * Rückgabe:
+ *   false bei ungültiger Konfiguration oder Ressourcenfehler
+ * ------------------------------------------------------------------ */
+bool farm_run(const farm_config_t *cfg, farm_result_t *res)
+{
+    memset(res, 0, sizeof *res);
+    if (cfg->games < 1)
+        return false;
+
+    farm_ctx_t ctx;
+    ctx.cfg   = cfg;
+    ctx.chunk = cfg->chunk > 0 ? cfg->chunk
+              : cfg->engine == FARM_ENGINE_BATCH ? FARM_CHUNK_BATCH : FARM_CHUNK_SCALAR;
+    ctx.n_chunks  = (cfg->games + ctx.chunk - 1) / ctx.chunk;
+    ctx.n_threads = cfg->threads > 0 ? cfg->threads : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (ctx.n_threads < 1)
+        ctx.n_threads = 1;
+    if (ctx.n_threads > ctx.n_chunks)
+        ctx.n_threads = ctx.n_chunks;
+
+    ctx.queues = NULL;
+    if (posix_memalign((void **)&ctx.queues, FARM_CACHE_LINE,
+                       sizeof(farm_queue_t) * (size_t)ctx.n_threads) != 0)
+        return false;
+    farm_worker_t *workers = calloc((size_t)ctx.n_threads, sizeof *workers);
+    pthread_t     *tids    = calloc((size_t)ctx.n_threads, sizeof *tids);
+    if (!workers || !tids) {
+        free(ctx.queues); free(workers); free(tids);
+        return false;
+    }
+
+    /* Pakete gleichmäßig und zusammenhängend vorverteilen */
+    for (int t = 0; t < ctx.n_threads; ++t) {
+        uint32_t lo = (uint32_t)((long)ctx.n_chunks * t / ctx.n_threads);
+        uint32_t hi = (uint32_t)((long)ctx.n_chunks * (t + 1) / ctx.n_threads);
+        ctx.queues[t].range = pack(lo, hi);
+        workers[t].ctx   = &ctx;
+        workers[t].index = t;
+    }
+
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+
+    int started = 0;
+    for (; started < ctx.n_threads; ++started)
+        if (pthread_create(&tids[started], NULL, worker_main, &workers[started]) != 0)
+            break;
+    if (started == 0)                     /* ohne Threads im Aufrufer rechnen */
+        worker_main(&workers[0]);
+    for (int t = 0; t < started; ++t)
+        pthread_join(tids[t], NULL);
+
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    for (int t = 0; t < ctx.n_threads; ++t)
+        merge_stats(res, &workers[t].stats);
+    res->threads = started > 0 ? started : 1;
+    res->chunk   = ctx.chunk;
+    res->seconds = (double)(t1.tv_sec - t0.tv_sec) + (double)(t1.tv_nsec - t0.tv_nsec) * 1e-9;
+
+    free(ctx.queues);
+    free(workers);
+    free(tids);
+    return res->games == (unsigned long)cfg->games;
+}
+
+/* ------------------------------------------------------------------
+ * print_hist
+ * Gibt ein Histogramm als "wert:anzahl"-Liste aus (leere Buckets
+ * werden übersprungen), log2-Buckets als Bereich "lo-hi".
+ *
+ * Parameter:
+ *   out  – Ausgabestrom
+ *   name – Bezeichnung
+ *   hist – Histogramm
+ *   log2 – Buckets logarithmisch (siehe hist_add_log2)
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void print_hist(FILE *out, const char *name, const unsigned long *hist, bool log2)
+{
+    fprintf(out, "%s:", name);
+    for (int i = 0; i < FARM_HIST_BUCKETS; ++i) {
+        if (!hist[i])
+            continue;
+        bool last = i == FARM_HIST_BUCKETS - 1;
+        if (!log2 || i < 2)
+            fprintf(out, " %d%s:%lu", i, last ? "+" : "", hist[i]);
+        else if (last)
+            fprintf(out, " %lu+:%lu", 1ul << (i - 1), hist[i]);
+        else
+            fprintf(out, " %lu-%lu:%lu", 1ul << (i - 1), (1ul << i) - 1, hist[i]);
+    }
+    fputc('\n', out);
+}
+
+/* ------------------------------------------------------------------
+ * farm_print
+ * Gibt die Gesamtstatistik eines Farmlaufs aus.
+ *
+ * Parameter:
+ *   out – Ausgabestrom
+ *   cfg – Konfiguration des Laufs
+ *   res – Ergebnis
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void farm_print(FILE *out, const farm_config_t *cfg, const farm_result_t *res)
+{
+    double games   = res->games   ? (double)res->games   : 1.0;
+    double rallies = res->rallies ? (double)res->rallies : 1.0;
+
+    fprintf(out, "farm: games=%lu max_ticks=%lu seed=%u engine=%s threads=%d chunk=%d\n",
+            res->games, cfg->ticks, (unsigned)cfg->seed,
+            cfg->engine == FARM_ENGINE_BATCH ? "batch" : "scalar",
+            res->threads, res->chunk);
+    fprintf(out, "ticks: total=%lu per_game=%.1f per_second=%.0f seconds=%.3f\n",
+            res->ticks, (double)res->ticks / games,
+            res->seconds > 0.0 ? (double)res->ticks / res->seconds : 0.0, res->seconds);
+    fprintf(out, "end: game_over=%lu tick_limit=%lu\n",
+            res->game_overs, res->games - res->game_overs);
+    fprintf(out, "score: mean=%.3f min=%d max=%d\n",
+            (double)res->score_sum / games, res->score_min, res->score_max);
+    print_hist(out, "score_hist", res->score_hist, false);
+    fprintf(out, "rally: count=%lu mean=%.3f max=%lu\n",
+            res->rallies, (double)res->rally_hits / rallies, res->rally_max);
+    print_hist(out, "rally_hist", res->rally_hist, true);
+}
@@ -0,0 +1,61 @@
+/* ------------------------------------------------------------------
+ * farm.h - Header des Headless-Farmbetriebs (viele Spiele, viele Threads)
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#ifndef FARM_H
+#define FARM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* Simulationskern je Arbeitspaket */
+typedef enum {
+    FARM_ENGINE_SCALAR = 0,   /* physics/ai‑Funktionen, ein Spiel pro Aufruf */
+    FARM_ENGINE_BATCH,        /* batch_step, SIMD über ein ganzes Paket      */
+} farm_engine_t;
+
+typedef struct
+{
+    int           games;      /* Anzahl unabhängiger Spiele               */
+    unsigned long ticks;      /* maximale Ticks pro Spiel                 */
+    uint32_t      seed;       /* Ergebnis hängt nur von seed ab, nicht
+                                 von der Thread-Zahl                      */
+    int           threads;    /* 0 = ein Thread pro Online-Kern           */
+    bool          pin;        /* Threads fest an Kerne binden             */
+    int           chunk;      /* Spiele pro Arbeitspaket (0 = Standard)   */
+    farm_engine_t engine;
+    int           width;      /* Spielfeldgröße aller Spiele              */
+    int           height;
+} farm_config_t;
+
+/* Histogramme: Scores linear (Bucket i = Wert i, letzter = Überlauf),
+   Ballwechsel logarithmisch (Bucket k = [2^(k-1), 2^k)) */
+#define FARM_HIST_BUCKETS 16
+
+typedef struct
+{
+    unsigned long games;
+    unsigned long ticks;            /* Summe aller simulierten Ticks      */
+    unsigned long game_overs;       /* Spiele mit Game Over (Rest: Limit) */
+    unsigned long score_sum;
+    int           score_min;
+    int           score_max;
+    unsigned long score_hist[FARM_HIST_BUCKETS];
+    unsigned long rallies;          /* Ballwechsel = Aufschlag bis Punkt/Ende */
+    unsigned long rally_hits;       /* Paddle-Treffer über alle Ballwechsel   */
+    unsigned long rally_max;
+    unsigned long rally_hist[FARM_HIST_BUCKETS];
+
+    int           threads;          /* tatsächlich genutzte Threads       */
+    int           chunk;
+    double        seconds;          /* Wandzeit der Simulation            */
+} farm_result_t;
+
+void farm_config_defaults(farm_config_t *cfg);
+bool farm_run(const farm_config_t *cfg, farm_result_t *res);
+void farm_print(FILE *out, const farm_config_t *cfg, const farm_result_t *res);
+
+#endif /* FARM_H */
@@ -0,0 +1,331 @@
+/* ------------------------------------------------------------------
+ * fixed.c - Festkomma-Physik (Q16.16) für bitgleiche Ergebnisse
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ *
+ * Gegenstück zu update_paddle und reflect_paddle aus physics.c in
+ * reiner Ganzzahlarithmetik. Die zeitfreien Konstanten aus config.h
+ * werden zur Übersetzungszeit nach Q16.16 gerundet, die Werte je Tick
+ * liegen als fx_-Kopien in physics_rate(); Wurzeln liefert eine
+ * ganzzahlige Quadratwurzel. Der Ablauf folgt Schritt für Schritt
+ * der float-Version, damit beide Modi dasselbe Spiel spielen.
+ * ------------------------------------------------------------------ */
+
+#include "fixed.h"
+#include "config.h"
+
+/* Konstanten in Q16.16 */
+#define FX_SPIN           FIX_CONST(0.30)
+#define FX_BOUNCE_MULT    FIX_CONST(BALL_BOUNCE_MULTIPLIER)
+#define FX_BOUNCE_INC     FIX_CONST(BALL_BOUNCE_INC)
+#define FX_EDGE_SLOWDOWN  FIX_CONST(BALL_EDGE_SLOWDOWN)
+#define FX_MIN_SPEED_INC  FIX_CONST(BALL_MIN_SPEED_INC)
+#define FX_MIN_VY_FRAC    FIX_CONST(BALL_MIN_VY_FRAC)
+
+/* ------------------------------------------------------------------
+ * fix_from_float
+ * Rundet einen float auf den nächsten Q16.16-Wert (Sättigung bei
+ * Überlauf). Die Rechnung in double ist exakt.
+ *
+ * Parameter:
+ *   f – Wert
+ *
+ * Rückgabe:
+ *   Q16.16-Wert
+ * ------------------------------------------------------------------ */
+fix_t fix_from_float(float f)
+{
+    double s = (double)f * 65536.0;
+    if (s >=  2147483647.0) return  FIX_MAX;
+    if (s <= -2147483647.0) return -FIX_MAX;
+    return (fix_t)(s < 0.0 ? s - 0.5 : s + 0.5);
+}
+
+/* ------------------------------------------------------------------
+ * fix_to_float
+ * Wandelt Q16.16 in float; exakt, solange |v| < 256 (24 Bit Mantisse).
+ *
+ * Parameter:
+ *   v – Q16.16-Wert
+ *
+ * Rückgabe:
+ *   float
+ * ------------------------------------------------------------------ */
+float fix_to_float(fix_t v)
+{
+    return (float)v / 65536.0f;
+}
+
+/* ------------------------------------------------------------------
+ * fix_isqrt64
+ * Ganzzahlige Quadratwurzel (abgerundet), Ziffer für Ziffer zur
+ * Basis 4 – ohne Division und ohne Gleitkomma.
+ *
+ * Parameter:
+ *   v – Radikand
+ *
+ * Rückgabe:
+ *   floor(sqrt(v))
+ * ------------------------------------------------------------------ */
+uint32_t fix_isqrt64(uint64_t v)
+{
+    uint64_t res = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+
+    while (bit > v)
+        bit >>= 2;
+    while (bit) {
+        if (v >= res + bit) {
+            v  -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)res;
+}
+
+/* ------------------------------------------------------------------
+ * fix_sqrt
+ * Quadratwurzel in Q16.16: sqrt(a·2^16) = sqrt(a)·2^8.
+ *
+ * Parameter:
+ *   a – Q16.16-Wert (≤ 0 → 0)
+ *
+ * Rückgabe:
+ *   Q16.16-Wurzel
+ * ------------------------------------------------------------------ */
+fix_t fix_sqrt(fix_t a)
+{
+    if (a <= 0)
+        return 0;
+    return (fix_t)fix_isqrt64((uint64_t)a << FIX_SHIFT);
+}
+
+/* ------------------------------------------------------------------
+ * fix_hypot
+ * Länge des Vektors (a, b); die Quadrate bleiben in voller Q32.32-
+ * Genauigkeit, erst die Wurzel führt zurück nach Q16.16.
+ *
+ * Parameter:
+ *   a, b – Komponenten
+ *
+ * Rückgabe:
+ *   sqrt(a² + b²) in Q16.16
+ * ------------------------------------------------------------------ */
+fix_t fix_hypot(fix_t a, fix_t b)
+{
+    uint64_t sq = (uint64_t)((int64_t)a * a) + (uint64_t)((int64_t)b * b);
+    uint32_t r  = fix_isqrt64(sq);
+    return r > (uint32_t)FIX_MAX ? FIX_MAX : (fix_t)r;
+}
+
+/* x^n in Q0.32 (1.0 = 2^32), jedes Produkt abgeschnitten */
+static uint64_t q32_pow(uint64_t x, unsigned n)
+{
+    uint64_t r = (uint64_t)1 << 32;
+    while (n) {
+        if (n & 1u) r = (r * x) >> 32;
+        x = (x * x) >> 32;
+        n >>= 1;
+    }
+    return r;
+}
+
+/* ------------------------------------------------------------------
+ * fix_root_frac
+ * n-te Wurzel eines Anteils 0 < a < 1, per Bisektion in Q0.32 und
+ * nur mit Ganzzahlen – anders als pow() auf jeder Plattform bitgleich.
+ *
+ * Parameter:
+ *   a – Anteil (z.B. Dämpfung je Sekunde)
+ *   n – Wurzelgrad (Ticks pro Sekunde), > 0
+ *
+ * Rückgabe:
+ *   a^(1/n), auf Q16.16 gerundet
+ * ------------------------------------------------------------------ */
+fix_t fix_root_frac(float a, unsigned n)
+{
+    uint64_t target = (uint64_t)((double)a * 4294967296.0 + 0.5);
+    uint64_t lo = 0, hi = (uint64_t)1 << 32;
+
+    /* größtes x mit x^n <= a */
+    while (hi - lo > 1) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if (q32_pow(mid, n) <= target) lo = mid;
+        else                            hi = mid;
+    }
+    return (fix_t)((lo + ((uint64_t)1 << 15)) >> 16);
+}
+
+/* ------------------------------------------------------------------
+ * fix_ball_load / fix_ball_store / fix_paddle_load / fix_paddle_store
+ * Kopieren Ball bzw. Paddle zwischen float- und Festkommadarstellung.
+ *
+ * Parameter:
+ *   Ziel und Quelle
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void fix_ball_load(fix_ball_t *fb, const ball_t *b)
+{
+    fb->x  = fix_from_float(b->x);
+    fb->y  = fix_from_float(b->y);
+    fb->vx = fix_from_float(b->vx);
+    fb->vy = fix_from_float(b->vy);
+}
+
+void fix_ball_store(const fix_ball_t *fb, ball_t *b)
+{
+    b->x  = fix_to_float(fb->x);
+    b->y  = fix_to_float(fb->y);
+    b->vx = fix_to_float(fb->vx);
+    b->vy = fix_to_float(fb->vy);
+}
+
+void fix_paddle_load(fix_paddle_t *fp, const paddle_t *p)
+{
+    fp->x     = fix_from_float(p->x);
+    fp->y     = p->y;
+    fp->width = p->width;
+    fp->vx    = fix_from_float(p->vx);
+    fp->ax    = fix_from_float(p->ax);
+}
+
+void fix_paddle_store(const fix_paddle_t *fp, paddle_t *p)
+{
+    p->x  = fix_to_float(fp->x);
+    p->vx = fix_to_float(fp->vx);
+    p->ax = fix_to_float(fp->ax);
+}
+
+/* ------------------------------------------------------------------
+ * fix_update_paddle
+ * Festkomma-Variante von update_paddle: Beschleunigung, Dämpfung,
+ * Geschwindigkeits-Deckel, Position und Spielfeldgrenzen.
+ *
+ * Parameter:
+ *   p       – Zeiger auf Paddle
+ *   dir     – gewünschte Richtung (-1, 0, +1)
+ *   accel   – Beschleunigung
+ *   v_max   – Maximalgeschwindigkeit
+ *   field_w – Spielfeldbreite
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void fix_update_paddle(fix_paddle_t *p, int dir, fix_t accel, fix_t v_max,
+                       int field_w)
+{
+    /* Schritt 1 : Beschleunigung bzw. Dämpfung */
+    if (dir != 0) {
+        p->ax  = dir > 0 ? accel : -accel;
+        p->vx += p->ax;
+    } else {
+        const physics_rate_t *r = physics_rate();
+        p->ax = 0;
+        p->vx = fix_mul(p->vx, r->fx_damping);
+        if (fix_abs(p->vx) < r->fx_stop_eps)
+            p->vx = 0;
+    }
+
+    /* Schritt 2 : Geschwindigkeits‑Deckel */
+    if (p->vx >  v_max) p->vx =  v_max;
+    if (p->vx < -v_max) p->vx = -v_max;
+
+    /* Schritt 3 : Position */
+    p->x += p->vx;
+
+    /* Schritt 4 : Spielfeldgrenzen + „Gummiband“ wie in update_paddle */
+    fix_t max_x = FIX_INT(field_w - p->width - 1);
+    if (p->x < 0) {
+        p->x  = 0;
+        p->vx = 0;
+    }
+    if (dir > 0 && p->x >= max_x - FIX_ONE) {
+        p->x  = max_x;
+        p->vx = 0;
+    } else if (p->x > max_x) {
+        p->x  = max_x;
+        p->vx = 0;
+    }
+}
+
+/* ------------------------------------------------------------------
+ * fix_reflect_paddle
+ * Festkomma-Variante von reflect_paddle: Richtung aus dem Treffpunkt,
+ * Spin, Bounce, Edge-Drop, Tempo-Grenzen und Mindeststeigung.
+ *
+ * Parameter:
+ *   ball             – Zeiger auf den Ball
+ *   p                – getroffener Schläger
+ *   hits_since_reset – Anzahl Paddle‑Hits seit letztem Reset
+ *
+ * Rückgabe:
+ *   keine (Ball wird in-place geändert)
+ * ------------------------------------------------------------------ */
+void fix_reflect_paddle(fix_ball_t *ball, const fix_paddle_t *p,
+                        int hits_since_reset)
+{
+    /* 1. Gesamt-Tempo */
+    fix_t speed = fix_hypot(ball->vx, ball->vy);
+
+    /* 2. Offset (-1 … +1) */
+    fix_t half   = p->width * FIX_HALF;
+    fix_t offset = fix_div(ball->x - (p->x + half), half);
+    if (offset < -FIX_ONE) offset = -FIX_ONE;
+    if (offset >  FIX_ONE) offset =  FIX_ONE;
+    fix_t abs_off = fix_abs(offset);
+
+    /* 3. Richtung mit konstanter Länge = speed */
+    fix_t new_vx = fix_mul(speed, offset);
+    fix_t new_vy = fix_mul(speed, fix_sqrt(FIX_ONE - fix_mul(abs_off, abs_off)));
+    if (ball->vy >= 0)
+        new_vy = -new_vy;
+
+    /* 4. Spin */
+    new_vx += fix_mul(p->vx, FX_SPIN);
+
+    /* 5. Bounce */
+    fix_t bounce = FX_BOUNCE_MULT + hits_since_reset * FX_BOUNCE_INC;
+    new_vx = fix_mul(new_vx, bounce);
+    new_vy = fix_mul(new_vy, bounce);
+
+    /* 6. Edge‑Drop */
+    fix_t edge_drop = FIX_ONE - fix_mul(FX_EDGE_SLOWDOWN, abs_off);
+    ball->vx = fix_mul(new_vx, edge_drop);
+    ball->vy = fix_mul(new_vy, edge_drop);
+
+    /* 8. Geschwindigkeits-Grenzen (je Tick) */
+    const physics_rate_t *r = physics_rate();
+    fix_t max_speed = r->fx_ball_max_speed;
+    fix_t mag = fix_hypot(ball->vx, ball->vy);
+    if (mag > max_speed) {
+        fix_t s = fix_div(max_speed, mag);
+        ball->vx = fix_mul(ball->vx, s);
+        ball->vy = fix_mul(ball->vy, s);
+        mag = max_speed;
+    }
+
+    /* 9. dynamisches Minimum (bei Stillstand gibt es keine Richtung) */
+    fix_t dyn_min = fix_mul(r->fx_ball_min_speed,
+                            FIX_ONE + hits_since_reset * FX_MIN_SPEED_INC);
+    if (dyn_min > max_speed) dyn_min = max_speed;
+    if (mag > 0 && mag < dyn_min) {
+        fix_t s = fix_div(dyn_min, mag);
+        ball->vx = fix_mul(ball->vx, s);
+        ball->vy = fix_mul(ball->vy, s);
+        mag = dyn_min;
+    }
+
+    /* 10. Mindest-Steigung */
+    fix_t vy_t = fix_mul(mag, FX_MIN_VY_FRAC);
+    if (fix_abs(ball->vy) < vy_t) {
+        int64_t rest = (int64_t)mag * mag - (int64_t)vy_t * vy_t;
+        fix_t   vx_t = (fix_t)fix_isqrt64(rest > 0 ? (uint64_t)rest : 0u);
+        ball->vy = ball->vy >= 0 ? vy_t : -vy_t;
+        ball->vx = ball->vx >= 0 ? vx_t : -vx_t;
+    }
+}
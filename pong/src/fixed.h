@@ -0,0 +1,89 @@
+/* ------------------------------------------------------------------
+ * fixed.h - Header der Festkomma-Physik (Q16.16)
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#ifndef FIXED_H
+#define FIXED_H
+
+#include <stdint.h>
+#include "physics.h"
+
+/* ---------------------------------------------------------------
+ * Q16.16: 16 Bit Vorkomma, 16 Bit Nachkomma in einem int32_t.
+ * Alle Operationen sind reine Ganzzahlarithmetik mit in C99 voll
+ * definiertem Verhalten (Division rundet gegen 0, keine Shifts
+ * negativer Werte) → bitgleich auf jedem Compiler und jeder CPU.
+ * --------------------------------------------------------------- */
+typedef int32_t fix_t;
+
+#define FIX_SHIFT  16
+#define FIX_ONE    ((fix_t)1 << FIX_SHIFT)
+#define FIX_HALF   (FIX_ONE / 2)
+#define FIX_MAX    INT32_MAX            /* steht für +∞ (Kontaktzeiten) */
+
+/* Ganzzahl → Q16.16 (Multiplikation statt Shift: negative Werte) */
+#define FIX_INT(i)   ((fix_t)((int32_t)(i) * FIX_ONE))
+/* Konstante aus config.h, zur Übersetzungszeit gerundet */
+#define FIX_CONST(f) ((fix_t)((f) * 65536.0 + ((f) >= 0 ? 0.5 : -0.5)))
+
+typedef struct
+{
+    fix_t x;
+    int   y;
+    int   width;
+    fix_t vx;
+    fix_t ax;
+} fix_paddle_t;
+
+typedef struct
+{
+    fix_t x;
+    fix_t y;
+    fix_t vx;
+    fix_t vy;
+} fix_ball_t;
+
+/* Produkt, Ergebnis gegen 0 gerundet */
+static inline fix_t fix_mul(fix_t a, fix_t b)
+{
+    int64_t p = (int64_t)a * b;
+    return (fix_t)(p / FIX_ONE);
+}
+
+/* Quotient, gegen 0 gerundet; Überlauf und b == 0 sättigen auf ±FIX_MAX */
+static inline fix_t fix_div(fix_t a, fix_t b)
+{
+    if (b == 0)
+        return a < 0 ? -FIX_MAX : FIX_MAX;
+    int64_t q = (int64_t)a * FIX_ONE / b;
+    if (q >  FIX_MAX) return  FIX_MAX;
+    if (q < -FIX_MAX) return -FIX_MAX;
+    return (fix_t)q;
+}
+
+static inline fix_t fix_abs(fix_t a) { return a < 0 ? -a : a; }
+static inline fix_t fix_min(fix_t a, fix_t b) { return a < b ? a : b; }
+static inline fix_t fix_max(fix_t a, fix_t b) { return a > b ? a : b; }
+
+/* Umrechnung float ↔ Q16.16 (für |v| < 256 verlustfrei hin und zurück) */
+fix_t fix_from_float(float f);
+float fix_to_float(fix_t v);
+
+uint32_t fix_isqrt64(uint64_t v);
+fix_t    fix_sqrt(fix_t a);
+fix_t    fix_hypot(fix_t a, fix_t b);
+fix_t    fix_root_frac(float a, unsigned n);   /* a^(1/n), 0 < a < 1 */
+
+void fix_ball_load(fix_ball_t *fb, const ball_t *b);
+void fix_ball_store(const fix_ball_t *fb, ball_t *b);
+void fix_paddle_load(fix_paddle_t *fp, const paddle_t *p);
+void fix_paddle_store(const fix_paddle_t *fp, paddle_t *p);
+
+void fix_update_paddle(fix_paddle_t *p, int dir, fix_t accel, fix_t v_max,
+                       int field_w);
+void fix_reflect_paddle(fix_ball_t *ball, const fix_paddle_t *p,
+                        int hits_since_reset);
+
+#endif /* FIXED_H */
@@ -0,0 +1,127 @@
+/* ------------------------------------------------------------------
+ * hist.c - Log-lineares Histogramm für Zeitmessungen
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ *
+ * Aufbau wie HdrHistogram: Der Eimer ergibt sich aus der Position
+ * des höchsten gesetzten Bits (Exponent) und den HIST_SUB_BITS Bits
+ * darunter (Mantisse). Perzentile werden als größter Wert des
+ * Eimers gemeldet, in dem der gesuchte Rang liegt.
+ * ------------------------------------------------------------------ */
+
+#include <string.h>
+#include "hist.h"
+
+/* ------------------------------------------------------------------
+ * msb64
+ * Position des höchsten gesetzten Bits.
+ *
+ * Parameter:
+ *   v – Wert > 0
+ *
+ * Rückgabe:
+ *   0 … 63
+ * ------------------------------------------------------------------ */
+static unsigned msb64(uint64_t v)
+{
+#if defined(__GNUC__)
+    return 63u - (unsigned)__builtin_clzll(v);
+#else
+    unsigned n = 0;
+    while (v >>= 1)
+        n++;
+    return n;
+#endif
+}
+
+/* ------------------------------------------------------------------
+ * hist_bucket / hist_bucket_high
+ * Eimer eines Werts bzw. größter Wert, der noch in den Eimer fällt.
+ *
+ * Parameter:
+ *   value  – Messwert
+ *   bucket – Eimer
+ *
+ * Rückgabe:
+ *   Eimer bzw. Wert
+ * ------------------------------------------------------------------ */
+unsigned hist_bucket(uint64_t value)
+{
+    if (value >= HIST_MAX_VALUE)
+        return HIST_BUCKETS - 1;
+    if (value < HIST_SUB_COUNT)
+        return (unsigned)value;
+    unsigned shift = msb64(value) - HIST_SUB_BITS;
+    unsigned sub   = (unsigned)(value >> shift) - HIST_SUB_COUNT;
+    return (shift + 1) * HIST_SUB_COUNT + sub;
+}
+
+uint64_t hist_bucket_high(unsigned bucket)
+{
+    if (bucket < HIST_SUB_COUNT)
+        return bucket;
+    unsigned shift = bucket / HIST_SUB_COUNT - 1;
+    uint64_t low   = (uint64_t)(HIST_SUB_COUNT + bucket % HIST_SUB_COUNT) << shift;
+    return low + ((uint64_t)1 << shift) - 1;
+}
+
+/* ------------------------------------------------------------------
+ * hist_reset / hist_record
+ * Leeren bzw. einen Wert eintragen.
+ *
+ * Parameter:
+ *   h     – Histogramm
+ *   value – Messwert (z. B. Nanosekunden)
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void hist_reset(hist_t *h)
+{
+    memset(h, 0, sizeof *h);
+    h->min = UINT64_MAX;
+}
+
+void hist_record(hist_t *h, uint64_t value)
+{
+    h->count[hist_bucket(value)]++;
+    h->total++;
+    h->sum += value;
+    if (value < h->min) h->min = value;
+    if (value > h->max) h->max = value;
+}
+
+/* ------------------------------------------------------------------
+ * hist_percentile
+ * Wert, unter dem p Prozent der Messungen liegen (Nearest-Rank).
+ *
+ * Parameter:
+ *   h – Histogramm
+ *   p – Perzentil 0…100
+ *
+ * Rückgabe:
+ *   Obergrenze des Eimers, höchstens max; 0 bei leerem Histogramm
+ * ------------------------------------------------------------------ */
+uint64_t hist_percentile(const hist_t *h, double p)
+{
+    if (h->total == 0)
+        return 0;
+    uint64_t rank = (uint64_t)(p / 100.0 * (double)h->total + 0.999999);
+    if (rank < 1)        rank = 1;
+    if (rank > h->total) rank = h->total;
+
+    uint64_t seen = 0;
+    for (unsigned b = 0; b < HIST_BUCKETS; ++b) {
+        seen += h->count[b];
+        if (seen >= rank) {
+            uint64_t v = hist_bucket_high(b);
+            return v < h->max ? v : h->max;
+        }
+    }
+    return h->max;
+}
+
+double hist_mean(const hist_t *h)
+{
+    return h->total ? (double)h->sum / (double)h->total : 0.0;
+}
@@ -0,0 +1,44 @@
+/* ------------------------------------------------------------------
+ * hist.h - Header des log-linearen Histogramms (HDR-Stil)
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#ifndef HIST_H
+#define HIST_H
+
+#include <stdint.h>
+
+/* ---------------------------------------------------------------
+ * Werte < 2^HIST_SUB_BITS landen exakt in einem eigenen Eimer,
+ * darüber teilt jede Zweierpotenz sich in 2^HIST_SUB_BITS gleich
+ * breite Eimer: relativer Fehler ≤ 2^-HIST_SUB_BITS (1,6 %) über
+ * den ganzen Bereich. Werte ab HIST_MAX_VALUE (2^40 ns ≈ 18 min)
+ * zählen im obersten Eimer; max bleibt exakt. Feste Größe, kein
+ * Heap, Eintragen ist O(1).
+ * --------------------------------------------------------------- */
+#define HIST_SUB_BITS   6
+#define HIST_SUB_COUNT  (1u << HIST_SUB_BITS)
+#define HIST_MAX_BITS   40
+#define HIST_MAX_VALUE  ((uint64_t)1 << HIST_MAX_BITS)
+#define HIST_BUCKETS    ((HIST_MAX_BITS - HIST_SUB_BITS + 1) * HIST_SUB_COUNT)
+
+typedef struct
+{
+    uint64_t count[HIST_BUCKETS];
+    uint64_t total;             /* Anzahl Werte  */
+    uint64_t sum;               /* für Mittelwert */
+    uint64_t min;
+    uint64_t max;
+} hist_t;
+
+void     hist_reset(hist_t *h);
+void     hist_record(hist_t *h, uint64_t value);
+uint64_t hist_percentile(const hist_t *h, double p);
+double   hist_mean(const hist_t *h);
+
+/* Eimer eines Werts bzw. größter Wert eines Eimers (für Tests offengelegt) */
+unsigned hist_bucket(uint64_t value);
+uint64_t hist_bucket_high(unsigned bucket);
+
+#endif /* HIST_H */
@@ -0,0 +1,117 @@
+/* ------------------------------------------------------------------
+ * hudstats.c - Gleitende Leistungsfenster für das HUD-Overlay
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ *
+ * Jeder Frame trägt einen Messwert in einen Ringpuffer fester Größe
+ * ein und verdrängt den ältesten; die Summen werden dabei in‑place
+ * fortgeschrieben. Es wird nie Speicher angefordert.
+ * ------------------------------------------------------------------ */
+
+#include <stdio.h>
+#include <string.h>
+#include "hudstats.h"
+
+/* ------------------------------------------------------------------
+ * hudstats_reset
+ * Leert das Fenster.
+ *
+ * Parameter:
+ *   w – Fenster
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void hudstats_reset(hudstats_t *w)
+{
+    memset(w, 0, sizeof *w);
+}
+
+/* ------------------------------------------------------------------
+ * hudstats_push
+ * Trägt einen Frame ein; bei vollem Fenster fällt der älteste aus
+ * den Summen heraus.
+ *
+ * Parameter:
+ *   w      – Fenster
+ *   sample – Messwerte des Frames
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void hudstats_push(hudstats_t *w, const hudstats_sample_t *sample)
+{
+    hudstats_sample_t *slot = &w->s[w->head];
+
+    if (w->count == HUDSTATS_WINDOW) {
+        w->sum_frame_ns -= slot->frame_ns;
+        w->sum_flush_ns -= slot->flush_ns;
+        w->sum_bytes    -= slot->bytes;
+        w->sum_ticks    -= slot->ticks;
+    } else {
+        w->count++;
+    }
+
+    *slot = *sample;
+    w->sum_frame_ns += sample->frame_ns;
+    w->sum_flush_ns += sample->flush_ns;
+    w->sum_bytes    += sample->bytes;
+    w->sum_ticks    += sample->ticks;
+    w->head = (w->head + 1) % HUDSTATS_WINDOW;
+}
+
+/* ------------------------------------------------------------------
+ * hudstats_summary
+ * Mittelwerte und Raten über das Fenster; leeres Fenster → Nullen.
+ *
+ * Parameter:
+ *   w   – Fenster
+ *   out – Ausgabe
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void hudstats_summary(const hudstats_t *w, hudstats_summary_t *out)
+{
+    memset(out, 0, sizeof *out);
+    if (w->count == 0)
+        return;
+
+    uint64_t worst = 0;
+    for (unsigned i = 0; i < w->count; ++i)
+        if (w->s[i].frame_ns > worst)
+            worst = w->s[i].frame_ns;
+
+    double n = (double)w->count;
+    out->ticks_per_frame = (double)w->sum_ticks / n;
+    out->frame_avg_ms    = (double)w->sum_frame_ns / n / 1e6;
+    out->frame_max_ms    = (double)worst / 1e6;
+    out->flush_avg_ms    = (double)w->sum_flush_ns / n / 1e6;
+    if (w->sum_frame_ns > 0) {
+        double secs = (double)w->sum_frame_ns / 1e9;
+        out->fps         = n / secs;
+        out->bytes_per_s = (double)w->sum_bytes / secs;
+    }
+}
+
+/* ------------------------------------------------------------------
+ * hudstats_format
+ * Baut die Overlay‑Zeile, z. B.
+ *   "60 fps  0.16 t/f  frame 16.7/18.2 ms  refresh 0.05 ms  1.2 kB/s"
+ *
+ * Parameter:
+ *   sum – Auswertung
+ *   buf – Zielpuffer
+ *   len – Größe des Puffers
+ *
+ * Rückgabe:
+ *   Länge wie snprintf
+ * ------------------------------------------------------------------ */
+int hudstats_format(const hudstats_summary_t *sum, char *buf, size_t len)
+{
+    return snprintf(buf, len,
+                    "%.0f fps  %.2f t/f  frame %.1f/%.1f ms  refresh %.2f ms  %.1f kB/s",
+                    sum->fps, sum->ticks_per_frame,
+                    sum->frame_avg_ms, sum->frame_max_ms,
+                    sum->flush_avg_ms, sum->bytes_per_s / 1000.0);
+}
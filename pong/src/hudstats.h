@@ -0,0 +1,56 @@
+/* ------------------------------------------------------------------
+ * hudstats.h - Header der gleitenden Leistungsfenster fürs HUD
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#ifndef HUDSTATS_H
+#define HUDSTATS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Frames im gleitenden Fenster (~1 s bei RENDER_DT_MS = 16) */
+#define HUDSTATS_WINDOW 64
+
+/* Messwerte eines Frames */
+typedef struct
+{
+    uint64_t frame_ns;      /* Abstand zum vorigen Frame             */
+    uint64_t flush_ns;      /* Zeit in refresh() bzw. write()        */
+    uint32_t bytes;         /* an das Terminal geschriebene Bytes    */
+    uint32_t ticks;         /* Physik‑Ticks in diesem Frame          */
+} hudstats_sample_t;
+
+/* Ringpuffer mit laufenden Summen; Ein‑ und Austragen in O(1),
+   nur das Maximum sucht über das (kleine) Fenster */
+typedef struct
+{
+    hudstats_sample_t s[HUDSTATS_WINDOW];
+    unsigned head;          /* nächster Schreibplatz                 */
+    unsigned count;         /* belegte Plätze                        */
+    uint64_t sum_frame_ns;
+    uint64_t sum_flush_ns;
+    uint64_t sum_bytes;
+    uint64_t sum_ticks;
+} hudstats_t;
+
+/* Auswertung des Fensters */
+typedef struct
+{
+    double fps;
+    double ticks_per_frame;
+    double frame_avg_ms;
+    double frame_max_ms;
+    double flush_avg_ms;
+    double bytes_per_s;
+} hudstats_summary_t;
+
+void hudstats_reset(hudstats_t *w);
+void hudstats_push(hudstats_t *w, const hudstats_sample_t *sample);
+void hudstats_summary(const hudstats_t *w, hudstats_summary_t *out);
+
+/* Einzeilige Anzeige; Rückgabe wie snprintf */
+int hudstats_format(const hudstats_summary_t *sum, char *buf, size_t len);
+
+#endif /* HUDSTATS_H */
@@ -6,22 +6,61 @@
 
 
 #include <ncurses.h>
+#include <unistd.h>
 #include "input.h"
 
+/* Aktive Eingabequelle */
+static input_source_t input_src = INPUT_SRC_NCURSES;
+
 /* ------------------------------------------------------------------
  * input_init
- * Initialisiert das Eingabemodul. Momentan sind keine zusätzlichen
- * Schritte nötig, der Platzhalter ermöglicht jedoch spätere Erweiterung.
+ * Initialisiert das Eingabemodul für die angegebene Quelle. Das
+ * Terminal selbst richtet der Renderer ein.
  *
  * Parameter:
- *   keine
+ *   src – INPUT_SRC_NCURSES, INPUT_SRC_RAW oder INPUT_SRC_NONE
  *
  * Rückgabe:
  *   keine
  * ------------------------------------------------------------------ */
-void input_init(void)
+void input_init(input_source_t src)
+{
+    input_src = src;
+}
+
+/* ------------------------------------------------------------------
+ * input_poll_raw
+ * Liest alle anstehenden Bytes von stdin (Terminal im Raw‑Modus mit
+ * VMIN = 0) und erkennt Pfeiltasten an ihren Escape‑Sequenzen.
+ *
+ * Parameter:
+ *   keine
+ *
+ * Rückgabe:
+ *   input_action_t – zuletzt gedrückte Richtung, Quit‑ und Key‑Flag
+ * ------------------------------------------------------------------ */
+static input_action_t input_poll_raw(void)
 {
-    /* Bislang keine zusätzliche Initialisierung nötig */
+    input_action_t action = {0, 0, 0, 0, 0};
+    unsigned char buf[64];
+    ssize_t n = read(STDIN_FILENO, buf, sizeof buf);
+
+    action.key = n > 0;
+    for (ssize_t i = 0; i < n; ++i) {
+        /* ESC [ C / ESC O C (Cursor-Tasten im Normal- bzw. App-Modus) */
+        if (buf[i] == 0x1b && i + 2 < n && (buf[i + 1] == '[' || buf[i + 1] == 'O')) {
+            if (buf[i + 2] == 'D') action.dx = -1;
+            if (buf[i + 2] == 'C') action.dx =  1;
+            i += 2;
+        } else if (buf[i] == 'q' || buf[i] == 'Q') {
+            action.quit = 1;
+        } else if (buf[i] == 'f' || buf[i] == 'F') {
+            action.perf = !action.perf;
+        } else {
+            action.ch = buf[i];
+        }
+    }
+    return action;
 }
 
 /* ------------------------------------------------------------------
@@ -33,13 +72,22 @@ void input_init(void)
  *   keine
  *
  * Rückgabe:
- *   input_action_t – Struktur mit dx-Bewegung (-1/0/+1) und
- *                   Quit-Flag (1 = Spiel beenden).
+ *   input_action_t – Struktur mit dx-Bewegung (-1/0/+1),
+ *                   Quit-Flag (1 = Spiel beenden) und Key-Flag
+ *                   (1 = irgendeine Taste gedrückt),
+ *                   Perf-Flag (1 = Leistungs-Overlay umschalten).
  * ------------------------------------------------------------------ */
 input_action_t input_poll(void)
 {
-    input_action_t action = {0, 0};
+    if (input_src == INPUT_SRC_RAW)
+        return input_poll_raw();
+
+    input_action_t action = {0, 0, 0, 0, 0};
+    if (input_src == INPUT_SRC_NONE)
+        return action;
+
     int ch = getch(); /* Lese gedrückte Taste (non-blocking) */
+    action.key = ch != ERR;
     
     switch (ch)
     {
@@ -53,7 +101,13 @@ input_action_t input_poll(void)
     case 'Q':
         action.quit = 1;
         break;
+    case 'f':
+    case 'F':
+        action.perf = 1;
+        break;
     default:
+        if (ch != ERR && ch < 256)
+            action.ch = ch;
         break;
     }
     
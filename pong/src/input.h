@@ -11,9 +11,19 @@ typedef struct
 {
     int dx;      /* -1 links, +1 rechts, 0 keine */
     int quit;    /* ungleich 0, wenn Benutzer abbrechen möchte */
+    int key;     /* ungleich 0, wenn irgendeine Taste gedrückt wurde */
+    int ch;      /* zuletzt gelesenes Zeichen (keine Pfeiltaste), sonst 0 */
+    int perf;    /* ungleich 0: Leistungs-Overlay umschalten (Taste f) */
 } input_action_t;
 
-void input_init(void);
+/* Woher die Tasten kommen – passend zum gewählten Renderer */
+typedef enum {
+    INPUT_SRC_NCURSES = 0,   /* getch() */
+    INPUT_SRC_RAW,           /* read() auf stdin, eigene Escape-Erkennung */
+    INPUT_SRC_NONE,          /* kein Terminal (Headless), nie eine Taste */
+} input_source_t;
+
+void input_init(input_source_t src);
 input_action_t input_poll(void);
 
 #endif /* INPUT_H */
@@ -0,0 +1,219 @@
+/* ------------------------------------------------------------------
+ * instr.c - Laufzeitmessung der Spielschleife
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ *
+ * Je Abschnitt ein Histogramm fester Größe (hist.h), Zeit aus
+ * CLOCK_MONOTONIC in Nanosekunden. Ausgegeben wird beim Beenden
+ * (instr_dump aus main) oder auf SIGUSR1; der Handler setzt nur ein
+ * Flag, geschrieben wird im nächsten Frame (instr_poll). SIGINT und
+ * SIGTERM beenden die Schleife regulär, damit das Terminal
+ * wiederhergestellt und die Messung geschrieben wird.
+ * ------------------------------------------------------------------ */
+
+#include <signal.h>
+#include <stdio.h>
+#include <time.h>
+#include "instr.h"
+
+static hist_t       phase_hist[INSTR_PHASES];
+static uint64_t     counters[INSTR_COUNTERS];
+static bool         phase_init;
+static const char  *dump_path = "pong_instr.txt";
+
+static volatile sig_atomic_t dump_pending;
+static volatile sig_atomic_t stop_pending;
+
+static const char *const phase_names[INSTR_PHASES] = {
+    "input", "ai_update", "physics", "render", "jitter", "frame",
+};
+
+static const char *const counter_names[INSTR_COUNTERS] = {
+    "ticks_dropped", "ticks_dilated", "deadline_misses",
+};
+
+/* ------------------------------------------------------------------
+ * instr_now_ns
+ * Monotone Zeit in Nanosekunden.
+ *
+ * Parameter:
+ *   keine
+ *
+ * Rückgabe:
+ *   Nanosekunden seit beliebigem Startpunkt
+ * ------------------------------------------------------------------ */
+uint64_t instr_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/* ------------------------------------------------------------------
+ * instr_reset / instr_record / instr_hist / instr_phase_name
+ * Histogramme leeren, Messwert eintragen bzw. auslesen.
+ *
+ * Parameter:
+ *   phase – Abschnitt
+ *   ns    – Dauer in Nanosekunden
+ *
+ * Rückgabe:
+ *   instr_hist: Histogramm des Abschnitts
+ * ------------------------------------------------------------------ */
+void instr_reset(void)
+{
+    for (int i = 0; i < INSTR_PHASES; ++i)
+        hist_reset(&phase_hist[i]);
+    for (int i = 0; i < INSTR_COUNTERS; ++i)
+        counters[i] = 0;
+    phase_init = true;
+}
+
+void instr_record(instr_phase_t phase, uint64_t ns)
+{
+    if (!phase_init)
+        instr_reset();
+    hist_record(&phase_hist[phase], ns);
+}
+
+const hist_t *instr_hist(instr_phase_t phase)
+{
+    if (!phase_init)
+        instr_reset();
+    return &phase_hist[phase];
+}
+
+const char *instr_phase_name(instr_phase_t phase)
+{
+    return phase_names[phase];
+}
+
+/* ------------------------------------------------------------------
+ * instr_count / instr_counter / instr_counter_name
+ * Zähler erhöhen bzw. auslesen.
+ *
+ * Parameter:
+ *   counter – Zähler
+ *   n       – Zuwachs
+ *
+ * Rückgabe:
+ *   instr_counter: aktueller Stand
+ * ------------------------------------------------------------------ */
+void instr_count(instr_counter_t counter, uint64_t n)
+{
+    if (!phase_init)
+        instr_reset();
+    counters[counter] += n;
+}
+
+uint64_t instr_counter(instr_counter_t counter)
+{
+    return counters[counter];
+}
+
+const char *instr_counter_name(instr_counter_t counter)
+{
+    return counter_names[counter];
+}
+
+/* ------------------------------------------------------------------
+ * instr_dump
+ * Schreibt je Abschnitt Anzahl, p50/p90/p99/p99.9, Maximum und
+ * Mittelwert in Nanosekunden als Tabelle, danach die Zähler.
+ *
+ * Parameter:
+ *   path – Zieldatei (NULL = zuletzt mit instr_init gesetzte)
+ *
+ * Rückgabe:
+ *   false, wenn die Datei nicht geschrieben werden konnte
+ * ------------------------------------------------------------------ */
+bool instr_dump(const char *path)
+{
+    FILE *f = fopen(path ? path : dump_path, "w");
+    if (!f)
+        return false;
+
+    fprintf(f, "# pong instrumentation, ns (log-linear histograms, <= %.1f %% error)\n",
+            100.0 / HIST_SUB_COUNT);
+    fprintf(f, "%-10s %10s %10s %10s %10s %10s %12s %12s\n",
+            "phase", "count", "p50", "p90", "p99", "p99.9", "max", "mean");
+    for (int i = 0; i < INSTR_PHASES; ++i) {
+        const hist_t *h = instr_hist((instr_phase_t)i);
+        fprintf(f, "%-10s %10llu %10llu %10llu %10llu %10llu %12llu %12.0f\n",
+                phase_names[i], (unsigned long long)h->total,
+                (unsigned long long)hist_percentile(h, 50.0),
+                (unsigned long long)hist_percentile(h, 90.0),
+                (unsigned long long)hist_percentile(h, 99.0),
+                (unsigned long long)hist_percentile(h, 99.9),
+                (unsigned long long)h->max, hist_mean(h));
+    }
+    fprintf(f, "\n%-16s %10s\n", "counter", "count");
+    for (int i = 0; i < INSTR_COUNTERS; ++i)
+        fprintf(f, "%-16s %10llu\n", counter_names[i],
+                (unsigned long long)counters[i]);
+    return fclose(f) == 0;
+}
+
+/* Signal-Handler: nur Flags setzen (async-signal-safe) */
+static void on_dump_signal(int sig)
+{
+    (void)sig;
+    dump_pending = 1;
+}
+
+static void on_stop_signal(int sig)
+{
+    (void)sig;
+    stop_pending = 1;
+}
+
+/* ------------------------------------------------------------------
+ * instr_init
+ * Setzt die Zieldatei und installiert die Signal-Handler.
+ *
+ * Parameter:
+ *   path – Zieldatei (NULL = "pong_instr.txt")
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void instr_init(const char *path)
+{
+    struct sigaction sa;
+
+    if (path)
+        dump_path = path;
+    instr_reset();
+
+    sigemptyset(&sa.sa_mask);
+    sa.sa_flags   = SA_RESTART;
+    sa.sa_handler = on_dump_signal;
+    sigaction(SIGUSR1, &sa, NULL);
+    sa.sa_handler = on_stop_signal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+}
+
+/* ------------------------------------------------------------------
+ * instr_poll / instr_stop_requested
+ * Einmal pro Frame: angeforderte Ausgabe schreiben bzw. abfragen,
+ * ob die Schleife beendet werden soll.
+ *
+ * Parameter:
+ *   keine
+ *
+ * Rückgabe:
+ *   instr_stop_requested: true nach SIGINT/SIGTERM
+ * ------------------------------------------------------------------ */
+void instr_poll(void)
+{
+    if (dump_pending) {
+        dump_pending = 0;
+        instr_dump(NULL);
+    }
+}
+
+bool instr_stop_requested(void)
+{
+    return stop_pending != 0;
+}
@@ -0,0 +1,67 @@
+/* ------------------------------------------------------------------
+ * instr.h - Header der Laufzeitmessung der Spielschleife
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#ifndef INSTR_H
+#define INSTR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "hist.h"
+
+/* Gemessene Abschnitte eines Frames */
+typedef enum {
+    INSTR_INPUT = 0,    /* input_poll bzw. Skript-Eingabe            */
+    INSTR_AI,           /* ai_update je Tick                         */
+    INSTR_PHYSICS,      /* physics_update_ball_events je Tick        */
+    INSTR_RENDER,       /* render_frame                              */
+    INSTR_JITTER,       /* Aufwachen nach der Frame-Deadline         */
+    INSTR_FRAME,        /* Arbeit eines Frames ohne Schlafen         */
+    INSTR_PHASES
+} instr_phase_t;
+
+/* Gezählte Ereignisse */
+typedef enum {
+    INSTR_TICKS_DROPPED = 0,  /* über die Nachhol-Grenze verworfen      */
+    INSTR_TICKS_DILATED,      /* durch Zeitdehnung ausgelassen          */
+    INSTR_DEADLINE_MISSES,    /* Frame-Arbeit über die Deadline hinaus  */
+    INSTR_COUNTERS
+} instr_counter_t;
+
+uint64_t      instr_now_ns(void);
+void          instr_record(instr_phase_t phase, uint64_t ns);
+const hist_t *instr_hist(instr_phase_t phase);
+const char   *instr_phase_name(instr_phase_t phase);
+void          instr_count(instr_counter_t counter, uint64_t n);
+uint64_t      instr_counter(instr_counter_t counter);
+const char   *instr_counter_name(instr_counter_t counter);
+void          instr_reset(void);
+
+bool instr_dump(const char *path);
+void instr_init(const char *path);
+void instr_poll(void);
+bool instr_stop_requested(void);
+
+/* ---------------------------------------------------------------
+ * Messpunkte: nur mit -DPONG_INSTRUMENT (make INSTRUMENT=1) aktiv.
+ * Sonst expandieren sie zu nichts – kein Uhrenaufruf, kein Code.
+ * --------------------------------------------------------------- */
+#ifdef PONG_INSTRUMENT
+#define INSTR_BEGIN(t)         uint64_t t = instr_now_ns()
+#define INSTR_END(phase, t)    instr_record((phase), instr_now_ns() - (t))
+#define INSTR_JITTER(ns)       instr_record(INSTR_JITTER, (ns))
+#define INSTR_COUNT(c, n)      instr_count((c), (n))
+#define INSTR_POLL()           instr_poll()
+#define INSTR_STOP()           instr_stop_requested()
+#else
+#define INSTR_BEGIN(t)
+#define INSTR_END(phase, t)
+#define INSTR_JITTER(ns)
+#define INSTR_COUNT(c, n)
+#define INSTR_POLL()
+#define INSTR_STOP()           false
+#endif
+
+#endif /* INSTR_H */
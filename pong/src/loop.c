@@ -0,0 +1,507 @@
+/* ------------------------------------------------------------------
+ * loop.c - Spielschleife mit festem Physik-Zeitschritt
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ *
+ * Countdown und Game Over sind zeitgesteuerte Zustände der Schleife
+ * statt blockierender Aufrufe: Eingabe und Rendering laufen in jedem
+ * Frame weiter, nur die Physik pausiert. Die Uhr zählt Nanosekunden;
+ * Frames folgen einem festen Raster absoluter Deadlines, geschlafen
+ * wird mit clock_nanosleep(TIMER_ABSTIME) bis zur nächsten.
+ * ------------------------------------------------------------------ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <time.h>
+#include "loop.h"
+#include "ai.h"
+#include "render.h"
+#include "config.h"
+#include "instr.h"
+#include "trace.h"
+#include "pmu.h"
+
+#define NS_PER_MS  1000000ull
+#define NS_PER_S   1000000000ull
+#define FRAME_NS   (RENDER_DT_MS * NS_PER_MS)
+
+/* Zeitbasis des Akkumulators: ns · Hz, TICK_UNITS davon sind genau
+   ein Tick – ohne Rundung für jede ganzzahlige Tickrate */
+#define TICK_UNITS NS_PER_S
+
+/* ------------------------------------------------------------------
+ * ns_now
+ * Liefert die monotone Zeit in Nanosekunden.
+ *
+ * Parameter:
+ *   keine
+ *
+ * Rückgabe:
+ *   Nanosekunden seit beliebigem Startpunkt
+ * ------------------------------------------------------------------ */
+static uint64_t ns_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * NS_PER_S + (uint64_t)ts.tv_nsec;
+}
+
+/* ------------------------------------------------------------------
+ * sleep_until
+ * Schläft bis zum absoluten Zeitpunkt (CLOCK_MONOTONIC). Signale
+ * unterbrechen nicht: der Schlaf wird mit demselben Ziel fortgesetzt.
+ *
+ * Parameter:
+ *   ns – Weckzeit wie ns_now()
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void sleep_until(uint64_t ns)
+{
+    struct timespec ts;
+    ts.tv_sec  = (time_t)(ns / NS_PER_S);
+    ts.tv_nsec = (long)(ns % NS_PER_S);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+        ;
+}
+
+/* Uhr der Konfiguration bzw. Systemuhr */
+static uint64_t clock_now(const loop_config_t *cfg)
+{
+    return cfg->clock ? cfg->clock->now(cfg->clock->user) : ns_now();
+}
+
+static void clock_sleep(const loop_config_t *cfg, uint64_t ns)
+{
+    if (cfg->clock)
+        cfg->clock->sleep_until(cfg->clock->user, ns);
+    else
+        sleep_until(ns);
+}
+
+/* ------------------------------------------------------------------
+ * pace_frame
+ * Wartet auf die Deadline des Frames und setzt die nächste ins feste
+ * Raster (Start + n · RENDER_DT_MS) – Arbeitszeit und Weckfehler
+ * summieren sich nicht auf. Die letzten spin_us vor der Deadline wird
+ * aktiv gewartet, um die Weck-Latenz des Schedulers zu umgehen. Ist
+ * die Deadline schon vorbei, zählt das als verpasst; die Schleife
+ * springt auf die nächste noch offene Deadline, statt verpasste Frames
+ * ohne Pause nachzuholen. Die Verspätung geht wie das Aufwachen in
+ * INSTR_JITTER ein, damit verpasste Frames die Verteilung nicht schönen.
+ *
+ * Parameter:
+ *   cfg      – Konfiguration (spin_us, clock)
+ *   deadline – Ein-/Ausgabe: Deadline dieses bzw. des nächsten Frames
+ *   res      – Zähler deadline_misses
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void pace_frame(const loop_config_t *cfg, uint64_t *deadline, loop_result_t *res)
+{
+    uint64_t now = clock_now(cfg);
+
+    if (now >= *deadline) {
+        res->deadline_misses++;
+        INSTR_COUNT(INSTR_DEADLINE_MISSES, 1);
+        INSTR_JITTER(now - *deadline);
+        do
+            *deadline += FRAME_NS;
+        while (*deadline <= now);
+        return;
+    }
+
+    uint64_t spin = (uint64_t)cfg->spin_us * 1000u;
+    if (*deadline - now > spin)
+        clock_sleep(cfg, *deadline - spin);
+    while ((now = clock_now(cfg)) < *deadline)
+        ;                                             /* Rest aktiv warten */
+    INSTR_JITTER(now - *deadline);
+    *deadline += FRAME_NS;
+}
+
+/* ------------------------------------------------------------------
+ * catchup_limit
+ * Höchstzahl Physik-Ticks je Frame: cfg->max_ticks oder die Ticks in
+ * LOOP_CATCHUP_MS, mindestens einer.
+ *
+ * Parameter:
+ *   cfg – Schleifen‑Konfiguration
+ *   hz  – Tickrate
+ *
+ * Rückgabe:
+ *   Ticks je Frame
+ * ------------------------------------------------------------------ */
+static unsigned long catchup_limit(const loop_config_t *cfg, unsigned long hz)
+{
+    unsigned long n = cfg->max_ticks ? cfg->max_ticks
+                                     : LOOP_CATCHUP_MS * NS_PER_MS * hz / TICK_UNITS;
+    return n > 0 ? n : 1;
+}
+
+/* ------------------------------------------------------------------
+ * catchup_drop
+ * Verwirft die ganzen Ticks, die nach max_ticks noch im Akkumulator
+ * stehen (LOOP_CATCHUP_DROP); der angebrochene Tick bleibt erhalten.
+ *
+ * Parameter:
+ *   acc – Akkumulator in ns·Hz
+ *   res – Zähler ticks_dropped
+ *
+ * Rückgabe:
+ *   neuer Akkumulator
+ * ------------------------------------------------------------------ */
+static uint64_t catchup_drop(uint64_t acc, loop_result_t *res)
+{
+    unsigned long left = (unsigned long)(acc / TICK_UNITS);
+
+    res->ticks_dropped += left;
+    INSTR_COUNT(INSTR_TICKS_DROPPED, left);
+    return acc - (uint64_t)left * TICK_UNITS;
+}
+
+/* ------------------------------------------------------------------
+ * dilate_frame
+ * Dehnt die Zeit eines zu langen Frames (LOOP_CATCHUP_DILATE): die
+ * Spielzeit rückt höchstens um max_ticks Ticks vor, der Rest der
+ * Wanduhr wird nie nachgeholt – das Spiel läuft in diesem Frame
+ * langsamer. Die ausgelassenen Ticks zählen einmal, sobald ein ganzer
+ * zusammenkommt.
+ *
+ * Parameter:
+ *   frame_ns  – Dauer des Frames
+ *   max_ticks – Ticks je Frame
+ *   hz        – Tickrate
+ *   skipped   – Ein-/Ausgabe: ausgelassene Zeit in ns·Hz, < TICK_UNITS
+ *   res       – Zähler ticks_dilated
+ *
+ * Rückgabe:
+ *   gutgeschriebene Spielzeit in ns
+ * ------------------------------------------------------------------ */
+static uint64_t dilate_frame(uint64_t frame_ns, unsigned long max_ticks,
+                             unsigned long hz, uint64_t *skipped, loop_result_t *res)
+{
+    uint64_t max_ns = (uint64_t)max_ticks * NS_PER_S / hz;
+    if (frame_ns <= max_ns)
+        return frame_ns;
+
+    *skipped += (frame_ns - max_ns) * hz;
+    unsigned long n = (unsigned long)(*skipped / TICK_UNITS);
+    *skipped -= (uint64_t)n * TICK_UNITS;
+    res->ticks_dilated += n;
+    INSTR_COUNT(INSTR_TICKS_DILATED, n);
+    return max_ns;
+}
+
+/* ------------------------------------------------------------------
+ * loop_run
+ * Führt die Spielschleife aus: Eingabe, Physik im festen Zeitschritt,
+ * Rendern. Die Tickrate kommt aus physics_tick_rate(). Die Eingabe
+ * wird je Frame abgetastet; eine Richtung treibt das Paddle für die
+ * Ticks der folgenden INPUT_HOLD_MS (mindestens einen), eine neue
+ * Richtung ersetzt sie. Spieler, Bot und Ball bewegen sich nur im
+ * Tick – das Ergebnis hängt nicht von der Bildrate ab. Nach einem
+ * Punkt läuft ein Countdown über COUNTDOWN_STEPS * COUNTDOWN_DELAY_MS,
+ * währenddessen ist die Physik pausiert und der Akkumulator bleibt
+ * leer – es gibt danach keinen Nachhol‑Burst. Nur der Spieler bewegt
+ * sich weiter, im Tick‑Raster ab dem Punkt. Bei Game Over bleibt die
+ * Meldung stehen, bis eine Taste gedrückt wird (headless: sofort
+ * Ende). Gezeichnet wird zwischen dem Zustand vor und nach dem letzten
+ * Tick, gewichtet mit dem Rest im Akkumulator; über Neuaufschlag und
+ * Spielende hinweg wird nicht interpoliert. Je Frame laufen höchstens
+ * catchup_limit() Ticks; was nach einem Hänger (angehaltene Sitzung,
+ * ausgelagerter Prozess) darüber hinaus fällig wäre, behandelt
+ * cfg->catchup – so schaukelt sich die Nachholarbeit auf einem
+ * überlasteten Rechner nicht auf. DILATE dehnt dafür die Spielzeit
+ * selbst (dilate_frame), auch der Countdown folgt ihr; bei DROP läuft
+ * sie mit der Uhr. Mit Terminal wartet jeder Frame auf
+ * seine Deadline im Raster von RENDER_DT_MS (pace_frame).
+ *
+ * Parameter:
+ *   game – Spielzustand (wird fortgeschrieben)
+ *   cfg  – Schleifen‑Konfiguration
+ *   res  – Ausgabe: Statistik und Endzustand
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void loop_run(game_state_t *game, const loop_config_t *cfg, loop_result_t *res)
+{
+    loop_state_t  state       = LOOP_PLAYING;
+    uint64_t      state_since = 0;                            /* Eintrittszeit des Zustands */
+    uint64_t      game_now    = 0;                            /* Spielzeit, bei DILATE gedehnt */
+    uint64_t      skipped     = 0;                            /* DILATE: ausgelassen, ns·Hz */
+    uint64_t      last_time   = cfg->headless ? 0 : clock_now(cfg);
+    uint64_t      deadline    = last_time + FRAME_NS;         /* Ende des ersten Frames */
+    unsigned long hz          = physics_tick_rate();
+    uint64_t      phys_acc    = 0;                            /* Akkumulator in ns·Hz */
+    unsigned long cd_ticks    = 0;                            /* Spieler‑Ticks im Countdown */
+    unsigned long cd_max      = COUNTDOWN_STEPS * COUNTDOWN_DELAY_MS * NS_PER_MS * hz / TICK_UNITS;
+    int           tick_dx     = 0;                            /* Befehl für die nächsten Ticks */
+    unsigned long hold        = 0;                            /* davon noch offene Ticks */
+    unsigned long hold_ticks  = INPUT_HOLD_MS * NS_PER_MS * hz / TICK_UNITS;
+    uint64_t      frame_dt    = (cfg->frame_ms ? cfg->frame_ms : RENDER_DT_MS) * NS_PER_MS;
+    unsigned long max_ticks   = catchup_limit(cfg, hz);
+    render_pose_t prev        = render_pose_of(game);         /* Positionen vor dem letzten Tick */
+
+    *res = (loop_result_t){0};
+
+    /* Haupt-Spielschleife */
+    while (cfg->max_frames == 0 || res->frames < cfg->max_frames)
+    {
+        INSTR_BEGIN(t_frame);
+        trace_begin("frame");
+
+        /* Eingabe verarbeiten – in jedem Zustand */
+        INSTR_BEGIN(t_input);
+        trace_begin("input");
+        input_action_t action = cfg->poll ? cfg->poll(cfg->user)
+                                          : input_poll();    /* Liest aktuelle Tastatureingaben */
+        trace_end("input");
+        INSTR_END(INSTR_INPUT, t_input);
+        if (action.quit || INSTR_STOP()) {
+            res->quit = true;
+            break;
+        }
+        if (action.perf)
+            render_perf_toggle();
+        if (action.dx != 0) {
+            tick_dx = action.dx;                              /* für die nächsten Ticks halten */
+            hold    = hold_ticks > 0 ? hold_ticks : 1;
+        }
+
+        uint64_t now      = cfg->headless ? last_time + frame_dt : clock_now(cfg);
+        uint64_t frame_ns = now - last_time;
+        last_time = now;
+        if (cfg->catchup == LOOP_CATCHUP_DILATE && state != LOOP_GAME_OVER)
+            frame_ns = dilate_frame(frame_ns, max_ticks, hz, &skipped, res);
+        game_now += frame_ns;
+
+        physics_event_t last_events = PHYS_EVENT_NONE;
+        unsigned long   frame_ticks = 0;
+        float           alpha       = 0.0f;                   /* angebrochener Tick fürs Zwischenbild */
+
+        switch (state)
+        {
+        case LOOP_GAME_OVER:
+            if (action.key || cfg->headless)
+                goto done;
+            break;
+
+        case LOOP_COUNTDOWN: {
+            /* Spieler darf sich schon bewegen – im Tick‑Raster ab dem Punkt */
+            uint64_t      units = (game_now - state_since) * hz;
+            unsigned long due   = (unsigned long)(units / TICK_UNITS);
+            if (due > cd_max)
+                due = cd_max;
+            for (; cd_ticks < due; ++cd_ticks) {
+                prev = render_pose_of(game);
+                physics_player_update(game, tick_dx);
+                replay_rec_input(cfg->record, tick_dx);
+                if (hold > 0 && --hold == 0)
+                    tick_dx = 0;
+            }
+
+            uint64_t step = (game_now - state_since) / (COUNTDOWN_DELAY_MS * NS_PER_MS);
+            if (step < COUNTDOWN_STEPS) {
+                render_countdown(COUNTDOWN_STEPS - (int)step);
+                alpha = (float)(units % TICK_UNITS) / TICK_UNITS;
+                break;
+            }
+            /* Countdown vorbei: Physik startet mit leerem Akkumulator */
+            render_countdown(0);
+            trace_async_end("countdown");
+            state       = LOOP_PLAYING;
+            phys_acc    = 0;
+            prev        = render_pose_of(game);
+            break;
+        }
+
+        case LOOP_PLAYING:
+            /* Fix‑Timestep Physik: in Scheiben von 1/hz Sekunden nachholen */
+            phys_acc += frame_ns * hz;
+            while (phys_acc >= TICK_UNITS) {
+                if (frame_ticks == max_ticks) {
+                    phys_acc = catchup_drop(phys_acc, res);
+                    break;
+                }
+                phys_acc -= TICK_UNITS;
+                prev = render_pose_of(game);
+                trace_begin("physics");
+                physics_player_update(game, tick_dx);         /* Spieler‑Paddle mit dem gehaltenen Befehl */
+                replay_rec_input(cfg->record, tick_dx);
+                if (hold > 0 && --hold == 0)
+                    tick_dx = 0;
+                INSTR_BEGIN(t_ai);
+                pmu_begin(PMU_AI);
+                ai_update(game);
+                pmu_end(PMU_AI);
+                INSTR_END(INSTR_AI, t_ai);
+                INSTR_BEGIN(t_phys);
+                pmu_begin(PMU_PHYSICS);
+                last_events |= physics_update_ball_events(game);
+                pmu_end(PMU_PHYSICS);
+                INSTR_END(INSTR_PHYSICS, t_phys);
+                replay_rec_tick(cfg->record, game);
+                frame_ticks++;
+                trace_end("physics");
+
+                if (last_events & PHYS_EVENT_GAME_OVER) {
+                    state = LOOP_GAME_OVER;
+                    prev  = render_pose_of(game);
+                    render_game_over(true);
+                    break;
+                }
+                if (last_events & PHYS_EVENT_SCORED) {
+                    /* Physik explizit pausieren, Rest verwerfen */
+                    state       = LOOP_COUNTDOWN;
+                    state_since = game_now;
+                    phys_acc    = 0;
+                    cd_ticks    = 0;
+                    prev        = render_pose_of(game);        /* kein Zwischenbild über den Neuaufschlag */
+                    render_countdown(COUNTDOWN_STEPS);
+                    trace_async_begin("countdown");
+                    break;
+                }
+            }
+            /* nach Game Over kann mehr als ein Tick übrig sein */
+            alpha = phys_acc < TICK_UNITS ? (float)phys_acc / TICK_UNITS : 1.0f;
+            break;
+        }
+
+        res->ticks += frame_ticks;
+        if (frame_ticks > res->max_ticks_per_frame)
+            res->max_ticks_per_frame = frame_ticks;
+
+        /* Zeichnet das Spielfeld zwischen den letzten beiden Ticks samt Overlays */
+        INSTR_BEGIN(t_render);
+        trace_begin("render");
+        render_perf_ticks(frame_ticks);
+        pmu_begin(PMU_RENDER);
+        render_frame_lerp(&prev, game, alpha, last_events);
+        pmu_end(PMU_RENDER);
+        trace_end("render");
+        INSTR_END(INSTR_RENDER, t_render);
+        INSTR_END(INSTR_FRAME, t_frame);
+        trace_end("frame");
+        INSTR_POLL();
+
+        res->frames++;
+        if (!cfg->headless) {
+            trace_begin("sleep");
+            pace_frame(cfg, &deadline, res);
+            trace_end("sleep");
+        }
+    }
+
+done:
+    if (state == LOOP_COUNTDOWN)
+        trace_async_end("countdown");
+    res->state = state;
+    render_countdown(0);
+    render_game_over(false);
+}
+
+/* ------------------------------------------------------------------
+ * loop_view
+ * Spielt eine Aufzeichnung im Takt der Physik ab. Tasten:
+ *   Leertaste  Pause           +/-   Zeitraffer verdoppeln/halbieren
+ *   ← / →      VIEW_SKIP_MS zurück bzw. vor
+ *   p / n      vorheriger bzw. nächster Punkt (PHYS_EVENT_SCORED)
+ *   f          Leistungs‑Overlay ein/aus
+ * Headless endet die Schleife mit der Aufzeichnung, sonst bleibt das
+ * letzte Bild stehen, bis beendet wird. Je Frame laufen höchstens
+ * catchup_limit() · Zeitraffer Ticks, der Rest wird verworfen.
+ *
+ * Parameter:
+ *   view – geöffnete Aufzeichnung
+ *   cfg  – Schleifen‑Konfiguration (record wird ignoriert)
+ *   res  – Ausgabe: Statistik; state = LOOP_GAME_OVER am Ende
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void loop_view(replay_view_t *view, const loop_config_t *cfg, loop_result_t *res)
+{
+    uint64_t      last_time = cfg->headless ? 0 : clock_now(cfg);
+    uint64_t      deadline  = last_time + FRAME_NS;
+    unsigned long hz        = physics_tick_rate();           /* aus dem Kopf der Aufzeichnung */
+    unsigned long skip      = VIEW_SKIP_MS * NS_PER_MS * hz / TICK_UNITS;
+    unsigned long max_ticks = catchup_limit(cfg, hz);
+    uint64_t      acc       = 0;                            /* ns·Hz wie in loop_run */
+    unsigned long speed     = 1;
+    bool          paused    = false;
+
+    *res = (loop_result_t){0};
+
+    while (cfg->max_frames == 0 || res->frames < cfg->max_frames)
+    {
+        input_action_t action = cfg->poll ? cfg->poll(cfg->user)
+                                          : input_poll();
+        if (action.quit) {
+            res->quit = true;
+            break;
+        }
+        if (action.perf)
+            render_perf_toggle();
+
+        uint64_t now      = cfg->headless ? last_time + FRAME_NS : clock_now(cfg);
+        uint64_t frame_ns = now - last_time;
+        last_time = now;
+
+        physics_event_t events      = PHYS_EVENT_NONE;
+        unsigned long   frame_ticks = 0;
+
+        switch (action.ch) {
+        case ' ': paused = !paused;                              break;
+        case '+': if (speed < VIEW_MAX_SPEED) speed *= 2;        break;
+        case '-': if (speed > 1) speed /= 2;                     break;
+        case 'n':
+            if (replay_view_next_event(view, PHYS_EVENT_SCORED))
+                events |= PHYS_EVENT_SCORED;
+            break;
+        case 'p':
+            if (replay_view_prev_event(view, PHYS_EVENT_SCORED))
+                events |= PHYS_EVENT_SCORED;
+            break;
+        default:
+            break;
+        }
+        if (action.dx > 0)
+            replay_view_seek(view, view->tick + skip);
+        else if (action.dx < 0)
+            replay_view_seek(view, view->tick > skip ? view->tick - skip : 0);
+
+        /* Abspielen im Fix‑Timestep, Zeitraffer skaliert die Uhr */
+        if (paused || view->done) {
+            acc = 0;
+        } else {
+            acc += frame_ns * speed * hz;
+            while (acc >= TICK_UNITS && !view->done) {
+                if (frame_ticks == max_ticks * speed) {
+                    acc = catchup_drop(acc, res);
+                    break;
+                }
+                acc -= TICK_UNITS;
+                events |= replay_view_step(view);
+                frame_ticks++;
+            }
+        }
+
+        res->ticks += frame_ticks;
+        if (frame_ticks > res->max_ticks_per_frame)
+            res->max_ticks_per_frame = frame_ticks;
+
+        render_perf_ticks(frame_ticks);
+        render_frame(&view->game, events);
+        res->frames++;
+        if (view->done && cfg->headless)
+            break;
+        if (!cfg->headless)
+            pace_frame(cfg, &deadline, res);
+    }
+
+    res->state = view->done ? LOOP_GAME_OVER : LOOP_PLAYING;
+}
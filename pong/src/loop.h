@@ -0,0 +1,85 @@
+/* ------------------------------------------------------------------
+ * loop.h - Header der Spielschleife
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#ifndef LOOP_H
+#define LOOP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "input.h"
+#include "physics.h"
+#include "replay.h"
+
+/* Physik‑Takt: physics_tick_rate() (config.h, PHYSICS_HZ_*) */
+#define RENDER_DT_MS  16    /* Render‑Ziel ~60 FPS */
+
+#define LOOP_SPIN_MAX_US 2000 /* Obergrenze für --spin                 */
+#define LOOP_CATCHUP_MS 250  /* höchstens so viel Spielzeit je Frame nachholen */
+
+#define VIEW_SKIP_MS    10000 /* Replay‑Viewer: Pfeiltasten springen 10 s */
+#define VIEW_MAX_SPEED  64    /* Replay‑Viewer: höchster Zeitraffer      */
+
+/* Zustände der UI zwischen den Physik‑Phasen */
+typedef enum {
+    LOOP_PLAYING = 0,   /* Physik läuft                              */
+    LOOP_COUNTDOWN,     /* nach einem Punkt, Physik pausiert         */
+    LOOP_GAME_OVER,     /* Meldung sichtbar, wartet auf Tastendruck  */
+} loop_state_t;
+
+/* Umgang mit Zeit, die über LOOP_CATCHUP_MS hinaus nachzuholen wäre */
+typedef enum {
+    LOOP_CATCHUP_DROP = 0,  /* Ticks über der Grenze verwerfen, Spielzeit
+                               (Countdown) läuft mit der Uhr weiter       */
+    LOOP_CATCHUP_DILATE,    /* Frame-Zeit auf die Grenze kürzen: Spielzeit
+                               samt Countdown läuft langsamer, ohne
+                               späteres Nachholen                         */
+} loop_catchup_t;
+
+/* Uhr der Schleife mit Terminal; ohne Angabe CLOCK_MONOTONIC und
+   clock_nanosleep. Tests setzen eine virtuelle Uhr ein. */
+typedef struct
+{
+    uint64_t (*now)(void *user);                    /* ns, monoton    */
+    void     (*sleep_until)(void *user, uint64_t ns); /* absolut, ns  */
+    void     *user;
+} loop_clock_t;
+
+typedef struct
+{
+    bool          headless;     /* virtuelle Uhr, kein Schlafen           */
+    unsigned long max_frames;   /* 0 = bis Quit bzw. Spielende            */
+    unsigned long frame_ms;     /* headless: Frame‑Dauer, 0 = RENDER_DT_MS */
+    unsigned long max_ticks;    /* Ticks je Frame, 0 = LOOP_CATCHUP_MS    */
+    loop_catchup_t catchup;     /* Rest über max_ticks                    */
+    unsigned long spin_us;      /* vor jeder Frame‑Deadline aktiv warten  */
+
+    /* Optionale Eingabequelle statt input_poll() (Tests, Skripte)      */
+    input_action_t (*poll)(void *user);
+    void          *user;
+
+    /* Optionale Aufzeichnung aller Eingaben und Ticks (NULL = aus)      */
+    replay_rec_t  *record;
+
+    /* Optionale Uhr fürs Pacing (NULL = Systemuhr, headless ungenutzt)  */
+    const loop_clock_t *clock;
+} loop_config_t;
+
+typedef struct
+{
+    unsigned long frames;       /* gerenderte Frames                      */
+    unsigned long ticks;        /* ausgeführte Physik‑Ticks               */
+    unsigned long max_ticks_per_frame;
+    unsigned long ticks_dropped;  /* verworfene Ticks (Nachhol‑Grenze)    */
+    unsigned long ticks_dilated;  /* durch Zeitdehnung ausgelassene Ticks */
+    unsigned long deadline_misses;/* Frames, die ihre Deadline verfehlten */
+    loop_state_t  state;        /* Zustand beim Verlassen der Schleife    */
+    bool          quit;         /* vom Benutzer abgebrochen               */
+} loop_result_t;
+
+void loop_run(game_state_t *game, const loop_config_t *cfg, loop_result_t *res);
+void loop_view(replay_view_t *view, const loop_config_t *cfg, loop_result_t *res);
+
+#endif /* LOOP_H */
@@ -1,68 +1,197 @@
 /* ------------------------------------------------------------------
- * main.c - Hauptprogramm und Spielschleife für Console Pong
+ * main.c - Hauptprogramm für Console Pong
  * Copyright 2025 Hochschule Hannover
  * Autor: Mats-Luca Dagott
  * ------------------------------------------------------------------ */
 
-#include <ncurses.h>
+#include <limits.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
-#include <time.h>
+#include <string.h>
 #include <stdio.h>
 #include <locale.h>
+#include <time.h>
 
 #include "input.h"   /* Modul für Tastatureingaben des Spielers */
-#include "ai.h"      /* Einfache KI zur Steuerung des Bot‑Schlägers */
 #include "physics.h" /* Kollisionsabfragen und Bewegungen von Ball und Schlägern */
 #include "render.h"  /* Zeichnet das Spielfeld und die Statusanzeige */
-#include "cleanup.h" /* Beendet ncurses sicher und räumt Ressourcen auf */
+#include "loop.h"    /* Spielschleife mit festem Physik‑Zeitschritt */
 #include "config.h"  /* Globale Spielkonstanten  */
+#include "farm.h"    /* Headless-Massensimulation auf mehreren Threads */
+#include "ai.h"      /* Bot-Verhalten */
+#include "replay.h"  /* Aufzeichnung und Wiedergabe von Eingaben */
+#include "instr.h"   /* Laufzeitmessung (make INSTRUMENT=1) */
+#include "trace.h"   /* Zeitleiste der Frame-Abschnitte (--trace) */
+#include "pmu.h"     /* Hardware-Zähler je Region (--pmu) */
 
-#define PHYSICS_DT_MS 100   /* Fester Physik‑Zeitschritt ~10 Hz (ursprüngliches Tempo) */
-#define RENDER_DT_MS  16    /* Render‑Ziel ~60 FPS */
+/* Kommandozeilenoptionen */
+typedef struct
+{
+    unsigned long max_frames;   /* --frames                        */
+    loop_catchup_t catchup;     /* --catchup: Rest nach Hängern    */
+    unsigned long spin_us;      /* --spin: aktiv warten vor Deadline */
+    bool          farm;         /* --farm: Headless-Massensimulation */
+    farm_config_t farm_cfg;
+    const char   *record;       /* --record: Eingaben aufzeichnen    */
+    const char   *replay;       /* --replay: Aufzeichnung abspielen  */
+    const char   *view;         /* --view: Aufzeichnung ansehen      */
+    const char   *instr;        /* --instr: Ziel der Laufzeitmessung */
+    const char   *trace;        /* --trace: Chrome-Trace-Datei       */
+    bool          pmu;          /* --pmu: Zähler je Region ausgeben  */
+} options_t;
 
 /* ------------------------------------------------------------------
- * sleep_ms
- * Pausiert das Programm um die angegebene Anzahl Millisekunden.
+ * parse_number
+ * Liest eine vorzeichenlose Dezimalzahl vollständig ein.
  *
  * Parameter:
- *   ms – Verzögerung in Millisekunden
+ *   val – Text
+ *   out – Ausgabe
  *
  * Rückgabe:
- *   keine
+ *   true, wenn val eine gültige Zahl ist
  * ------------------------------------------------------------------ */
-static void sleep_ms(unsigned int ms)
+static bool parse_number(const char *val, unsigned long *out)
 {
-    struct timespec ts;
-    ts.tv_sec = ms / 1000;
-    ts.tv_nsec = (ms % 1000) * 1000000;
-    nanosleep(&ts, NULL);
+    char *end;
+    *out = strtoul(val, &end, 10);
+    return *val != '\0' && *end == '\0';
 }
 
 /* ------------------------------------------------------------------
- * ms_now
- * Liefert die seit Programmstart vergangene Zeit in Millisekunden.
+ * parse_args
+ * Wertet die Kommandozeile aus:
+ *   --render ncurses|raw|null|grid   Ausgabe‑Backend
+ *   --frames N                       nach N Frames beenden (0 = nie)
+ *   --fixed                          Festkomma-Physik (bitgleich)
+ *   --hz N                           Physik-Ticks pro Sekunde
+ *                                    (PHYSICS_HZ_MIN … PHYSICS_HZ_MAX)
+ *   --catchup drop|dilate            Ticks über LOOP_CATCHUP_MS verwerfen
+ *                                    bzw. Spielzeit langsamer laufen lassen
+ *   --spin US                        die letzten US µs vor jeder Frame-
+ *                                    Deadline aktiv warten (≤ LOOP_SPIN_MAX_US)
+ *   --ai chase|predict               Bot folgt Ball bzw. Auftreffpunkt
+ *   --record DATEI                   Eingaben und Ticks aufzeichnen
+ *   --replay DATEI                   Aufzeichnung headless abspielen
+ *   --view DATEI                     Aufzeichnung ansehen (Spulen, Springen)
+ *   --instr DATEI                    Ziel der Laufzeit-Histogramme
+ *                                    (nur mit make INSTRUMENT=1)
+ *   --trace DATEI                    Zeitleiste als Chrome-Trace-JSON
+ *   --pmu                            Zyklen/IPC/Misses von KI, Physik und
+ *                                    Rendern am Ende auf stderr
+ *   --farm                           Headless-Farm statt Spiel, dazu:
+ *     --games N --ticks M --seed S --threads T --chunk C
+ *     --engine scalar|batch --pin
+ * Optionen mit Wert auch in der Form "--opt=wert".
  *
  * Parameter:
- *   keine
+ *   argc, argv – Kommandozeile
+ *   opt        – Ausgabe: erkannte Optionen
  *
  * Rückgabe:
- *   Aktuelle Zeit in Millisekunden (unsigned long)
+ *   true bei gültigen Argumenten
  * ------------------------------------------------------------------ */
-static unsigned long ms_now(void)
+static bool parse_args(int argc, char *argv[], options_t *opt)
 {
-    struct timespec ts;
-    clock_gettime(CLOCK_MONOTONIC, &ts);
-    return (unsigned long)(ts.tv_sec * 1000UL + ts.tv_nsec / 1000000UL);
+    memset(opt, 0, sizeof *opt);
+    farm_config_defaults(&opt->farm_cfg);
+
+    for (int i = 1; i < argc; ++i) {
+        const char *name = argv[i];
+        const char *val  = strchr(name, '=');
+        size_t      len  = val ? (size_t)(val - name) : strlen(name);
+        unsigned long n;
+
+        /* Schalter ohne Wert */
+        if (!val && strcmp(name, "--farm") == 0) { opt->farm = true;         continue; }
+        if (!val && strcmp(name, "--pin") == 0)  { opt->farm_cfg.pin = true; continue; }
+        if (!val && strcmp(name, "--pmu") == 0)  { opt->pmu = true;          continue; }
+        if (!val && strcmp(name, "--fixed") == 0) {
+            physics_set_numeric(PHYS_NUMERIC_FIXED);
+            continue;
+        }
+
+        if (val)
+            val++;
+        else if (i + 1 < argc)
+            val = argv[++i];
+        else
+            return false;
+
+#define OPT_IS(s) (len == sizeof(s) - 1 && strncmp(name, s, len) == 0)
+        if (OPT_IS("--render")) {
+            if (!render_select(val))
+                return false;
+        } else if (OPT_IS("--frames")) {
+            if (!parse_number(val, &opt->max_frames))
+                return false;
+        } else if (OPT_IS("--hz")) {
+            if (!parse_number(val, &n) || n > PHYSICS_HZ_MAX ||
+                !physics_set_tick_rate((unsigned)n))
+                return false;
+        } else if (OPT_IS("--catchup")) {
+            if (strcmp(val, "drop") == 0)        opt->catchup = LOOP_CATCHUP_DROP;
+            else if (strcmp(val, "dilate") == 0) opt->catchup = LOOP_CATCHUP_DILATE;
+            else return false;
+        } else if (OPT_IS("--spin")) {
+            if (!parse_number(val, &opt->spin_us) || opt->spin_us > LOOP_SPIN_MAX_US)
+                return false;
+        } else if (OPT_IS("--ai")) {
+            ai_config_t ai;
+            ai_config_defaults(&ai);
+            if (strcmp(val, "chase") == 0)        ai.mode = AI_MODE_CHASE;
+            else if (strcmp(val, "predict") == 0) ai.mode = AI_MODE_PREDICT;
+            else return false;
+            ai_configure(&ai);
+        } else if (OPT_IS("--record")) {
+            opt->record = val;
+        } else if (OPT_IS("--replay")) {
+            opt->replay = val;
+        } else if (OPT_IS("--view")) {
+            opt->view = val;
+        } else if (OPT_IS("--instr")) {
+            opt->instr = val;
+        } else if (OPT_IS("--trace")) {
+            opt->trace = val;
+        } else if (OPT_IS("--games")) {
+            if (!parse_number(val, &n) || n < 1 || n > INT_MAX)
+                return false;
+            opt->farm_cfg.games = (int)n;
+        } else if (OPT_IS("--ticks")) {
+            if (!parse_number(val, &opt->farm_cfg.ticks))
+                return false;
+        } else if (OPT_IS("--seed")) {
+            if (!parse_number(val, &n) || n > UINT32_MAX)
+                return false;
+            opt->farm_cfg.seed = (uint32_t)n;
+        } else if (OPT_IS("--threads")) {
+            if (!parse_number(val, &n) || n > 1024)
+                return false;
+            opt->farm_cfg.threads = (int)n;
+        } else if (OPT_IS("--chunk")) {
+            if (!parse_number(val, &n) || n > INT_MAX)
+                return false;
+            opt->farm_cfg.chunk = (int)n;
+        } else if (OPT_IS("--engine")) {
+            if (strcmp(val, "scalar") == 0)     opt->farm_cfg.engine = FARM_ENGINE_SCALAR;
+            else if (strcmp(val, "batch") == 0) opt->farm_cfg.engine = FARM_ENGINE_BATCH;
+            else return false;
+        } else {
+            return false;
+        }
+#undef OPT_IS
+    }
+    return true;
 }
 
 /* ------------------------------------------------------------------
  * main
  * Initialisiert das Spiel, führt die Haupt‑Spielschleife aus und
- * räumt am Ende die Ressourcen mittels ncurses‑Cleanup auf.
+ * stellt am Ende den Terminalzustand wieder her.
  *
  * Parameter:
- *   argc, argv – werden nicht ausgewertet
+ *   argc, argv – siehe parse_args
  *
  * Rückgabe:
  *   EXIT_SUCCESS oder EXIT_FAILURE
@@ -70,95 +199,193 @@ static unsigned long ms_now(void)
 int main(int argc, char *argv[])
 {
     setlocale(LC_ALL, "");   /* Aktiviert Unicode‑Ausgabe im Terminal */
-    (void)argc;
-    (void)argv;
-
-    srand((unsigned)time(NULL));    /* Initialisiert den Zufallszahl‑Generator */
-
-    initscr();
-    cbreak();
-    noecho();
-    keypad(stdscr, TRUE);
-    nodelay(stdscr, TRUE);
-    curs_set(0);
-
-    /* Farben, falls Terminal das kann */
-    if (has_colors()) {
-        start_color();
-        use_default_colors();          /* -1 übernimmt jeweils die Hintergrundfarbe des Terminals */
-        init_pair(1, COLOR_WHITE,  -1);   /* Farbpaar 1: Weiß auf Standardhintergrund – allgemeiner Text */
-        init_pair(2, COLOR_CYAN,   -1);   /* Farbpaar 2: Cyan – Ball */
-        init_pair(3, COLOR_YELLOW, -1);   /* Farbpaar 3: Gelb – Spieler‑Schläger */
-        init_pair(4, COLOR_MAGENTA,-1);   /* Farbpaar 4: Magenta – KI‑Schläger */
-        init_pair(5, COLOR_GREEN,  -1);   /* Farbpaar 5: Grün – Punktestand‑Zeile */
-        init_pair(6, COLOR_MAGENTA, -1);   /* Farbpaar 6: Magenta – KI‑Geschwindigkeit */
-        init_pair(7, COLOR_CYAN,    -1);   /* Farbpaar 7: Cyan – Ball‑Geschwindigkeit */
+
+    options_t opt;
+    if (!parse_args(argc, argv, &opt)) {
+        fprintf(stderr,
+                "usage: %s [--render ncurses|raw|null|grid] [--frames N] [--fixed] [--hz N]\n"
+                "          [--ai chase|predict] [--record FILE] [--instr FILE] [--trace FILE]\n"
+                "          [--pmu] [--catchup drop|dilate] [--spin US]\n"
+                "       %s --replay FILE | --view FILE [--render ...]\n"
+                "       %s --farm [--games N] [--ticks M] [--seed S] [--threads T]\n"
+                "            [--chunk C] [--engine scalar|batch] [--pin] [--fixed] [--hz N]\n",
+                argv[0], argv[0], argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    /* Farm: keine UI, nur Simulation und Statistik */
+    if (opt.farm) {
+        if (physics_get_numeric() == PHYS_NUMERIC_FIXED &&
+            opt.farm_cfg.engine == FARM_ENGINE_BATCH) {
+            fprintf(stderr, "--fixed: der Batch-Simulator rechnet nur in float\n");
+            return EXIT_FAILURE;
+        }
+        ai_config_t ai;
+        ai_get_config(&ai);
+        if (ai.mode != AI_MODE_CHASE && opt.farm_cfg.engine == FARM_ENGINE_BATCH) {
+            fprintf(stderr, "--ai predict: der Batch-Simulator kennt nur die Verfolger-KI\n");
+            return EXIT_FAILURE;
+        }
+        if (physics_get_numeric() == PHYS_NUMERIC_FIXED &&
+            opt.farm_cfg.width > PHYS_FIXED_MAX_WIDTH) {
+            fprintf(stderr, "--fixed: höchstens %d Spalten\n", PHYS_FIXED_MAX_WIDTH);
+            return EXIT_FAILURE;
+        }
+        farm_result_t res;
+        bool ok = farm_run(&opt.farm_cfg, &res);
+        farm_print(stdout, &opt.farm_cfg, &res);
+        return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    /* Replay: kein Terminal, Befehle so schnell wie möglich abspielen */
+    if (opt.replay) {
+        replay_result_t rr;
+        if (!replay_run(opt.replay, &rr)) {
+            fprintf(stderr, "%s: keine gültige Aufzeichnung\n", opt.replay);
+            return EXIT_FAILURE;
+        }
+        printf("ticks=%llu score=%d hash=%016llx %s\n",
+               (unsigned long long)rr.ticks, rr.score,
+               (unsigned long long)rr.hash, rr.match ? "match" : "MISMATCH");
+        if (!rr.match)
+            printf("expected ticks=%llu score=%d hash=%016llx\n",
+                   (unsigned long long)rr.expected_ticks, rr.expected_score,
+                   (unsigned long long)rr.expected_hash);
+        return rr.match ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    uint64_t seed = (uint64_t)time(NULL);   /* Startwert für den Zufall des Spiels */
+
+    /* Viewer: Datei vor dem Terminal öffnen, damit Fehler lesbar bleiben */
+    replay_view_t view;
+    if (opt.view && !replay_view_open(&view, opt.view)) {
+        fprintf(stderr, "%s: keine gültige Aufzeichnung\n", opt.view);
+        return EXIT_FAILURE;
+    }
+
+    if (!render_init()) {
+        render_shutdown();
+        fprintf(stderr, "Terminal konnte nicht initialisiert werden\n");
+        return EXIT_FAILURE;
     }
 
     /* Prüft, ob das Terminal groß genug ist */
     int max_y, max_x;
-    getmaxyx(stdscr, max_y, max_x);
+    render_size(&max_x, &max_y);
     
     if (max_x < MIN_TERMINAL_WIDTH || max_y < MIN_TERMINAL_HEIGHT)
     {
-        endwin();
+        render_shutdown();
         printf("Terminal too small! Need at least %dx%d\n", 
                MIN_TERMINAL_WIDTH, MIN_TERMINAL_HEIGHT);
         return EXIT_FAILURE;
     }
+    if (!opt.view && physics_get_numeric() == PHYS_NUMERIC_FIXED &&
+        max_x > PHYS_FIXED_MAX_WIDTH)
+    {
+        render_shutdown();
+        fprintf(stderr, "--fixed: Terminal zu breit (höchstens %d Spalten)\n",
+                PHYS_FIXED_MAX_WIDTH);
+        return EXIT_FAILURE;
+    }
 
     /* Spielsysteme initialisieren */
-    input_init();
-    render_init();
+    input_init(render_input_source());
 
-    game_state_t game = physics_create_game(max_x, max_y);   /* Erstellt und initialisiert den kompletten Spielzustand */
-    unsigned long last_time   = ms_now();
-    unsigned long phys_acc_ms = 0;                            /* Akkumulator für Fix‑Timestep */
+    /* Headless: virtuelle Zeit (ein Render‑Intervall pro Frame), kein
+       Schlafen → die Schleife läuft mit maximaler Geschwindigkeit     */
+    loop_config_t cfg = {0};
+    cfg.headless   = render_is_headless();
+    cfg.max_frames = opt.max_frames;
+    cfg.catchup    = opt.catchup;
+    cfg.spin_us    = opt.spin_us;
 
-    /* Haupt-Spielschleife */
-    bool running = true;
-    while (running)
-    {
-        /* Eingabe verarbeiten */
-        input_action_t action = input_poll();                  /* Liest aktuelle Tastatureingaben */
-        if (action.quit) {
-            break;
-        }
-        physics_player_update(&game, action.dx);               /* Bewegt das Spieler‑Paddle entsprechend der Eingabe */
-
-        /* Fix‑Timestep Physik: in 16ms‑Scheiben nachholen */
-        unsigned long now = ms_now();
-        unsigned long frame_ms = now - last_time;
-        last_time = now;
-        phys_acc_ms += frame_ms;
-
-        physics_event_t last_events = PHYS_EVENT_NONE;
-        while (phys_acc_ms >= PHYSICS_DT_MS) {
-            ai_update(&game);
-            last_events = physics_update_ball_events(&game);
-            if (last_events & PHYS_EVENT_GAME_OVER) {
-                goto game_over;
-            }
-            if (last_events & PHYS_EVENT_SCORED) {
-                /* UI‑Countdown separat anzeigen */
-                render_countdown();
-            }
-            phys_acc_ms -= PHYSICS_DT_MS;
+    if (opt.view) {
+        loop_result_t res;
+        loop_view(&view, &cfg, &res);
+        render_shutdown();
+        if (cfg.headless)
+            printf("frames=%lu ticks=%llu score=%d deadline_misses=%lu"
+                   " ticks_dropped=%lu ticks_dilated=%lu\n", res.frames,
+                   (unsigned long long)view.tick, view.game.score,
+                   res.deadline_misses, res.ticks_dropped, res.ticks_dilated);
+        replay_view_close(&view);
+        return EXIT_SUCCESS;
+    }
+
+    game_state_t game = physics_create_game_seeded(max_x, max_y, seed, 0);   /* Erstellt und initialisiert den kompletten Spielzustand */
+
+    /* Aufzeichnung: Kopf enthält alles, was das Spiel außer den
+       Eingaben bestimmt                                              */
+    replay_rec_t rec;
+    if (opt.record) {
+        ai_config_t ai;
+        ai_get_config(&ai);
+        replay_info_t info = {
+            .width = (uint16_t)max_x, .height = (uint16_t)max_y,
+            .seed = seed, .stream = 0,
+            .solver  = (uint8_t)physics_get_solver(),
+            .numeric = (uint8_t)physics_get_numeric(),
+            .ai_mode = (uint8_t)ai.mode,
+            .tick_hz = (uint16_t)physics_tick_rate(),
+        };
+        if (!replay_rec_open(&rec, opt.record, &info)) {
+            render_shutdown();
+            fprintf(stderr, "%s: kann nicht geschrieben werden\n", opt.record);
+            return EXIT_FAILURE;
         }
+        cfg.record = &rec;
+    }
+
+#ifdef PONG_INSTRUMENT
+    instr_init(opt.instr);   /* SIGUSR1 schreibt zwischendurch */
+#else
+    if (opt.instr)
+        fprintf(stderr, "--instr: ohne INSTRUMENT=1 gebaut, keine Messung\n");
+#endif
+
+    /* Tracer: Ringpuffer vor dem ersten Frame anlegen */
+    if (opt.trace && (!trace_start(0) || !trace_thread_init("loop")))
+        fprintf(stderr, "--trace: kein Speicher für den Ringpuffer\n");
+
+    if (opt.pmu)
+        pmu_init(true);     /* ohne Zähler: nur Wanduhr */
+
+    loop_result_t res;
+    loop_run(&game, &cfg, &res);
+
+    render_shutdown();      /* Terminalzustand des Backends wiederherstellen */
 
-        /* Zeichnet das aktuelle Spielfeld */
-        render_frame(&game, last_events);
-        sleep_ms(RENDER_DT_MS);
+    if (trace_enabled()) {
+        if (!trace_write(opt.trace))
+            fprintf(stderr, "%s: Trace nicht geschrieben\n", opt.trace);
+        else if (trace_dropped() > 0)
+            fprintf(stderr, "%s: %llu älteste Ereignisse überschrieben\n", opt.trace,
+                    (unsigned long long)trace_dropped());
+        trace_stop();
     }
 
-game_over:
-    /* Spielende: wartet auf eine Taste, bevor das Programm beendet */
-    nodelay(stdscr, FALSE);
-    mvprintw(game.field_height / 2, 2, "Game over - press any key");
-    refresh();
-    getch();
+    if (opt.pmu) {
+        pmu_report(stderr);
+        pmu_close();
+    }
+
+#ifdef PONG_INSTRUMENT
+    if (!instr_dump(NULL))
+        fprintf(stderr, "%s: Laufzeitmessung nicht geschrieben\n",
+                opt.instr ? opt.instr : "pong_instr.txt");
+#endif
+
+    if (opt.record && !replay_rec_close(&rec, &game)) {
+        fprintf(stderr, "%s: Schreibfehler\n", opt.record);
+        return EXIT_FAILURE;
+    }
 
-    cleanup_ncurses();      /* ncurses‑Modus verlassen und Terminalzustand wiederherstellen */
+    /* Headless: Ergebnis für Skripte/CI ausgeben */
+    if (cfg.headless)
+        printf("frames=%lu ticks=%lu score=%d deadline_misses=%lu"
+               " ticks_dropped=%lu ticks_dilated=%lu\n", res.frames, res.ticks,
+               game.score, res.deadline_misses, res.ticks_dropped, res.ticks_dilated);
 
     return EXIT_SUCCESS;
 }
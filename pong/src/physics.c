@@ -4,28 +4,140 @@
  * Autor: Mats-Luca Dagott
  * ------------------------------------------------------------------ */
 
-#include <stdlib.h>   /* rand(), abs(), srand(), ... */
 #include <stdbool.h>  /* bool‑Typ und true/false Konstanten */
 #include <math.h>     /* fabsf(), ceilf(), fmaxf(), ... */
+#include <limits.h>   /* INT_MAX */
+#include <string.h>   /* memcpy() */
 #include <time.h>     /* struct timespec */
 #include "physics.h"  /* Datentypen & Prototypen dieses Moduls */
 #include "config.h"   /* Gemeinsame Spielkonstanten */
+#include "fixed.h"    /* Festkomma-Variante (PHYS_NUMERIC_FIXED) */
 
 /* Keine UI-Zustände/Globals mehr hier – reine Physik */
 
-/* RNG-Provider (injizierbar für Tests/Konfiguration) */
-static unsigned int physics_rand_default(void) { return (unsigned int)rand(); }
-static unsigned int (*physics_rand)(void) = physics_rand_default;
+/* Startwert für physics_create_game (PCG-Referenzseed, bis physics_seed) */
+static uint64_t physics_default_seed = 0x853c49e6748fea9bull;
 
-void physics_seed(unsigned int seed) { srand(seed); }
+/* Optionaler Test-Override, ersetzt die Generatoren aller Spiele */
+static unsigned int (*physics_rand_override)(void) = NULL;
+
+/* Aktiver Kollisionslöser */
+static physics_solver_t physics_solver = PHYS_SOLVER_ANALYTIC;
+
+void physics_set_solver(physics_solver_t solver) { physics_solver = solver; }
+physics_solver_t physics_get_solver(void)        { return physics_solver; }
+
+/* Aktives Zahlenformat */
+static physics_numeric_t physics_numeric = PHYS_NUMERIC_FLOAT;
+
+void physics_set_numeric(physics_numeric_t numeric) { physics_numeric = numeric; }
+physics_numeric_t physics_get_numeric(void)         { return physics_numeric; }
+
+/* Vorbelegung für PHYSICS_HZ_DEFAULT als konstante Ausdrücke, gleiche
+   Rechnung wie physics_set_tick_rate. Nur die Dämpfung braucht pow();
+   test_tickrate prüft, dass der Wert zur Rechnung passt. */
+#define RATE_HZ            ((double)PHYSICS_HZ_DEFAULT)
+#define RATE_V(x)          ((float)((x) / RATE_HZ))
+#define RATE_A(x)          ((float)((x) / (RATE_HZ * RATE_HZ)))
+#define RATE_DAMPING       0.8f    /* PADDLE_DAMPING^(1/10) */
+
+/* Werte je Tick der aktiven Tickrate; physics_rate liest nur */
+static physics_rate_t physics_rate_cur = {
+    PHYSICS_HZ_DEFAULT,
+    RATE_A(PLAYER_ACCELERATION),
+    RATE_V(PLAYER_MAX_SPEED),
+    RATE_A(BOT_BASE_ACCELERATION),
+    RATE_A(BOT_ACCEL_PER_POINT),
+    RATE_V(BOT_MAX_SPEED),
+    RATE_DAMPING,
+    RATE_V(PADDLE_STOP_EPS),
+    RATE_V(BALL_INITIAL_SPEED),
+    RATE_V(BALL_MAX_SPEED),
+    RATE_V(BALL_MIN_SPEED),
+    FIX_CONST(RATE_A(PLAYER_ACCELERATION)),
+    FIX_CONST(RATE_V(PLAYER_MAX_SPEED)),
+    FIX_CONST(RATE_A(BOT_BASE_ACCELERATION)),
+    FIX_CONST(RATE_A(BOT_ACCEL_PER_POINT)),
+    FIX_CONST(RATE_V(BOT_MAX_SPEED)),
+    FIX_CONST(RATE_DAMPING),
+    FIX_CONST(RATE_V(PADDLE_STOP_EPS)),
+    FIX_CONST(RATE_V(BALL_INITIAL_SPEED)),
+    FIX_CONST(RATE_V(BALL_MAX_SPEED)),
+    FIX_CONST(RATE_V(BALL_MIN_SPEED)),
+};
+
+/* ------------------------------------------------------------------
+ * physics_set_tick_rate
+ * Setzt die Tickrate und rechnet die Sekunden-Werte aus config.h auf
+ * den Tick um. Gerechnet wird in double und erst am Ende gerundet,
+ * damit 10 Hz genau die früheren Frame-Konstanten ergibt.
+ *
+ * Parameter:
+ *   hz – Ticks pro Sekunde (PHYSICS_HZ_MIN … PHYSICS_HZ_MAX)
+ *
+ * Rückgabe:
+ *   false bei ungültiger Rate (die bisherige bleibt aktiv)
+ * ------------------------------------------------------------------ */
+bool physics_set_tick_rate(unsigned hz)
+{
+    if (hz < PHYSICS_HZ_MIN || hz > PHYSICS_HZ_MAX)
+        return false;
+
+    double f  = (double)hz;
+    double f2 = f * f;
+    physics_rate_t *r = &physics_rate_cur;
+    r->hz                  = hz;
+    r->player_accel        = (float)(PLAYER_ACCELERATION / f2);
+    r->player_max_speed    = (float)(PLAYER_MAX_SPEED / f);
+    r->bot_accel           = (float)(BOT_BASE_ACCELERATION / f2);
+    r->bot_accel_per_point = (float)(BOT_ACCEL_PER_POINT / f2);
+    r->bot_max_speed       = (float)(BOT_MAX_SPEED / f);
+    r->damping             = (float)pow(PADDLE_DAMPING, 1.0 / f);
+    r->stop_eps            = (float)(PADDLE_STOP_EPS / f);
+    r->ball_initial_speed  = (float)(BALL_INITIAL_SPEED / f);
+    r->ball_max_speed      = (float)(BALL_MAX_SPEED / f);
+    r->ball_min_speed      = (float)(BALL_MIN_SPEED / f);
+
+    r->fx_player_accel        = fix_from_float(r->player_accel);
+    r->fx_player_max_speed    = fix_from_float(r->player_max_speed);
+    r->fx_bot_accel           = fix_from_float(r->bot_accel);
+    r->fx_bot_accel_per_point = fix_from_float(r->bot_accel_per_point);
+    r->fx_bot_max_speed       = fix_from_float(r->bot_max_speed);
+    r->fx_damping            = fix_root_frac(PADDLE_DAMPING, hz);
+    r->fx_stop_eps           = fix_from_float(r->stop_eps);
+    r->fx_ball_initial_speed = fix_from_float(r->ball_initial_speed);
+    r->fx_ball_max_speed     = fix_from_float(r->ball_max_speed);
+    r->fx_ball_min_speed     = fix_from_float(r->ball_min_speed);
+    return true;
+}
+
+/* ------------------------------------------------------------------
+ * physics_tick_rate / physics_rate
+ * Aktive Tickrate bzw. ihre Werte je Tick; ohne physics_set_tick_rate
+ * gilt PHYSICS_HZ_DEFAULT. Reiner Lesezugriff, also aus Worker-
+ * Threads sicher.
+ * ------------------------------------------------------------------ */
+const physics_rate_t *physics_rate(void) { return &physics_rate_cur; }
+
+unsigned physics_tick_rate(void) { return physics_rate()->hz; }
+
+void physics_seed(unsigned int seed) { physics_default_seed = seed; }
 void physics_set_random_provider(unsigned int (*rand_func)(void))
 {
-    physics_rand = rand_func ? rand_func : physics_rand_default;
+    physics_rand_override = rand_func;
+}
+
+/* Nächste Zufallszahl eines Spiels (Override hat Vorrang); auch die KI
+   zieht hierüber, damit der Provider jeden Zufall der Simulation ersetzt */
+uint32_t physics_rand(game_state_t *game)
+{
+    return physics_rand_override ? physics_rand_override() : rng_next(&game->rng);
 }
 
 /* ------------------------------------------------------------------
  * physics_create_game
- * Erzeugt einen initialisierten Spielzustand mit gültiger Feldgröße.
+ * Erzeugt einen initialisierten Spielzustand mit gültiger Feldgröße;
+ * Zufall aus dem Startwert von physics_seed, Stream 0.
  *
  * Parameter:
  *   width  – gewünschte Spielfeldbreite
@@ -35,8 +147,29 @@ void physics_set_random_provider(unsigned int (*rand_func)(void))
  *   game_state_t mit allen Anfangswerten
  * ------------------------------------------------------------------ */
 game_state_t physics_create_game(int width, int height)
+{
+    return physics_create_game_seeded(width, height, physics_default_seed, 0);
+}
+
+/* ------------------------------------------------------------------
+ * physics_create_game_seeded
+ * Wie physics_create_game, aber mit eigener Zufallsfolge. Spiele mit
+ * verschiedenen Streams sind unabhängig und können parallel laufen.
+ *
+ * Parameter:
+ *   width  – gewünschte Spielfeldbreite
+ *   height – gewünschte Spielfeldhöhe
+ *   seed   – Startwert
+ *   stream – Nummer der Folge (z. B. Spielindex)
+ *
+ * Rückgabe:
+ *   game_state_t mit allen Anfangswerten
+ * ------------------------------------------------------------------ */
+game_state_t physics_create_game_seeded(int width, int height,
+                                        uint64_t seed, uint64_t stream)
 {
     game_state_t game = {0};
+    rng_seed(&game.rng, seed, stream);
 
     /* Eingabeparameter prüfen */
     if (width < MIN_TERMINAL_WIDTH || height < MIN_TERMINAL_HEIGHT)
@@ -66,19 +199,31 @@ game_state_t physics_create_game(int width, int height)
     game.ball.x  = width  / 2.0f;
     game.ball.y  = height / 2.0f;
     /* Ball horizontal zufällige Richtung */
-    game.ball.vx = (physics_rand() & 1u) ?  BALL_INITIAL_SPEED : -BALL_INITIAL_SPEED;
+    float v0 = physics_rate()->ball_initial_speed;
+    game.ball.vx = (physics_rand(&game) & 1u) ?  v0 : -v0;
 
-    game.ball.vy = -BALL_INITIAL_SPEED;
+    game.ball.vy = -v0;
 
     game.paddle_hits = 0;
     
     return game;
 }
 
+/* Paddle in Q16.16 bewegen (PHYS_NUMERIC_FIXED) */
+static void fix_move_paddle(paddle_t *p, int dir, fix_t accel, fix_t v_max,
+                            int field_w)
+{
+    fix_paddle_t fp;
+    fix_paddle_load(&fp, p);
+    fix_update_paddle(&fp, dir, accel, v_max, field_w);
+    fix_paddle_store(&fp, p);
+}
+
 /* ------------------------------------------------------------------
  * physics_player_update
  * Aktualisiert Position und Geschwindigkeit des Spieler‑Paddles
- * basierend auf der aktuellen Eingabe.
+ * basierend auf der aktuellen Eingabe; im Festkomma-Modus über
+ * fix_update_paddle.
  *
  * Parameter:
  *   g        – Zeiger auf Spielzustand
@@ -89,10 +234,44 @@ game_state_t physics_create_game(int width, int height)
  * ------------------------------------------------------------------ */
 void physics_player_update(game_state_t *g, int input_dx)
 {
+    const physics_rate_t *r = physics_rate();
+    if (physics_numeric == PHYS_NUMERIC_FIXED) {
+        fix_move_paddle(&g->player, input_dx, r->fx_player_accel,
+                        r->fx_player_max_speed, g->field_width);
+        return;
+    }
     update_paddle(&g->player,
                   (float)input_dx,               /* -1 / 0 / +1        */
-                  PLAYER_ACCELERATION,
-                  PLAYER_MAX_SPEED,
+                  r->player_accel,
+                  r->player_max_speed,
+                  g->field_width);
+}
+
+/* ------------------------------------------------------------------
+ * physics_bot_update
+ * Bewegt das Bot‑Paddle in die von der KI gewählte Richtung; die
+ * Beschleunigung wächst mit dem Score. Im Festkomma-Modus über
+ * fix_update_paddle.
+ *
+ * Parameter:
+ *   g   – Zeiger auf Spielzustand
+ *   dir – Bewegungsrichtung (-1, 0, +1)
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void physics_bot_update(game_state_t *g, int dir)
+{
+    const physics_rate_t *r = physics_rate();
+    if (physics_numeric == PHYS_NUMERIC_FIXED) {
+        fix_move_paddle(&g->bot, dir,
+                        r->fx_bot_accel + r->fx_bot_accel_per_point * g->score,
+                        r->fx_bot_max_speed, g->field_width);
+        return;
+    }
+    update_paddle(&g->bot, (float)dir,
+                  r->bot_accel + r->bot_accel_per_point * g->score,
+                  r->bot_max_speed,
                   g->field_width);
 }
 
@@ -151,19 +330,20 @@ static void reflect_paddle(ball_t *ball,
     ball->vx = new_vx;
     ball->vy = new_vy;
 
-    /* 8. Geschwindigkeits-Grenzen                                  */
+    /* 8. Geschwindigkeits-Grenzen (je Tick)                        */
+    const physics_rate_t *r = physics_rate();
     float mag = sqrtf(ball->vx * ball->vx + ball->vy * ball->vy);
 
     /* max                                                           */
-    if (mag > BALL_MAX_SPEED) {
-        float s = BALL_MAX_SPEED / mag;
-        ball->vx *= s; ball->vy *= s; mag = BALL_MAX_SPEED;
+    if (mag > r->ball_max_speed) {
+        float s = r->ball_max_speed / mag;
+        ball->vx *= s; ball->vy *= s; mag = r->ball_max_speed;
     }
 
     /* 9. **dynamisches Minimum**                                    */
-    float dyn_min = BALL_MIN_SPEED *
+    float dyn_min = r->ball_min_speed *
                     (1.f + hits_since_reset * BALL_MIN_SPEED_INC);
-    if (dyn_min > BALL_MAX_SPEED) dyn_min = BALL_MAX_SPEED;
+    if (dyn_min > r->ball_max_speed) dyn_min = r->ball_max_speed;
 
     if (mag < dyn_min) {
         float s = dyn_min / mag;
@@ -183,13 +363,14 @@ static void reflect_paddle(ball_t *ball,
 /* ------------------------------------------------------------------
  * update_paddle
  * Integriert Beschleunigung, Dämpfung, Clamping und Position des
- * angegebenen Paddles für einen Physik‑Frame.
+ * angegebenen Paddles für einen Physik‑Tick; Dämpfung und Stopp-
+ * Schwelle aus der aktiven Tickrate.
  *
  * Parameter:
  *   p       – Zeiger auf Paddle
  *   dir     – gewünschte Richtung (-1, 0, +1)
- *   accel   – Beschleunigung
- *   v_max   – Maximalgeschwindigkeit
+ *   accel   – Beschleunigung in Zellen / Tick²
+ *   v_max   – Maximalgeschwindigkeit in Zellen / Tick
  *   field_w – Spielfeldbreite
  *
  * Rückgabe:
@@ -208,9 +389,10 @@ void update_paddle(paddle_t *p,
         p->vx += p->ax;
     } else {
         /* kein Input → Geschwindigkeit allmählich abbauen         */
+        const physics_rate_t *r = physics_rate();
         p->ax = 0.0f;
-        p->vx *= PADDLE_DAMPING;
-        if (fabsf(p->vx) < PADDLE_STOP_EPS)
+        p->vx *= r->damping;
+        if (fabsf(p->vx) < r->stop_eps)
             p->vx = 0.0f;
     }
 
@@ -262,14 +444,15 @@ static void reset_ball(game_state_t *game, int dir_down)
     game->ball.y = game->bot.y + 1;              /* direkt unter Bot  */
 
     /* 2. Basisgeschwindigkeit abhängig vom Score                */
-    float base_speed = BALL_INITIAL_SPEED *
+    const physics_rate_t *r = physics_rate();
+    float base_speed = r->ball_initial_speed *
                        (1.0f + game->score * SPEED_PER_POINT);
 
     /* Optional: Obergrenze, damit es nicht unspielbar wird       */
-    if (base_speed > BALL_MAX_SPEED) base_speed = BALL_MAX_SPEED;
+    if (base_speed > r->ball_max_speed) base_speed = r->ball_max_speed;
 
     /* 3. Zufällige horizontale Richtung                          */
-    game->ball.vx = (physics_rand() & 1u) ?  base_speed : -base_speed;
+    game->ball.vx = (physics_rand(game) & 1u) ?  base_speed : -base_speed;
 
     /* 4. Vertikale Richtung: nach unten (=+), sonst nach oben    */
     game->ball.vy = dir_down ?  base_speed : -base_speed;
@@ -292,18 +475,19 @@ static void reset_ball(game_state_t *game, int dir_down)
 /* Countdown wird in der UI realisiert – Physik emittiert nur SCORED-Event */
 
 /* ------------------------------------------------------------------
- * physics_update_ball
- * Bewegt den Ball in kleinen Schritten, prüft Kollisionen mit Wänden
- * und Paddles und behandelt Punkte sowie Spielende.
+ * update_ball_substep
+ * Kompatibilitätsmodus: bewegt den Ball in kleinen Schritten (max.
+ * eine Zelle je Achse), prüft nach jedem Schritt Kollisionen mit
+ * Wänden und Paddles und behandelt Punkte sowie Spielende. Aufwand
+ * wächst linear mit der Ballgeschwindigkeit.
  *
  * Parameter:
  *   game – Zeiger auf Spielzustand
  *
  * Rückgabe:
- *   true  – Spiel läuft weiter
- *   false – Ball ist unten herausgefallen (Game Over)
+ *   Event‑Bitmaske dieses Updates
  * ------------------------------------------------------------------ */
-physics_event_t physics_update_ball_events(game_state_t *game)
+static physics_event_t update_ball_substep(game_state_t *game)
 {
     ball_t *ball = &game->ball;
     physics_event_t events = PHYS_EVENT_NONE;
@@ -393,10 +577,539 @@ physics_event_t physics_update_ball_events(game_state_t *game)
     return events;  /* Events dieses Updates */
 }
 
+/* ------------------------------------------------------------------
+ * slab_entry
+ * Schnitt einer Geraden p(t) = p0 + v·t mit dem Intervall [lo, hi]
+ * auf einer Achse (Slab‑Methode).
+ *
+ * Parameter:
+ *   p0, v  – Startposition und Geschwindigkeit
+ *   lo, hi – Intervallgrenzen
+ *   t0, t1 – Ausgabe: Zeitintervall, in dem p(t) im Intervall liegt
+ *
+ * Rückgabe:
+ *   false, wenn die Gerade das Intervall nie berührt
+ * ------------------------------------------------------------------ */
+static bool slab_entry(float p0, float v, float lo, float hi,
+                       float *t0, float *t1)
+{
+    if (v == 0.0f) {
+        if (p0 < lo || p0 > hi)
+            return false;
+        *t0 = -INFINITY;
+        *t1 =  INFINITY;
+        return true;
+    }
+    float a = (lo - p0) / v;
+    float b = (hi - p0) / v;
+    *t0 = fminf(a, b);
+    *t1 = fmaxf(a, b);
+    return true;
+}
+
+/* ------------------------------------------------------------------
+ * paddle_toi
+ * Berechnet den frühesten Zeitpunkt in [0, t_max], zu dem der Ball
+ * das Trefferfeld eines Paddles berührt. Das Trefferfeld entspricht
+ * den Bedingungen des Sub‑Step‑Lösers: x in [p.x, p.x + width],
+ * y im Band [y_lo, y_hi] vor dem Paddle.
+ *
+ * Parameter:
+ *   ball       – Ball
+ *   p          – Paddle
+ *   y_lo, y_hi – Zeilenband, in dem ein Treffer zählt
+ *   t_max      – verbleibende Zeit des Ticks
+ *
+ * Rückgabe:
+ *   Kontaktzeit oder INFINITY
+ * ------------------------------------------------------------------ */
+static float paddle_toi(const ball_t *ball, const paddle_t *p,
+                        float y_lo, float y_hi, float t_max)
+{
+    float tx0, tx1, ty0, ty1;
+    if (!slab_entry(ball->x, ball->vx, p->x, p->x + p->width, &tx0, &tx1) ||
+        !slab_entry(ball->y, ball->vy, y_lo, y_hi, &ty0, &ty1))
+        return INFINITY;
+
+    float t_in  = fmaxf(fmaxf(tx0, ty0), 0.0f);
+    float t_out = fminf(tx1, ty1);
+    return (t_in <= t_out && t_in <= t_max) ? t_in : INFINITY;
+}
+
+/* Kontaktarten des analytischen Lösers, Reihenfolge = Priorität bei
+   gleicher Kontaktzeit (wie die Prüfreihenfolge im Sub‑Step‑Löser) */
+typedef enum {
+    CONTACT_NONE = 0,
+    CONTACT_WALL,
+    CONTACT_BOT,
+    CONTACT_PLAYER,
+    CONTACT_SCORE,
+    CONTACT_OUT,
+} contact_t;
+
+/* ------------------------------------------------------------------
+ * update_ball_analytic
+ * Bewegt den Ball einen Tick mit exakter Kollisionserkennung: für
+ * Seitenwände, beide Paddles, Torlinie und Aus wird die Kontaktzeit
+ * geschlossen berechnet, der Ball direkt zum frühesten Kontakt
+ * bewegt und dort reflektiert. Aufwand pro Tick wächst mit der Zahl
+ * der Kontakte, nicht mit der zurückgelegten Strecke.
+ *
+ * Parameter:
+ *   game – Zeiger auf Spielzustand
+ *
+ * Rückgabe:
+ *   Event‑Bitmaske dieses Updates
+ * ------------------------------------------------------------------ */
+static physics_event_t update_ball_analytic(game_state_t *game)
+{
+    ball_t *ball = &game->ball;
+    physics_event_t events = PHYS_EVENT_NONE;
+    float right = (float)(game->field_width - 1);
+    float t_rem = 1.0f;                         /* verbleibender Tick‑Anteil */
+
+    for (int n = 0; n < PHYS_MAX_CONTACTS; ++n)
+    {
+        float     t_hit = INFINITY;
+        contact_t hit   = CONTACT_NONE;
+
+        /* Seitenwände: nur in Bewegungsrichtung, bereits außerhalb = sofort */
+        if (ball->vx < 0.0f)
+            t_hit = fmaxf(-ball->x / ball->vx, 0.0f);
+        else if (ball->vx > 0.0f)
+            t_hit = fmaxf((right - ball->x) / ball->vx, 0.0f);
+        hit = (t_hit <= t_rem) ? CONTACT_WALL : CONTACT_NONE;
+        if (hit == CONTACT_NONE) t_hit = INFINITY;
+
+        /* Bot-Paddle (oben), nur auf dem Weg nach oben */
+        if (ball->vy < 0.0f) {
+            float t = paddle_toi(ball, &game->bot,
+                                 (float)game->bot.y, (float)game->bot.y + 1.0f, t_rem);
+            if (t < t_hit) { t_hit = t; hit = CONTACT_BOT; }
+        }
+
+        /* Spieler-Paddle (unten), nur auf dem Weg nach unten */
+        if (ball->vy > 0.0f) {
+            float t = paddle_toi(ball, &game->player,
+                                 (float)game->player.y - 1.0f, (float)game->player.y, t_rem);
+            if (t < t_hit) { t_hit = t; hit = CONTACT_PLAYER; }
+        }
+
+        /* Punkte & Spielende: Überschreiten von y = 0 bzw. y = Höhe */
+        if (ball->vy < 0.0f && ball->y + ball->vy * t_rem < 0.0f) {
+            float t = fmaxf(-ball->y / ball->vy, 0.0f);
+            if (t < t_hit) { t_hit = t; hit = CONTACT_SCORE; }
+        }
+        if (ball->vy > 0.0f && ball->y + ball->vy * t_rem > game->field_height) {
+            float t = fmaxf((game->field_height - ball->y) / ball->vy, 0.0f);
+            if (t < t_hit) { t_hit = t; hit = CONTACT_OUT; }
+        }
+
+        if (hit == CONTACT_NONE)
+            break;
+
+        /* Direkt zum Kontakt springen */
+        ball->x += ball->vx * t_hit;
+        ball->y += ball->vy * t_hit;
+        t_rem   -= t_hit;
+
+        switch (hit)
+        {
+        case CONTACT_WALL:
+            ball->vx = -ball->vx;
+            ball->x  = fminf(fmaxf(ball->x, 0), right);
+            break;
+        case CONTACT_BOT:
+            game->paddle_hits++;
+            reflect_paddle(ball, &game->bot, game->paddle_hits);
+            events |= PHYS_EVENT_HIT_BOT;
+            break;
+        case CONTACT_PLAYER:
+            game->paddle_hits++;
+            reflect_paddle(ball, &game->player, game->paddle_hits);
+            events |= PHYS_EVENT_HIT_PLAYER;
+            break;
+        case CONTACT_SCORE:                               /* oben raus -> Punkt  */
+            game->score += 1;
+            reset_ball(game, /*dir_down=*/1);
+            return events | PHYS_EVENT_SCORED;            /* Tick fertig        */
+        case CONTACT_OUT:                                 /* unten raus -> Ende */
+            return events | PHYS_EVENT_GAME_OVER;
+        case CONTACT_NONE:
+            break;
+        }
+    }
+
+    /* Rest des Ticks ohne weiteren Kontakt */
+    ball->x += ball->vx * t_rem;
+    ball->y += ball->vy * t_rem;
+    return events;
+}
+
+/* ------------------------------------------------------------------
+ * fix_slab_entry / fix_paddle_toi
+ * Festkomma-Gegenstücke zu slab_entry und paddle_toi; ±FIX_MAX
+ * ersetzt ±INFINITY.
+ * ------------------------------------------------------------------ */
+static bool fix_slab_entry(fix_t p0, fix_t v, fix_t lo, fix_t hi,
+                           fix_t *t0, fix_t *t1)
+{
+    if (v == 0) {
+        if (p0 < lo || p0 > hi)
+            return false;
+        *t0 = -FIX_MAX;
+        *t1 =  FIX_MAX;
+        return true;
+    }
+    fix_t a = fix_div(lo - p0, v);
+    fix_t b = fix_div(hi - p0, v);
+    *t0 = fix_min(a, b);
+    *t1 = fix_max(a, b);
+    return true;
+}
+
+static fix_t fix_paddle_toi(const fix_ball_t *ball, const fix_paddle_t *p,
+                            fix_t y_lo, fix_t y_hi, fix_t t_max)
+{
+    fix_t tx0, tx1, ty0, ty1;
+    if (!fix_slab_entry(ball->x, ball->vx, p->x, p->x + FIX_INT(p->width), &tx0, &tx1) ||
+        !fix_slab_entry(ball->y, ball->vy, y_lo, y_hi, &ty0, &ty1))
+        return FIX_MAX;
+
+    fix_t t_in  = fix_max(fix_max(tx0, ty0), 0);
+    fix_t t_out = fix_min(tx1, ty1);
+    return (t_in <= t_out && t_in <= t_max) ? t_in : FIX_MAX;
+}
+
+/* ------------------------------------------------------------------
+ * fix_reset_ball
+ * Festkomma-Variante von reset_ball.
+ *
+ * Parameter:
+ *   game – Zeiger auf Spielzustand (Score, Bot-Zeile, Zufall)
+ *   ball – Ball in Q16.16
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void fix_reset_ball(game_state_t *game, fix_ball_t *ball)
+{
+    ball->x = game->field_width * FIX_HALF;
+    ball->y = FIX_INT(game->bot.y + 1);
+
+    const physics_rate_t *r = physics_rate();
+    fix_t v_max      = r->fx_ball_max_speed;
+    fix_t base_speed = fix_mul(r->fx_ball_initial_speed,
+                               FIX_ONE + game->score * FIX_CONST(SPEED_PER_POINT));
+    if (base_speed > v_max)
+        base_speed = v_max;
+
+    ball->vx = (physics_rand(game) & 1u) ? base_speed : -base_speed;
+    ball->vy = base_speed;
+    game->paddle_hits = 0;
+}
+
+/* ------------------------------------------------------------------
+ * update_ball_fixed
+ * Analytischer Löser in Q16.16 (PHYS_NUMERIC_FIXED): gleicher Ablauf
+ * und gleiche Kontakt-Priorität wie update_ball_analytic, aber nur
+ * Ganzzahlarithmetik.
+ *
+ * Parameter:
+ *   game – Zeiger auf Spielzustand
+ *
+ * Rückgabe:
+ *   Event‑Bitmaske dieses Updates
+ * ------------------------------------------------------------------ */
+static physics_event_t update_ball_fixed(game_state_t *game)
+{
+    physics_event_t events = PHYS_EVENT_NONE;
+    fix_ball_t   ball;
+    fix_paddle_t bot, player;
+    fix_ball_load(&ball, &game->ball);
+    fix_paddle_load(&bot, &game->bot);
+    fix_paddle_load(&player, &game->player);
+
+    fix_t right  = FIX_INT(game->field_width - 1);
+    fix_t height = FIX_INT(game->field_height);
+    fix_t t_rem  = FIX_ONE;
+
+    for (int n = 0; n < PHYS_MAX_CONTACTS; ++n)
+    {
+        fix_t     t_hit = FIX_MAX;
+        contact_t hit   = CONTACT_NONE;
+
+        if (ball.vx < 0)
+            t_hit = fix_max(fix_div(-ball.x, ball.vx), 0);
+        else if (ball.vx > 0)
+            t_hit = fix_max(fix_div(right - ball.x, ball.vx), 0);
+        hit = (t_hit <= t_rem) ? CONTACT_WALL : CONTACT_NONE;
+        if (hit == CONTACT_NONE) t_hit = FIX_MAX;
+
+        if (ball.vy < 0) {
+            fix_t t = fix_paddle_toi(&ball, &bot, FIX_INT(bot.y), FIX_INT(bot.y + 1), t_rem);
+            if (t < t_hit) { t_hit = t; hit = CONTACT_BOT; }
+        }
+        if (ball.vy > 0) {
+            fix_t t = fix_paddle_toi(&ball, &player,
+                                     FIX_INT(player.y - 1), FIX_INT(player.y), t_rem);
+            if (t < t_hit) { t_hit = t; hit = CONTACT_PLAYER; }
+        }
+        if (ball.vy < 0 && ball.y + fix_mul(ball.vy, t_rem) < 0) {
+            fix_t t = fix_max(fix_div(-ball.y, ball.vy), 0);
+            if (t < t_hit) { t_hit = t; hit = CONTACT_SCORE; }
+        }
+        if (ball.vy > 0 && ball.y + fix_mul(ball.vy, t_rem) > height) {
+            fix_t t = fix_max(fix_div(height - ball.y, ball.vy), 0);
+            if (t < t_hit) { t_hit = t; hit = CONTACT_OUT; }
+        }
+
+        if (hit == CONTACT_NONE)
+            break;
+
+        ball.x += fix_mul(ball.vx, t_hit);
+        ball.y += fix_mul(ball.vy, t_hit);
+        t_rem  -= t_hit;
+
+        switch (hit)
+        {
+        case CONTACT_WALL:
+            ball.vx = -ball.vx;
+            ball.x  = fix_min(fix_max(ball.x, 0), right);
+            break;
+        case CONTACT_BOT:
+            game->paddle_hits++;
+            fix_reflect_paddle(&ball, &bot, game->paddle_hits);
+            events |= PHYS_EVENT_HIT_BOT;
+            break;
+        case CONTACT_PLAYER:
+            game->paddle_hits++;
+            fix_reflect_paddle(&ball, &player, game->paddle_hits);
+            events |= PHYS_EVENT_HIT_PLAYER;
+            break;
+        case CONTACT_SCORE:
+            game->score += 1;
+            fix_reset_ball(game, &ball);
+            fix_ball_store(&ball, &game->ball);
+            return events | PHYS_EVENT_SCORED;
+        case CONTACT_OUT:
+            fix_ball_store(&ball, &game->ball);
+            return events | PHYS_EVENT_GAME_OVER;
+        case CONTACT_NONE:
+            break;
+        }
+    }
+
+    ball.x += fix_mul(ball.vx, t_rem);
+    ball.y += fix_mul(ball.vy, t_rem);
+    fix_ball_store(&ball, &game->ball);
+    return events;
+}
+
+/* ------------------------------------------------------------------
+ * physics_update_ball_events
+ * Bewegt den Ball um einen Physik‑Tick mit dem eingestellten
+ * Kollisionslöser bzw. Zahlenformat und meldet Treffer, Punkte und Spielende.
+ *
+ * Parameter:
+ *   game – Zeiger auf Spielzustand
+ *
+ * Rückgabe:
+ *   Event‑Bitmaske dieses Updates
+ * ------------------------------------------------------------------ */
+physics_event_t physics_update_ball_events(game_state_t *game)
+{
+    if (physics_numeric == PHYS_NUMERIC_FIXED)
+        return update_ball_fixed(game);
+    if (physics_solver == PHYS_SOLVER_SUBSTEP)
+        return update_ball_substep(game);
+    return update_ball_analytic(game);
+}
+
+/* ------------------------------------------------------------------
+ * physics_update_ball
+ * Rückwärtskompatible Variante von physics_update_ball_events.
+ *
+ * Parameter:
+ *   game – Zeiger auf Spielzustand
+ *
+ * Rückgabe:
+ *   true  – Spiel läuft weiter
+ *   false – Ball ist unten herausgefallen (Game Over)
+ * ------------------------------------------------------------------ */
 bool physics_update_ball(game_state_t *game)
 {
     physics_event_t ev = physics_update_ball_events(game);
     return (ev & PHYS_EVENT_GAME_OVER) == 0;
 }
 
+/* ------------------------------------------------------------------
+ * physics_predict_intercept
+ * Berechnet, wann und wo der Ball die Zeile row erreicht. Statt die
+ * Wandreflexionen Tick für Tick zu simulieren, läuft der Ball gerade
+ * durch gespiegelte Kopien des Felds weiter; die ungefaltete Position
+ * u = x + vx·t wird anschließend auf [0, right] zurückgefaltet, die
+ * Zahl der überschrittenen Spiegelachsen ist die Zahl der Wandkontakte.
+ * Feldgrenzen wie im Löser: x = 0 und x = field_width - 1.
+ *
+ * Parameter:
+ *   game – Spielzustand (wird nicht verändert)
+ *   row  – Zielzeile (z.B. bot.y + 1 bzw. player.y - 1)
+ *   out  – Ausgabe: Auftreffpunkt, Zeit und Wandkontakte
+ *
+ * Rückgabe:
+ *   false, wenn sich der Ball nicht auf row zubewegt
+ * ------------------------------------------------------------------ */
+bool physics_predict_intercept(const game_state_t *game, int row,
+                               physics_intercept_t *out)
+{
+    const ball_t *ball = &game->ball;
+    double dy = (double)row - ball->y;
+    if (ball->vy == 0.0f || dy * ball->vy < 0.0)
+        return false;
+
+    double t     = dy / ball->vy;
+    double right = (double)(game->field_width - 1);
+    double x0    = fmin(fmax(ball->x, 0.0), right);
+
+    out->t = (float)t;
+    if (right <= 0.0) {
+        out->x       = 0.0f;
+        out->bounces = 0;
+        return true;
+    }
+
+    /* Auffalten: Spiegelkopie k enthält u ∈ [k·right, (k+1)·right) */
+    double u = x0 + (double)ball->vx * t;
+    double k = floor(u / right);
+    double m = u - k * right;
+    bool   mirrored = fmod(fabs(k), 2.0) == 1.0;
 
+    out->x       = (float)(mirrored ? right - m : m);
+    out->bounces = fabs(k) < INT_MAX ? (int)fabs(k) : INT_MAX;
+    return true;
+}
+
+/* ------------------------------------------------------------------
+ * physics_save
+ * Sichert den kompletten Physikzustand in einen Snapshot fester Größe.
+ *
+ * Parameter:
+ *   game – Spielzustand
+ *   tick – aktueller Tick (wird mitgespeichert)
+ *   snap – Ausgabe
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void physics_save(const game_state_t *game, uint64_t tick, physics_snapshot_t *snap)
+{
+    snap->magic   = PHYS_SNAPSHOT_MAGIC;
+    snap->version = PHYS_SNAPSHOT_VERSION;
+    snap->size    = (uint16_t)sizeof *snap;
+    snap->tick    = tick;
+    snap->solver  = (uint8_t)physics_solver;
+    snap->numeric = (uint8_t)physics_numeric;
+    snap->tick_hz = (uint16_t)physics_tick_rate();
+    snap->game    = *game;
+}
+
+/* ------------------------------------------------------------------
+ * physics_restore
+ * Stellt einen mit physics_save gesicherten Zustand wieder her; danach
+ * läuft die Simulation bitgleich weiter. Löser und Zahlenformat sind
+ * Prozess-Einstellungen und werden nur verglichen, die Tickrate wird
+ * nur bei einem Wechsel neu berechnet – im Normalfall ist Restore eine
+ * Strukturkopie ohne Schreibzugriff auf globalen Zustand (Farm-Threads).
+ *
+ * Parameter:
+ *   game – Ziel
+ *   tick – Ausgabe: gespeicherter Tick (darf NULL sein)
+ *   snap – Snapshot
+ *
+ * Rückgabe:
+ *   false, wenn Kennung, Version, Größe, Löser, Zahlenformat oder
+ *   Tickrate nicht passen
+ * ------------------------------------------------------------------ */
+bool physics_restore(game_state_t *game, uint64_t *tick, const physics_snapshot_t *snap)
+{
+    if (snap->magic != PHYS_SNAPSHOT_MAGIC ||
+        snap->version != PHYS_SNAPSHOT_VERSION ||
+        snap->size != sizeof *snap ||
+        snap->solver != (uint8_t)physics_solver ||
+        snap->numeric != (uint8_t)physics_numeric)
+        return false;
+    if (snap->tick_hz != physics_rate_cur.hz &&
+        !physics_set_tick_rate(snap->tick_hz))
+        return false;
+
+    *game = snap->game;
+    if (tick)
+        *tick = snap->tick;
+    return true;
+}
+
+/* ------------------------------------------------------------------
+ * hash_word
+ * Faltet ein 64-Bit-Wort byteweise in einen FNV-1a-Hash.
+ *
+ * Parameter:
+ *   h – bisheriger Hash
+ *   v – Wort
+ *
+ * Rückgabe:
+ *   neuer Hash
+ * ------------------------------------------------------------------ */
+static uint64_t hash_word(uint64_t h, uint64_t v)
+{
+    for (int i = 0; i < 8; ++i) {
+        h ^= (v >> (8 * i)) & 0xFFu;
+        h *= 0x100000001b3ull;
+    }
+    return h;
+}
+
+static uint64_t hash_float(uint64_t h, float f)
+{
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof bits);
+    return hash_word(h, bits);
+}
+
+/* ------------------------------------------------------------------
+ * physics_state_hash
+ * Prüfsumme über den Spielzustand: Ball, beide Paddles, Score,
+ * Trefferzähler, Feldgröße und Zufallsgenerator. Der Zielcache der KI
+ * (bot_ai) ist abgeleitet und geht nicht ein, ebenso Füllbytes – der
+ * Hash ist also unabhängig vom Speicherlayout.
+ *
+ * Parameter:
+ *   game – Spielzustand
+ *
+ * Rückgabe:
+ *   64-Bit-Hash
+ * ------------------------------------------------------------------ */
+uint64_t physics_state_hash(const game_state_t *game)
+{
+    const paddle_t *pad[2] = { &game->player, &game->bot };
+    uint64_t h = 0xcbf29ce484222325ull;
+
+    h = hash_float(h, game->ball.x);
+    h = hash_float(h, game->ball.y);
+    h = hash_float(h, game->ball.vx);
+    h = hash_float(h, game->ball.vy);
+    for (int i = 0; i < 2; ++i) {
+        h = hash_float(h, pad[i]->x);
+        h = hash_float(h, pad[i]->vx);
+        h = hash_float(h, pad[i]->ax);
+        h = hash_word(h, (uint64_t)(uint32_t)pad[i]->y);
+        h = hash_word(h, (uint64_t)(uint32_t)pad[i]->width);
+    }
+    h = hash_word(h, (uint64_t)(uint32_t)game->score);
+    h = hash_word(h, (uint64_t)(uint32_t)game->paddle_hits);
+    h = hash_word(h, (uint64_t)(uint32_t)game->field_width);
+    h = hash_word(h, (uint64_t)(uint32_t)game->field_height);
+    h = hash_word(h, game->rng.state);
+    h = hash_word(h, game->rng.inc);
+    return h;
+}
@@ -9,7 +9,9 @@
 #define PHYSICS_H
 
 #include <stdbool.h>
+#include <stdint.h>
 #include "config.h"
+#include "rng.h"
 
 /* Spielkonstanten wanderten nach config.h */
 
@@ -31,6 +33,16 @@ typedef struct
     float vy;
 } ball_t;
 
+/* Zielcache der vorhersagenden Bot-KI (ai.c); gilt, solange der Ball
+   mit genau dieser Geschwindigkeit fliegt */
+typedef struct
+{
+    bool  valid;
+    float ball_vx;
+    float ball_vy;
+    float target_x;
+} ai_target_t;
+
 typedef struct
 {
     int field_width;
@@ -40,6 +52,8 @@ typedef struct
     ball_t   ball;
     int score;
     int paddle_hits;
+    rng_t rng;          /* eigene Zufallsfolge (Aufschlag, KI-Fehler) */
+    ai_target_t bot_ai;
 } game_state_t;
 
 /* ---------------------------------------------------------------
@@ -54,16 +68,145 @@ typedef enum {
     PHYS_EVENT_GAME_OVER     = 1 << 3,
 } physics_event_t;
 
-/* RNG-Injektion für testbare/konfigurierbare Zufallswerte */
+/* ---------------------------------------------------------------
+ * Kollisionslöser für die Ballbewegung
+ * --------------------------------------------------------------- */
+typedef enum {
+    PHYS_SOLVER_ANALYTIC = 0,   /* exakte Kontaktzeiten (Standard)          */
+    PHYS_SOLVER_SUBSTEP,        /* Kompatibilität: Sub-Steps à max. 1 Zelle */
+} physics_solver_t;
+
+/* Obergrenze für Kontakte pro Tick (Sicherheitsnetz gegen Endlosschleifen) */
+#define PHYS_MAX_CONTACTS 64
+
+void physics_set_solver(physics_solver_t solver);
+physics_solver_t physics_get_solver(void);
+
+/* ---------------------------------------------------------------
+ * Zahlenformat der Physik
+ * FIXED rechnet Ball und Paddles intern in Q16.16 (fixed.h) mit dem
+ * analytischen Löser: bitgleich über Compiler, -O-Stufen und CPUs.
+ * Die float-Felder im Spielzustand tragen die Werte dann verlustfrei
+ * (Spielfeld < 256 Zellen).
+ * --------------------------------------------------------------- */
+typedef enum {
+    PHYS_NUMERIC_FLOAT = 0,     /* float (Standard)                   */
+    PHYS_NUMERIC_FIXED,         /* Festkomma Q16.16, deterministisch  */
+} physics_numeric_t;
+
+void physics_set_numeric(physics_numeric_t numeric);
+physics_numeric_t physics_get_numeric(void);
+
+/* ---------------------------------------------------------------
+ * Tickrate
+ * config.h gibt Tempo, Beschleunigung und Dämpfung je Sekunde an, der
+ * Spielzustand rechnet in Zellen je Tick (Ball, Paddles, Kontaktzeiten,
+ * Vorhersage). physics_set_tick_rate rechnet die Werte einmal um:
+ * v·dt, a·dt², Dämpfung d^dt. Faktoren je Paddle-Hit (Bounce, Edge-
+ * Drop, Steigung) sind zeitfrei und bleiben. Die Rate gilt global und
+ * wird beim Start gesetzt, bevor Spiele oder Threads entstehen; bis
+ * dahin gilt PHYSICS_HZ_DEFAULT (statisch vorbelegt, ohne Schreiben).
+ * --------------------------------------------------------------- */
+typedef struct
+{
+    unsigned hz;                /* Ticks pro Sekunde                   */
+    float player_accel;         /* Zellen / Tick²                      */
+    float player_max_speed;     /* Zellen / Tick                       */
+    float bot_accel;            /* Zellen / Tick², bei Score 0         */
+    float bot_accel_per_point;
+    float bot_max_speed;
+    float damping;              /* Anteil von vx je Tick ohne Eingabe  */
+    float stop_eps;
+    float ball_initial_speed;
+    float ball_max_speed;
+    float ball_min_speed;
+    /* Q16.16-Kopien (fix_t, fixed.h) für PHYS_NUMERIC_FIXED, einmal beim
+       Setzen gerundet; die Dämpfung ohne libm (fix_root_frac) */
+    int32_t fx_player_accel;
+    int32_t fx_player_max_speed;
+    int32_t fx_bot_accel;
+    int32_t fx_bot_accel_per_point;
+    int32_t fx_bot_max_speed;
+    int32_t fx_damping;
+    int32_t fx_stop_eps;
+    int32_t fx_ball_initial_speed;
+    int32_t fx_ball_max_speed;
+    int32_t fx_ball_min_speed;
+} physics_rate_t;
+
+/* false außerhalb von [PHYSICS_HZ_MIN, PHYSICS_HZ_MAX], Rate bleibt */
+bool physics_set_tick_rate(unsigned hz);
+unsigned physics_tick_rate(void);
+const physics_rate_t *physics_rate(void);
+
+/* Zufall: jedes Spiel trägt seinen eigenen Generator (game_state_t.rng).
+   physics_seed setzt den Startwert für physics_create_game; der Provider
+   ersetzt die Spielgeneratoren global (nur für Tests gedacht, NULL = aus).
+   physics_rand liefert die nächste Zahl eines Spiels, Provider beachtet. */
 void physics_seed(unsigned int seed);
 void physics_set_random_provider(unsigned int (*rand_func)(void));
+uint32_t physics_rand(game_state_t *game);
 
 game_state_t physics_create_game(int width, int height);
+/* Spiel mit eigener Folge: gleiches (seed, stream) → gleicher Verlauf */
+game_state_t physics_create_game_seeded(int width, int height,
+                                        uint64_t seed, uint64_t stream);
 /* Rückwärtskompatibel: true=weiter, false=Game Over */
 bool physics_update_ball(game_state_t *game);
 /* Neue API: liefert Event-Bitmaske dieses Updates */
 physics_event_t physics_update_ball_events(game_state_t *game);
 void physics_player_update(game_state_t *g, int input_dx);
+/* Bot-Paddle in Richtung dir (-1, 0, +1), Beschleunigung nach Score */
+void physics_bot_update(game_state_t *g, int dir);
+
+/* PHYS_NUMERIC_FIXED: die float-Felder tragen Q16.16 nur für |v| < 256
+   verlustfrei, breitere Felder werden abgelehnt */
+#define PHYS_FIXED_MAX_WIDTH 255
+
+/* ---------------------------------------------------------------
+ * Vorhersage: wo und wann erreicht der Ball eine Zeile?
+ * Seitenwände werden in geschlossener Form "aufgefaltet" (Spiegel-
+ * bilder des Felds [0, Breite-1]), Paddles und Punkte bleiben außen
+ * vor. O(1), unabhängig von Strecke und Zahl der Wandkontakte.
+ * --------------------------------------------------------------- */
+typedef struct
+{
+    float x;            /* Auftreffpunkt in Feldkoordinaten          */
+    float t;            /* Zeit in Ticks ab jetzt                    */
+    int   bounces;      /* Wandkontakte auf dem Weg                  */
+} physics_intercept_t;
+
+bool physics_predict_intercept(const game_state_t *game, int row,
+                               physics_intercept_t *out);
+
+/* ---------------------------------------------------------------
+ * Snapshot: vollständiger Physikzustand fester Größe (Spielzustand
+ * inkl. Zufallsgenerator, Trefferzähler und KI-Cache sowie Löser,
+ * Zahlenformat und Tickrate). Speichern/Laden ist eine Strukturkopie, ohne Heap.
+ * Version erhöhen, sobald sich game_state_t ändert.
+ * --------------------------------------------------------------- */
+#define PHYS_SNAPSHOT_MAGIC   0x534E5950u     /* "PYNS" */
+#define PHYS_SNAPSHOT_VERSION 2u
+
+typedef struct
+{
+    uint32_t     magic;
+    uint16_t     version;
+    uint16_t     size;          /* sizeof(physics_snapshot_t)          */
+    uint64_t     tick;          /* Tick, nach dem gespeichert wurde    */
+    uint8_t      solver;        /* physics_solver_t                    */
+    uint8_t      numeric;       /* physics_numeric_t                   */
+    uint16_t     tick_hz;       /* Tickrate, Geschwindigkeiten je Tick */
+    game_state_t game;
+} physics_snapshot_t;
+
+/* FNV-1a über alle simulationsrelevanten Felder (Bitmuster der floats) */
+uint64_t physics_state_hash(const game_state_t *game);   /* ohne bot_ai */
+
+void physics_save(const game_state_t *game, uint64_t tick, physics_snapshot_t *snap);
+/* false bei fremdem Format/Version oder anderem Löser/Zahlenformat als
+   im Prozess eingestellt; game und tick bleiben dann unverändert */
+bool physics_restore(game_state_t *game, uint64_t *tick, const physics_snapshot_t *snap);
 void update_paddle(paddle_t *p,
                    float dir,
                    float accel,
@@ -0,0 +1,273 @@
+/* ------------------------------------------------------------------
+ * pmu.c - Hardware-Zähler-Regionen über perf_event_open
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ *
+ * Je Thread eine Zählergruppe (Zyklen als Anführer, Instruktionen,
+ * Branch- und Cache-Misses), nur User-Space, einmal geöffnet. Ein
+ * read() auf den Anführer liefert alle Werte samt Laufzeiten; bei
+ * Multiplexing werden die Differenzen hochgerechnet. Ohne Zähler
+ * (Container, perf_event_paranoid, kein Linux) bleibt die Wanduhr.
+ * ------------------------------------------------------------------ */
+
+#define _GNU_SOURCE             /* syscall */
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "pmu.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+enum { CTR_CYCLES, CTR_INSTR, CTR_BRANCH_MISS, CTR_CACHE_MISS, CTR_COUNT };
+
+/* Momentaufnahme aller Zähler */
+typedef struct
+{
+    uint64_t ns;
+    uint64_t enabled;           /* Laufzeiten der Gruppe (Multiplexing) */
+    uint64_t running;
+    uint64_t v[CTR_COUNT];
+} pmu_sample_t;
+
+typedef struct
+{
+    pmu_totals_t total;
+    pmu_sample_t start;
+} pmu_slot_t;
+
+static const char *const region_names[PMU_REGIONS] = {
+    "ai", "physics", "render", "user0", "user1",
+};
+
+/* Alles je Thread: Gruppe und Plätze */
+static __thread bool       pmu_on   = false;
+static __thread int        group_fd = -1;
+static __thread int        fds[CTR_COUNT];
+static __thread pmu_slot_t slots[PMU_REGIONS];
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+#ifdef __linux__
+/* ------------------------------------------------------------------
+ * open_counter
+ * Öffnet einen Hardware-Zähler für den aufrufenden Thread.
+ *
+ * Parameter:
+ *   config – PERF_COUNT_HW_*
+ *   leader – Gruppenanführer oder -1
+ *
+ * Rückgabe:
+ *   Dateideskriptor oder -1
+ * ------------------------------------------------------------------ */
+static int open_counter(uint64_t config, int leader)
+{
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof attr);
+    attr.size           = sizeof attr;
+    attr.type           = PERF_TYPE_HARDWARE;
+    attr.config         = config;
+    attr.disabled       = leader < 0;       /* Gruppe startet gemeinsam */
+    attr.exclude_kernel = 1;                /* reicht für paranoid = 2 */
+    attr.exclude_hv     = 1;
+    attr.read_format    = PERF_FORMAT_GROUP |
+                          PERF_FORMAT_TOTAL_TIME_ENABLED |
+                          PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0);
+}
+#endif
+
+/* ------------------------------------------------------------------
+ * read_sample
+ * Liest Wanduhr und (falls offen) alle Zähler der Gruppe.
+ *
+ * Parameter:
+ *   s – Ausgabe
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void read_sample(pmu_sample_t *s)
+{
+    memset(s, 0, sizeof *s);
+    s->ns = now_ns();
+    if (group_fd < 0)
+        return;
+
+    /* PERF_FORMAT_GROUP: nr, time_enabled, time_running, value[nr] */
+    uint64_t buf[3 + CTR_COUNT];
+    if (read(group_fd, buf, sizeof buf) != (ssize_t)sizeof buf || buf[0] != CTR_COUNT)
+        return;
+    s->enabled = buf[1];
+    s->running = buf[2];
+    memcpy(s->v, &buf[3], sizeof s->v);
+}
+
+/* ------------------------------------------------------------------
+ * pmu_init
+ * Öffnet die Zählergruppe des aufrufenden Threads (nur beim ersten
+ * Aufruf) und leert die Plätze.
+ *
+ * Parameter:
+ *   hardware – false: nur Wanduhr, auch wenn Zähler verfügbar wären
+ *
+ * Rückgabe:
+ *   true, wenn Hardware-Zähler laufen
+ * ------------------------------------------------------------------ */
+bool pmu_init(bool hardware)
+{
+    pmu_reset();
+    pmu_on = true;
+    if (group_fd >= 0 || !hardware)
+        return group_fd >= 0;
+
+#ifdef __linux__
+    static const uint64_t configs[CTR_COUNT] = {
+        PERF_COUNT_HW_CPU_CYCLES,    PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_HW_CACHE_MISSES,
+    };
+    for (int i = 0; i < CTR_COUNT; ++i) {
+        fds[i] = open_counter(configs[i], i == 0 ? -1 : fds[0]);
+        if (fds[i] < 0) {
+            while (i-- > 0)
+                close(fds[i]);
+            return false;
+        }
+    }
+    group_fd = fds[0];
+    ioctl(group_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(group_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    return group_fd >= 0;
+}
+
+bool pmu_enabled(void)       { return pmu_on; }
+bool pmu_hw_available(void)  { return group_fd >= 0; }
+
+/* ------------------------------------------------------------------
+ * pmu_close
+ * Schließt die Zählergruppe des Threads und beendet die Messung.
+ *
+ * Parameter:
+ *   keine
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void pmu_close(void)
+{
+    if (group_fd >= 0) {
+        for (int i = CTR_COUNT - 1; i >= 0; --i)
+            close(fds[i]);
+        group_fd = -1;
+    }
+    pmu_on = false;
+}
+
+/* ------------------------------------------------------------------
+ * pmu_begin / pmu_end
+ * Nehmen die Zähler vor bzw. nach einer Region auf und addieren die
+ * Differenz auf den Platz. Lief die Gruppe nur einen Teil der Zeit
+ * (Multiplexing), wird auf die volle Zeit hochgerechnet.
+ *
+ * Parameter:
+ *   region – Messplatz
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void pmu_begin(pmu_region_t region)
+{
+    if (pmu_on)
+        read_sample(&slots[region].start);
+}
+
+void pmu_end(pmu_region_t region)
+{
+    if (!pmu_on)
+        return;
+
+    pmu_sample_t end;
+    read_sample(&end);
+
+    pmu_slot_t         *slot  = &slots[region];
+    const pmu_sample_t *start = &slot->start;
+    double scale = 1.0;
+    uint64_t d_run = end.running - start->running;
+    if (d_run > 0)
+        scale = (double)(end.enabled - start->enabled) / (double)d_run;
+
+    uint64_t d[CTR_COUNT];
+    for (int i = 0; i < CTR_COUNT; ++i)
+        d[i] = (uint64_t)((double)(end.v[i] - start->v[i]) * scale + 0.5);
+
+    slot->total.calls++;
+    slot->total.ns            += end.ns - start->ns;
+    slot->total.cycles        += d[CTR_CYCLES];
+    slot->total.instructions  += d[CTR_INSTR];
+    slot->total.branch_misses += d[CTR_BRANCH_MISS];
+    slot->total.cache_misses  += d[CTR_CACHE_MISS];
+}
+
+/* ------------------------------------------------------------------
+ * pmu_reset / pmu_get / pmu_region_name
+ * Plätze leeren bzw. Summen und Namen eines Platzes lesen.
+ * ------------------------------------------------------------------ */
+void pmu_reset(void)
+{
+    memset(slots, 0, sizeof slots);
+}
+
+void pmu_get(pmu_region_t region, pmu_totals_t *out)
+{
+    *out = slots[region].total;
+}
+
+const char *pmu_region_name(pmu_region_t region)
+{
+    return region_names[region];
+}
+
+/* ------------------------------------------------------------------
+ * pmu_report
+ * Schreibt die Summen je Aufruf. Ohne Hardware-Zähler stehen in den
+ * Zählerspalten Striche.
+ *
+ * Parameter:
+ *   f – Ausgabestrom
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void pmu_report(FILE *f)
+{
+    bool hw = pmu_hw_available();
+
+    fprintf(f, "# counters: %s\n", hw ? "cycles, instructions, branch-misses, cache-misses (user)"
+                                      : "unavailable, wall time only");
+    fprintf(f, "%-8s %10s %10s %10s %6s %10s %10s\n",
+            "region", "calls", "ns/call", "cyc/call", "IPC", "brmiss/c", "cmiss/c");
+    for (int i = 0; i < PMU_REGIONS; ++i) {
+        const pmu_totals_t *t = &slots[i].total;
+        if (t->calls == 0)
+            continue;
+        double n = (double)t->calls;
+        fprintf(f, "%-8s %10llu %10.0f", region_names[i],
+                (unsigned long long)t->calls, (double)t->ns / n);
+        if (hw && t->cycles > 0)
+            fprintf(f, " %10.0f %6.2f %10.2f %10.2f\n", (double)t->cycles / n,
+                    (double)t->instructions / (double)t->cycles,
+                    (double)t->branch_misses / n, (double)t->cache_misses / n);
+        else
+            fprintf(f, " %10s %6s %10s %10s\n", "-", "-", "-", "-");
+    }
+}
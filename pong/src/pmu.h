@@ -0,0 +1,56 @@
+/* ------------------------------------------------------------------
+ * pmu.h - Header der Hardware-Zähler-Regionen (perf_event_open)
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#ifndef PMU_H
+#define PMU_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* Feste Messplätze; PMU_USER* für Tests und Benchmarks */
+typedef enum {
+    PMU_AI = 0,         /* ai_update                   */
+    PMU_PHYSICS,        /* physics_update_ball_events  */
+    PMU_RENDER,         /* render_frame                */
+    PMU_USER0,
+    PMU_USER1,
+    PMU_REGIONS
+} pmu_region_t;
+
+/* Summen eines Platzes; die Zählerwerte sind 0 ohne Hardware-Zähler */
+typedef struct
+{
+    uint64_t calls;
+    uint64_t ns;                /* Wanduhr */
+    uint64_t cycles;
+    uint64_t instructions;
+    uint64_t branch_misses;
+    uint64_t cache_misses;
+} pmu_totals_t;
+
+/* Einmal je Thread: Zählergruppe öffnen (hardware = false erzwingt
+   die reine Zeitmessung). Rückgabe: true, wenn Hardware-Zähler
+   laufen; sonst misst der Thread nur Wanduhrzeit */
+bool pmu_init(bool hardware);
+bool pmu_enabled(void);
+bool pmu_hw_available(void);
+void pmu_close(void);
+
+/* Region messen; ohne pmu_init kehren beide sofort zurück.
+   Verschiedene Plätze dürfen sich verschachteln */
+void pmu_begin(pmu_region_t region);
+void pmu_end(pmu_region_t region);
+
+void        pmu_reset(void);
+void        pmu_get(pmu_region_t region, pmu_totals_t *out);
+const char *pmu_region_name(pmu_region_t region);
+
+/* Tabelle: Aufrufe, ns, Zyklen, IPC, Branch- und Cache-Misses je
+   Aufruf (Plätze ohne Aufrufe entfallen) */
+void pmu_report(FILE *f);
+
+#endif /* PMU_H */
@@ -1,150 +1,293 @@
 /* ------------------------------------------------------------------
- * render.c - Darstellung mit ncurses
+ * render.c - Darstellung: Backend-Auswahl und UI-Effekte
  * Copyright 2025 Hochschule Hannover
  * Autor: Mats-Luca Dagott
  * ------------------------------------------------------------------ */
 
-#include <ncurses.h>
-#include <time.h>
+#include <stdio.h>
+#include <string.h>
 #include "render.h"
-#include <math.h>
-#include "config.h"   /* BOT_INITIAL_SPEED … */
+#include "render_backend.h"
+#include "config.h"
+#include "hudstats.h"
+#include "instr.h"
 
 /* Flash-Countdowns in der UI statt in der Physik */
 static int player_flash = 0;
 static int bot_flash    = 0;
 
+/* Overlays, gesetzt von der Spielschleife */
+static int  countdown_value = 0;
+static bool game_over_shown = false;
+
+/* Leistungs-Overlay: gleitendes Fenster, laufender Frame, Anzeige */
+static bool              perf_shown   = false;
+static hudstats_t        perf_win;
+static hudstats_sample_t perf_cur;
+static uint64_t          perf_last_ns = 0;     /* voriger Frame, 0 = keiner */
+static unsigned          perf_frames  = 0;
+static char              perf_txt[96];
+
+/* Verfügbare Backends, das erste ist der Standard */
+static const render_backend_t *const backends[] = {
+    &render_backend_ncurses,
+    &render_backend_raw,
+    &render_backend_null,
+    &render_backend_grid,
+};
+
+static const render_backend_t *backend = &render_backend_ncurses;
+
+/* ------------------------------------------------------------------
+ * render_select
+ * Wählt das Ausgabe‑Backend anhand seines Namens.
+ *
+ * Parameter:
+ *   name – "ncurses", "raw", "null" oder "grid"
+ *
+ * Rückgabe:
+ *   true, wenn ein Backend dieses Namens existiert
+ * ------------------------------------------------------------------ */
+bool render_select(const char *name)
+{
+    for (size_t i = 0; i < sizeof backends / sizeof backends[0]; ++i) {
+        if (strcmp(backends[i]->name, name) == 0) {
+            backend = backends[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+/* ------------------------------------------------------------------
+ * render_backend_name / render_input_source / render_is_headless
+ * Eigenschaften des gewählten Backends.
+ * ------------------------------------------------------------------ */
+const char *render_backend_name(void)    { return backend->name; }
+input_source_t render_input_source(void) { return backend->input; }
+bool render_is_headless(void)            { return backend->headless; }
+
 /* ------------------------------------------------------------------
  * render_init
- * Führt initiale Einstellungen für das Render‑Modul aus.
- * Derzeit keine Operationen erforderlich, Platzhalter für mögliche
- * Erweiterungen.
+ * Initialisiert das gewählte Backend und setzt die UI‑Effekte zurück.
  *
  * Parameter:
  *   keine
  *
  * Rückgabe:
- *   keine
+ *   true bei Erfolg
  * ------------------------------------------------------------------ */
-
-/* Aktuell keine zusätzliche Initialisierung nötig, Farben werden in main gesetzt */
-void render_init(void)
+bool render_init(void)
 {
-    /* leer */
+    player_flash    = 0;
+    bot_flash       = 0;
+    countdown_value = 0;
+    game_over_shown = false;
+    perf_shown      = false;
+    return backend->init();
 }
-void render_countdown(void)
+
+void render_size(int *width, int *height)
 {
-    const char *txt[] = {"3","2","1"};
-    for (int i = 0; i < COUNTDOWN_STEPS; ++i) {
-        mvprintw(LINES/2, COLS/2 - 1, "%s", txt[i % 3]);
-        refresh();
-        struct timespec ts = { COUNTDOWN_DELAY_MS / 1000, (COUNTDOWN_DELAY_MS % 1000) * 1000 * 1000 };
-        nanosleep(&ts, NULL);
-    }
-    erase();
+    backend->size(width, height);
 }
 
-
 /* ------------------------------------------------------------------
- * draw_paddle
- * Zeichnet ein Paddle als zusammenhängende Blockreihe auf dem
- * Bildschirm. Bei aktiviertem Flash‑Flag wird das Paddle invertiert
- * dargestellt, um einen Treffer optisch hervorzuheben.
+ * render_posed
+ * Aktualisiert die Flash‑Effekte für getroffene Paddles und lässt das
+ * Backend den Frame zeichnen; Ball und Paddles stehen an pose, alles
+ * übrige kommt aus g.
  *
  * Parameter:
- *   p     – Zeiger auf Paddle‑Struktur
- *   color – ncurses-Farbpaar-ID
- *   flash – 0 = normal, != 0 = invertiert
+ *   g      – Zeiger auf aktuellen Spielzustand
+ *   pose   – gezeichnete Positionen
+ *   events – Physik‑Ereignisse seit dem letzten Frame
  *
  * Rückgabe:
  *   keine
  * ------------------------------------------------------------------ */
-
-/* Fette, einfarbige Schläger */
-static void draw_paddle(const paddle_t *p, int color, int flash)
+static void render_posed(const game_state_t *g, const render_pose_t *pose,
+                         physics_event_t events)
 {
-    if (flash) attron(A_REVERSE);
-    attron(COLOR_PAIR(color));
-    for (int i = 0; i < p->width; ++i)
-        mvaddch(p->y, (int)lroundf(p->x) + i, ACS_BLOCK);
-    attroff(COLOR_PAIR(color));
-    if (flash) attroff(A_REVERSE);
+    /* Event-abhängige Flash-Impulse */
+    if (events & PHYS_EVENT_HIT_PLAYER) player_flash = FLASH_FRAMES;
+    if (events & PHYS_EVENT_HIT_BOT)    bot_flash    = FLASH_FRAMES;
+
+    render_fx_t fx = { *pose, player_flash > 0, bot_flash > 0,
+                       countdown_value, game_over_shown, NULL };
+    if (player_flash > 0) player_flash--;
+    if (bot_flash    > 0) bot_flash--;
+
+    if (!perf_shown) {
+        backend->frame(g, &fx);
+        return;
+    }
+
+    /* Frame-Abstand messen, Anzeige nur alle PERF_TEXT_FRAMES neu */
+    uint64_t now = instr_now_ns();
+    if (perf_last_ns != 0) {
+        perf_cur.frame_ns = now - perf_last_ns;
+        hudstats_push(&perf_win, &perf_cur);
+    }
+    perf_last_ns = now;
+    memset(&perf_cur, 0, sizeof perf_cur);
+
+    if (perf_win.count > 0 && perf_frames++ % PERF_TEXT_FRAMES == 0) {
+        hudstats_summary_t sum;
+        hudstats_summary(&perf_win, &sum);
+        hudstats_format(&sum, perf_txt, sizeof perf_txt);
+    }
+    fx.perf = perf_txt;
+
+    /* Ausgabe dieses Frames zählt wie die Ticks zum nächsten Abstand */
+    backend->frame(g, &fx);
 }
 
 /* ------------------------------------------------------------------
  * render_frame
- * Zeichnet einen kompletten Frame: Spielfeldrahmen, Score‑Zeile,
- * Schwierigkeitsindikatoren, Paddles und Ball. Aktualisiert zudem die
- * Flash‑Effekte für getroffene Paddles.
+ * Zeichnet den Spielzustand, wie er ist.
  *
  * Parameter:
- *   g – Zeiger auf aktuellen Spielzustand
+ *   g      – Zeiger auf aktuellen Spielzustand
+ *   events – Physik‑Ereignisse seit dem letzten Frame
  *
  * Rückgabe:
  *   keine
  * ------------------------------------------------------------------ */
-
 void render_frame(const game_state_t *g, physics_event_t events)
 {
-    erase();
-
-    /* 1.  Spielfeld-Rahmen (vollständig) ---------------------------- */
-    attron(A_DIM);
-
-    /* obere Kante mit Ecken */
-    mvaddch(g->bot.y - 1,               0,                 ACS_ULCORNER);
-    mvhline(g->bot.y - 1,               1,                 ACS_HLINE, g->field_width - 2);
-    mvaddch(g->bot.y - 1, g->field_width - 1,              ACS_URCORNER);
-
-    /* untere Kante mit Ecken */
-    mvaddch(g->player.y + 1,            0,                 ACS_LLCORNER);
-    mvhline(g->player.y + 1,            1,                 ACS_HLINE, g->field_width - 2);
-    mvaddch(g->player.y + 1, g->field_width - 1,           ACS_LRCORNER);
+    render_pose_t pose = render_pose_of(g);
+    render_posed(g, &pose, events);
+}
 
-     /* linke und rechte Seiten */
-    int inner_height = g->player.y - g->bot.y + 1;   /* +1: bis zur Bottom-Line */
-    mvvline(g->bot.y, 0,                                    ACS_VLINE, inner_height);   /* Zeilen dazwischen*/
-    mvvline(g->bot.y, g->field_width-1,                     ACS_VLINE, inner_height);
+/* ------------------------------------------------------------------
+ * render_frame_lerp
+ * Zeichnet den Zustand zwischen zwei Physik‑Ticks: Ball und Paddles
+ * liegen auf der Geraden von prev nach g, alpha ist der angebrochene
+ * Anteil des laufenden Ticks. Nur diese Positionen gehen als Pose an
+ * das Backend, alles übrige (Geschwindigkeiten im HUD, Punkte) liest
+ * es direkt aus g – ohne Kopie des Spielzustands.
+ *
+ * Parameter:
+ *   prev   – Positionen vor dem letzten Tick
+ *   g      – Zustand nach dem letzten Tick
+ *   alpha  – Anteil 0 … 1 (wird begrenzt)
+ *   events – Physik‑Ereignisse seit dem letzten Frame
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void render_frame_lerp(const render_pose_t *prev, const game_state_t *g,
+                       float alpha, physics_event_t events)
+{
+    if (alpha < 0.0f) alpha = 0.0f;
+    if (alpha > 1.0f) alpha = 1.0f;
 
-    attroff(A_DIM);
+    render_pose_t pose;
+    pose.ball_x   = prev->ball_x   + (g->ball.x   - prev->ball_x)   * alpha;
+    pose.ball_y   = prev->ball_y   + (g->ball.y   - prev->ball_y)   * alpha;
+    pose.player_x = prev->player_x + (g->player.x - prev->player_x) * alpha;
+    pose.bot_x    = prev->bot_x    + (g->bot.x    - prev->bot_x)    * alpha;
 
-    /* 2.  Score-Zeile ---------------------------------------------- */
-    attron(COLOR_PAIR(5) | A_BOLD);
-    mvprintw(0, 2, "Score: %d   (q = quit)", g->score);
-    attroff(COLOR_PAIR(5) | A_BOLD);
+    render_posed(g, &pose, events);
+}
 
-    /* 2a. Schwierigkeits‑Indikator ---------------------------------- */
-    float bot_acc = BOT_BASE_ACCELERATION +
-                    BOT_ACCEL_PER_POINT * g->score;      /* aktuelle Bot‑Beschleunigung */
+/* ------------------------------------------------------------------
+ * render_perf_toggle / render_perf_shown
+ * Blenden das Leistungs‑Overlay ein bzw. aus. Beim Einblenden
+ * beginnt das Fenster leer.
+ * ------------------------------------------------------------------ */
+void render_perf_toggle(void)
+{
+    perf_shown = !perf_shown;
+    if (perf_shown) {
+        hudstats_reset(&perf_win);
+        memset(&perf_cur, 0, sizeof perf_cur);
+        perf_last_ns = 0;
+        perf_frames  = 0;
+        snprintf(perf_txt, sizeof perf_txt, "measuring ...");
+    }
+}
 
-    float ball_sp = sqrtf(g->ball.vx * g->ball.vx + g->ball.vy * g->ball.vy);
+bool render_perf_shown(void)
+{
+    return perf_shown;
+}
 
-    /* Wir bauen die Zeile Stück für Stück, um die Werte einfärben zu können */
-    int col = g->field_width - 25;   /* rechter Rand wie gehabt */
+/* ------------------------------------------------------------------
+ * render_perf_ticks / render_perf_output
+ * Tragen Physik‑Ticks bzw. Terminalausgabe in den laufenden
+ * Messwert ein.
+ *
+ * Parameter:
+ *   ticks    – Physik‑Ticks des kommenden Frames
+ *   flush_ns – Dauer von refresh() bzw. write()
+ *   bytes    – geschriebene Bytes
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void render_perf_ticks(unsigned long ticks)
+{
+    if (perf_shown)
+        perf_cur.ticks += (uint32_t)ticks;
+}
 
-    mvprintw(0, col, "Bot a:");
-    attron(COLOR_PAIR(6) | A_BOLD);
-    printw("%4.2f", bot_acc);
-    attroff(COLOR_PAIR(6) | A_BOLD);
+void render_perf_output(uint64_t flush_ns, uint64_t bytes)
+{
+    if (!perf_shown)
+        return;
+    perf_cur.flush_ns += flush_ns;
+    perf_cur.bytes    += (uint32_t)bytes;
+}
 
-    printw("  Ball: ");
-    attron(COLOR_PAIR(7) | A_BOLD);
-    printw("%4.2f", ball_sp);
-    attroff(COLOR_PAIR(7) | A_BOLD);
+/* ------------------------------------------------------------------
+ * render_countdown / render_game_over
+ * Setzen die Overlays, die ab dem nächsten render_frame über dem
+ * Spielfeld erscheinen.
+ *
+ * Parameter:
+ *   value – Countdown‑Zahl, 0 blendet den Countdown aus
+ *   show  – Game‑Over‑Meldung ein/aus
+ * ------------------------------------------------------------------ */
+void render_countdown(int value)
+{
+    countdown_value = value;
+}
 
-    /* 3.  Spielobjekte --------------------------------------------- */
-    /* Event-abhängige Flash-Impulse */
-    if (events & PHYS_EVENT_HIT_PLAYER) player_flash = FLASH_FRAMES;
-    if (events & PHYS_EVENT_HIT_BOT)    bot_flash    = FLASH_FRAMES;
+void render_game_over(bool show)
+{
+    game_over_shown = show;
+}
 
-    draw_paddle(&g->player, 3, player_flash > 0);
-    draw_paddle(&g->bot,    4, bot_flash    > 0);
-    if (player_flash > 0) player_flash--;
-    if (bot_flash    > 0) bot_flash--;
+void render_shutdown(void)
+{
+    backend->shutdown();
+}
 
-    attron(COLOR_PAIR(2) | A_BOLD);
-    mvaddch((int)g->ball.y, (int)g->ball.x, ACS_DIAMOND);
-    attroff(COLOR_PAIR(2) | A_BOLD);
+/* ------------------------------------------------------------------
+ * render_ui_save / render_ui_restore
+ * Sichern bzw. setzen Flash-Zähler und Overlays, damit ein Snapshot
+ * auch die UI-Seite bitgleich fortsetzen kann.
+ *
+ * Parameter:
+ *   ui – Ausgabe bzw. gesicherter Zustand
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void render_ui_save(render_ui_t *ui)
+{
+    ui->player_flash = player_flash;
+    ui->bot_flash    = bot_flash;
+    ui->countdown    = countdown_value;
+    ui->game_over    = game_over_shown;
+}
 
-    refresh();
+void render_ui_restore(const render_ui_t *ui)
+{
+    player_flash    = ui->player_flash;
+    bot_flash       = ui->bot_flash;
+    countdown_value = ui->countdown;
+    game_over_shown = ui->game_over;
 }
@@ -8,12 +8,75 @@
 #ifndef RENDER_H
 #define RENDER_H
 
+#include <stdbool.h>
+#include "input.h"
 #include "physics.h"
 
-void render_init(void);
+/* Gezeichnete Positionen eines Ticks – genug für das Zwischenbild,
+   ohne je Tick den ganzen Spielzustand zu kopieren */
+typedef struct
+{
+    float ball_x;
+    float ball_y;
+    float player_x;
+    float bot_x;
+} render_pose_t;
+
+static inline render_pose_t render_pose_of(const game_state_t *g)
+{
+    return (render_pose_t){ g->ball.x, g->ball.y, g->player.x, g->bot.x };
+}
+
+/* UI-Effekte, die nicht Teil des Physik-Zustands sind */
+typedef struct
+{
+    render_pose_t pose;  /* Ball/Paddles, ggf. zwischen zwei Ticks */
+    bool player_flash;
+    bool bot_flash;
+    int  countdown;      /* angezeigte Zahl, 0 = kein Countdown */
+    bool game_over;      /* Game-Over-Meldung einblenden        */
+    const char *perf;    /* Leistungs-Overlay, NULL = aus       */
+} render_fx_t;
+
+/* Zähler und Overlays der UI zum Sichern/Wiederherstellen (Snapshots) */
+typedef struct
+{
+    int  player_flash;   /* verbleibende Flash-Frames */
+    int  bot_flash;
+    int  countdown;
+    bool game_over;
+} render_ui_t;
+
+/* Backend per Name wählen ("ncurses", "raw", "null", "grid"),
+   muss vor render_init erfolgen; false bei unbekanntem Namen */
+bool render_select(const char *name);
+const char *render_backend_name(void);
+input_source_t render_input_source(void);
+bool render_is_headless(void);
+
+/* false, wenn das Terminal nicht initialisiert werden konnte */
+bool render_init(void);
+void render_size(int *width, int *height);
 void render_frame(const game_state_t *game, physics_event_t events);
+/* Zwischenbild: Positionen zwischen prev und game nach alpha (0 … 1) */
+void render_frame_lerp(const render_pose_t *prev, const game_state_t *game,
+                       float alpha, physics_event_t events);
+
+/* Overlays für die folgenden Frames setzen (UI, nicht Physik);
+   blockieren nie, die Zeitsteuerung liegt in der Spielschleife */
+void render_countdown(int value);
+void render_game_over(bool show);
+void render_shutdown(void);
+
+/* Leistungs-Overlay (FPS, Ticks/Frame, Frame- und refresh()-Zeit,
+   Terminal-Bytes/s) in der unteren Rahmenzeile ein-/ausblenden;
+   gemessen wird nur, solange es sichtbar ist */
+void render_perf_toggle(void);
+bool render_perf_shown(void);
+/* Physik-Ticks des kommenden Frames, vor render_frame melden */
+void render_perf_ticks(unsigned long ticks);
 
-/* Optionaler Render-Countdown (UI, nicht Physik) */
-void render_countdown(void);
+void render_ui_save(render_ui_t *ui);
+void render_ui_restore(const render_ui_t *ui);
 
 #endif /* RENDER_H */
@@ -0,0 +1,41 @@
+/* ------------------------------------------------------------------
+ * render_backend.h - Schnittstelle der Ausgabe-Backends
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#ifndef RENDER_BACKEND_H
+#define RENDER_BACKEND_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "input.h"
+#include "physics.h"
+#include "render.h"
+
+/* Funktionstabelle eines Backends; render.c ruft nur diese auf */
+typedef struct
+{
+    const char     *name;
+    input_source_t  input;      /* passende Eingabequelle               */
+    bool            headless;   /* true = kein Terminal, keine Wartezeit */
+
+    bool (*init)(void);
+    void (*size)(int *width, int *height);
+    /* Ball/Paddles aus fx->pose, sonst aus game; fx enthält auch
+       Countdown und Game Over; nie blockierend */
+    void (*frame)(const game_state_t *game, const render_fx_t *fx);
+    void (*shutdown)(void);
+} render_backend_t;
+
+/* Backends melden die Dauer ihrer Terminalausgabe (refresh() bzw.
+   write()) und die geschriebenen Bytes; nur nötig, solange
+   render_perf_shown() gilt */
+void render_perf_output(uint64_t flush_ns, uint64_t bytes);
+
+extern const render_backend_t render_backend_ncurses;
+extern const render_backend_t render_backend_raw;
+extern const render_backend_t render_backend_null;
+extern const render_backend_t render_backend_grid;
+
+#endif /* RENDER_BACKEND_H */
@@ -0,0 +1,78 @@
+/* ------------------------------------------------------------------
+ * render_grid.c - Backend, das in ein Zellraster im Speicher zeichnet
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ *
+ * Nutzt dieselbe Frame‑Komposition wie das Raw‑Backend, gibt aber
+ * nichts aus. Für Tests, Benchmarks und CI ohne Terminal.
+ * ------------------------------------------------------------------ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "render_backend.h"
+#include "render_grid.h"
+
+static struct
+{
+    int           cols;
+    int           rows;
+    cell_t       *cells;
+    unsigned long frames;
+} grid = { 80, 24, NULL, 0 };
+
+void render_grid_set_size(int cols, int rows)
+{
+    grid.cols = cols;
+    grid.rows = rows;
+}
+
+const cell_t *render_grid_cells(int *cols, int *rows)
+{
+    *cols = grid.cols;
+    *rows = grid.rows;
+    return grid.cells;
+}
+
+unsigned long render_grid_frames(void)
+{
+    return grid.frames;
+}
+
+static bool grid_init(void)
+{
+    free(grid.cells);
+    grid.frames = 0;
+    grid.cells  = malloc(sizeof(cell_t) * (size_t)grid.cols * (size_t)grid.rows);
+    if (!grid.cells)
+        return false;
+    cells_clear(grid.cells, grid.cols, grid.rows);
+    return true;
+}
+
+static void grid_size(int *width, int *height)
+{
+    *width  = grid.cols;
+    *height = grid.rows;
+}
+
+static void grid_frame(const game_state_t *g, const render_fx_t *fx)
+{
+    cells_compose(grid.cells, grid.cols, grid.rows, g, fx);
+    grid.frames++;
+}
+
+static void grid_shutdown(void)
+{
+    free(grid.cells);
+    grid.cells = NULL;
+}
+
+const render_backend_t render_backend_grid = {
+    .name      = "grid",
+    .input     = INPUT_SRC_NONE,
+    .headless  = true,
+    .init      = grid_init,
+    .size      = grid_size,
+    .frame     = grid_frame,
+    .shutdown  = grid_shutdown,
+};
@@ -0,0 +1,19 @@
+/* ------------------------------------------------------------------
+ * render_grid.h - Header des In-Memory-Backends
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#ifndef RENDER_GRID_H
+#define RENDER_GRID_H
+
+#include "cells.h"
+
+/* Größe des virtuellen Terminals, vor render_init setzen (Std. 80x24) */
+void render_grid_set_size(int cols, int rows);
+
+/* Zuletzt komponierter Frame; NULL vor render_init */
+const cell_t *render_grid_cells(int *cols, int *rows);
+unsigned long render_grid_frames(void);
+
+#endif /* RENDER_GRID_H */
@@ -0,0 +1,584 @@
+/* ------------------------------------------------------------------
+ * render_ncurses.c - Darstellung mit ncurses (Retained Mode)
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#include <ncurses.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include "render_backend.h"
+#include "cleanup.h"
+#include "config.h"   /* BOT_INITIAL_SPEED … */
+#include "instr.h"
+
+/* ------------------------------------------------------------------
+ * Retained-Mode-Zustand
+ * Merkt sich, was zuletzt auf dem Bildschirm steht. render_frame
+ * vergleicht den neuen Spielzustand damit und zeichnet nur geänderte
+ * Zellen neu, statt jeden Frame erase() + Vollbild auszuführen.
+ * ------------------------------------------------------------------ */
+typedef struct
+{
+    bool drawn;         /* steht aktuell auf dem Bildschirm?          */
+    int  y;
+    int  x;             /* gerundete linke Kante                      */
+    int  width;
+    bool flash;         /* invertiert gezeichnet?                     */
+} paddle_span_t;
+
+static struct
+{
+    bool valid;         /* false → nächster Frame zeichnet alles neu   */
+    int  lines;         /* Terminalgröße beim letzten Vollbild         */
+    int  cols;
+
+    bool ball_drawn;
+    int  ball_y;
+    int  ball_x;
+
+    paddle_span_t player;
+    paddle_span_t bot;
+
+    bool hud_dirty;     /* HUD-Zeile wurde (teilweise) überschrieben   */
+    char score_txt[48];
+    char stats_txt[48];
+
+    int  overlay_y;     /* Countdown / Game Over über dem Spielfeld    */
+    int  overlay_x;
+    char overlay_txt[32];
+
+    bool perf_dirty;    /* Leistungszeile (untere Kante) überschrieben */
+    char perf_txt[96];
+} scene;
+
+/* /proc/self/io für die Byte-Zählung, -1 = noch nicht bzw. nicht offen */
+static int io_fd = -1;
+
+/* ------------------------------------------------------------------
+ * nc_init
+ * Setzt Terminalmodus und Farbpaare. Der erste Frame zeichnet
+ * vollständig.
+ *
+ * Parameter:
+ *   keine
+ *
+ * Rückgabe:
+ *   true bei Erfolg
+ * ------------------------------------------------------------------ */
+static bool nc_init(void)
+{
+    scene.valid = false;
+
+    initscr();
+    cbreak();
+    noecho();
+    keypad(stdscr, TRUE);
+    nodelay(stdscr, TRUE);
+    curs_set(0);
+
+    /* Farben, falls Terminal das kann */
+    if (has_colors()) {
+        start_color();
+        use_default_colors();          /* -1 übernimmt jeweils die Hintergrundfarbe des Terminals */
+        init_pair(1, COLOR_WHITE,  -1);   /* Farbpaar 1: Weiß auf Standardhintergrund – allgemeiner Text */
+        init_pair(2, COLOR_CYAN,   -1);   /* Farbpaar 2: Cyan – Ball */
+        init_pair(3, COLOR_YELLOW, -1);   /* Farbpaar 3: Gelb – Spieler‑Schläger */
+        init_pair(4, COLOR_MAGENTA,-1);   /* Farbpaar 4: Magenta – KI‑Schläger */
+        init_pair(5, COLOR_GREEN,  -1);   /* Farbpaar 5: Grün – Punktestand‑Zeile */
+        init_pair(6, COLOR_MAGENTA, -1);   /* Farbpaar 6: Magenta – KI‑Geschwindigkeit */
+        init_pair(7, COLOR_CYAN,    -1);   /* Farbpaar 7: Cyan – Ball‑Geschwindigkeit */
+    }
+    return true;
+}
+
+/* ------------------------------------------------------------------
+ * nc_size
+ * Liefert die Terminalgröße laut ncurses.
+ *
+ * Parameter:
+ *   width, height – Ausgabeparameter
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void nc_size(int *width, int *height)
+{
+    getmaxyx(stdscr, *height, *width);
+}
+
+/* ------------------------------------------------------------------
+ * nc_shutdown
+ * Verlässt den ncurses‑Modus.
+ *
+ * Parameter:
+ *   keine
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void nc_shutdown(void)
+{
+    if (io_fd >= 0) {
+        close(io_fd);
+        io_fd = -1;
+    }
+    cleanup_ncurses();      /* ncurses‑Modus verlassen und Terminalzustand wiederherstellen */
+}
+
+/* ------------------------------------------------------------------
+ * draw_border
+ * Zeichnet den statischen Spielfeldrahmen. Wird nur beim Vollbild
+ * (Start, Terminal-Resize, nach dem Countdown) aufgerufen.
+ *
+ * Parameter:
+ *   g – Zeiger auf aktuellen Spielzustand
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void draw_border(const game_state_t *g)
+{
+    attron(A_DIM);
+
+    /* obere Kante mit Ecken */
+    mvaddch(g->bot.y - 1,               0,                 ACS_ULCORNER);
+    mvhline(g->bot.y - 1,               1,                 ACS_HLINE, g->field_width - 2);
+    mvaddch(g->bot.y - 1, g->field_width - 1,              ACS_URCORNER);
+
+    /* untere Kante mit Ecken */
+    mvaddch(g->player.y + 1,            0,                 ACS_LLCORNER);
+    mvhline(g->player.y + 1,            1,                 ACS_HLINE, g->field_width - 2);
+    mvaddch(g->player.y + 1, g->field_width - 1,           ACS_LRCORNER);
+
+     /* linke und rechte Seiten */
+    int inner_height = g->player.y - g->bot.y + 1;   /* +1: bis zur Bottom-Line */
+    mvvline(g->bot.y, 0,                                    ACS_VLINE, inner_height);   /* Zeilen dazwischen*/
+    mvvline(g->bot.y, g->field_width-1,                     ACS_VLINE, inner_height);
+
+    attroff(A_DIM);
+}
+
+/* ------------------------------------------------------------------
+ * restore_cell
+ * Stellt den statischen Hintergrund einer Zelle wieder her (Rahmen
+ * oder Leerzeichen), nachdem Ball oder Paddle sie verlassen haben.
+ * Liegt die Zelle in der HUD-Zeile, wird das HUD zum Neuzeichnen
+ * markiert.
+ *
+ * Parameter:
+ *   g – Zeiger auf aktuellen Spielzustand
+ *   y – Zeile
+ *   x – Spalte
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void restore_cell(const game_state_t *g, int y, int x)
+{
+    int top    = g->bot.y - 1;
+    int bottom = g->player.y + 1;
+    int right  = g->field_width - 1;
+    chtype ch  = ' ';
+
+    if (y < top || y > bottom || x < 0 || x > right) {
+        mvaddch(y, x, ' ');                      /* außerhalb des Felds */
+        return;
+    }
+
+    if (y == top || y == bottom) {
+        if (x == 0)          ch = (y == top) ? ACS_ULCORNER : ACS_LLCORNER;
+        else if (x == right) ch = (y == top) ? ACS_URCORNER : ACS_LRCORNER;
+        else                 ch = ACS_HLINE;
+    } else if (x == 0 || x == right) {
+        ch = ACS_VLINE;
+    }
+
+    if (ch == ' ') {
+        mvaddch(y, x, ' ');
+    } else {
+        attron(A_DIM);
+        mvaddch(y, x, ch);
+        attroff(A_DIM);
+    }
+
+    if (y == 0)
+        scene.hud_dirty = true;
+    if (y == bottom && scene.perf_txt[0])
+        scene.perf_dirty = true;
+}
+
+/* ------------------------------------------------------------------
+ * draw_paddle
+ * Zeichnet ein Paddle als zusammenhängende Blockreihe auf dem
+ * Bildschirm. Bei aktiviertem Flash‑Flag wird das Paddle invertiert
+ * dargestellt, um einen Treffer optisch hervorzuheben.
+ *
+ * Parameter:
+ *   span  – Zeiger auf die zu zeichnende Paddle‑Spanne
+ *   color – ncurses-Farbpaar-ID
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+
+/* Fette, einfarbige Schläger */
+static void draw_paddle(const paddle_span_t *span, int color)
+{
+    if (span->flash) attron(A_REVERSE);
+    attron(COLOR_PAIR(color));
+    for (int i = 0; i < span->width; ++i)
+        mvaddch(span->y, span->x + i, ACS_BLOCK);
+    attroff(COLOR_PAIR(color));
+    if (span->flash) attroff(A_REVERSE);
+}
+
+/* ------------------------------------------------------------------
+ * update_paddle_span
+ * Vergleicht die neue Paddle‑Spanne mit der zuletzt gezeichneten und
+ * löscht bei Änderung die alte Spanne vom Bildschirm.
+ *
+ * Parameter:
+ *   g    – Zeiger auf aktuellen Spielzustand
+ *   old  – zuletzt gezeichnete Spanne (wird aktualisiert)
+ *   p    – Paddle im neuen Zustand (Zeile, Breite)
+ *   x    – gezeichnete Position (render_fx_t.pose)
+ *   flash – true = invertiert zeichnen
+ *
+ * Rückgabe:
+ *   true, wenn das Paddle neu gezeichnet werden muss
+ * ------------------------------------------------------------------ */
+static bool update_paddle_span(const game_state_t *g, paddle_span_t *old,
+                               const paddle_t *p, float x, bool flash)
+{
+    paddle_span_t now = { true, p->y, (int)lroundf(x), p->width, flash };
+
+    if (old->drawn &&
+        old->y == now.y && old->x == now.x &&
+        old->width == now.width && old->flash == now.flash)
+        return false;
+
+    if (old->drawn) {
+        /* Nur die Zellen löschen, die die neue Spanne nicht abdeckt */
+        for (int i = 0; i < old->width; ++i) {
+            int x = old->x + i;
+            if (old->y != now.y || x < now.x || x >= now.x + now.width)
+                restore_cell(g, old->y, x);
+        }
+    }
+
+    *old = now;
+    return true;
+}
+
+/* ------------------------------------------------------------------
+ * span_covers
+ * Prüft, ob eine Bildschirmzelle innerhalb einer Paddle‑Spanne liegt.
+ *
+ * Parameter:
+ *   s – Paddle‑Spanne
+ *   y – Zeile
+ *   x – Spalte
+ *
+ * Rückgabe:
+ *   true, wenn die Zelle vom Paddle belegt ist
+ * ------------------------------------------------------------------ */
+static bool span_covers(const paddle_span_t *s, int y, int x)
+{
+    return s->drawn && s->y == y && x >= s->x && x < s->x + s->width;
+}
+
+/* ------------------------------------------------------------------
+ * draw_hud
+ * Zeichnet die Score‑Zeile und die Schwierigkeitsindikatoren, sofern
+ * sich ihr Text geändert hat oder sie überschrieben wurden.
+ *
+ * Parameter:
+ *   g – Zeiger auf aktuellen Spielzustand
+ *
+ * Rückgabe:
+ *   true, wenn etwas gezeichnet wurde
+ * ------------------------------------------------------------------ */
+static bool draw_hud(const game_state_t *g)
+{
+    char score_txt[sizeof scene.score_txt];
+    char stats_txt[sizeof scene.stats_txt];
+
+    float bot_acc = BOT_BASE_ACCELERATION +
+                    BOT_ACCEL_PER_POINT * g->score;      /* aktuelle Bot‑Beschleunigung */
+
+    float ball_sp = sqrtf(g->ball.vx * g->ball.vx + g->ball.vy * g->ball.vy) *
+                    physics_tick_rate();                  /* Zellen / s */
+
+    snprintf(score_txt, sizeof score_txt, "Score: %d   (q = quit)", g->score);
+    snprintf(stats_txt, sizeof stats_txt, "%4.1f|%4.1f", bot_acc, ball_sp);
+
+    if (!scene.hud_dirty &&
+        strcmp(score_txt, scene.score_txt) == 0 &&
+        strcmp(stats_txt, scene.stats_txt) == 0)
+        return false;
+
+    /* Zeile 0 ist zugleich obere Rahmenkante: Reste alter, längerer
+       Texte mit dem Rahmen überschreiben                              */
+    int col = g->field_width - 25;   /* rechter Rand wie gehabt */
+    /* "Bot a:" + Wert + "  Ball: " + Wert, '|' trennt im Puffer    */
+    int old_end = col + 6 + (int)strlen(scene.stats_txt) - 1 + 8;
+    int new_end = col + 6 + (int)strlen(stats_txt) - 1 + 8;
+    for (int x = new_end; x < old_end; ++x)
+        restore_cell(g, 0, x);
+    old_end = 2 + (int)strlen(scene.score_txt);
+    new_end = 2 + (int)strlen(score_txt);
+    for (int x = new_end; x < old_end; ++x)
+        restore_cell(g, 0, x);
+
+    /* 2.  Score-Zeile ---------------------------------------------- */
+    attron(COLOR_PAIR(5) | A_BOLD);
+    mvprintw(0, 2, "%s", score_txt);
+    attroff(COLOR_PAIR(5) | A_BOLD);
+
+    /* 2a. Schwierigkeits‑Indikator ---------------------------------- */
+    /* Wir bauen die Zeile Stück für Stück, um die Werte einfärben zu können */
+    mvprintw(0, col, "Bot a:");
+    attron(COLOR_PAIR(6) | A_BOLD);
+    printw("%4.1f", bot_acc);
+    attroff(COLOR_PAIR(6) | A_BOLD);
+
+    printw("  Ball: ");
+    attron(COLOR_PAIR(7) | A_BOLD);
+    printw("%4.1f", ball_sp);
+    attroff(COLOR_PAIR(7) | A_BOLD);
+
+    memcpy(scene.score_txt, score_txt, sizeof score_txt);
+    memcpy(scene.stats_txt, stats_txt, sizeof stats_txt);
+    scene.hud_dirty = false;
+    return true;
+}
+
+/* ------------------------------------------------------------------
+ * draw_perf
+ * Zeichnet das Leistungs‑Overlay in die untere Rahmenkante bzw.
+ * stellt beim Ausblenden den Rahmen wieder her.
+ *
+ * Parameter:
+ *   g  – Zeiger auf aktuellen Spielzustand
+ *   fx – UI‑Effekte mit dem Overlay‑Text (NULL = aus)
+ *
+ * Rückgabe:
+ *   true, wenn etwas gezeichnet wurde
+ * ------------------------------------------------------------------ */
+static bool draw_perf(const game_state_t *g, const render_fx_t *fx)
+{
+    char txt[sizeof scene.perf_txt] = "";
+    int  y    = g->player.y + 1;
+    int  room = g->field_width - 3;          /* ab Spalte 2 bis vor die Ecke */
+
+    if (fx->perf && room > 0)
+        snprintf(txt, sizeof txt, "%.*s", room, fx->perf);
+
+    if (!scene.perf_dirty && strcmp(txt, scene.perf_txt) == 0)
+        return false;
+
+    int old_end = 2 + (int)strlen(scene.perf_txt);
+    for (int x = 2 + (int)strlen(txt); x < old_end; ++x)
+        restore_cell(g, y, x);
+    if (txt[0])
+        mvprintw(y, 2, "%s", txt);
+
+    memcpy(scene.perf_txt, txt, sizeof txt);
+    scene.perf_dirty = false;
+    return true;
+}
+
+/* ------------------------------------------------------------------
+ * proc_wchar
+ * Bisher vom Prozess geschriebene Bytes laut /proc/self/io. ncurses
+ * puffert und schreibt selbst; die Differenz über einen refresh()
+ * sind genau die Bytes zum Terminal.
+ *
+ * Parameter:
+ *   keine
+ *
+ * Rückgabe:
+ *   Bytes, 0 wenn nicht verfügbar (kein Linux‑procfs)
+ * ------------------------------------------------------------------ */
+static uint64_t proc_wchar(void)
+{
+    char buf[256];
+
+    if (io_fd < 0)
+        io_fd = open("/proc/self/io", O_RDONLY);
+    if (io_fd < 0)
+        return 0;
+
+    ssize_t n = pread(io_fd, buf, sizeof buf - 1, 0);
+    if (n <= 0)
+        return 0;
+    buf[n] = '\0';
+
+    const char *p = strstr(buf, "wchar:");
+    return p ? strtoull(p + 6, NULL, 10) : 0;
+}
+
+/* ------------------------------------------------------------------
+ * update_overlay
+ * Bestimmt den Overlay‑Text (Countdown‑Zahl oder Game‑Over‑Meldung)
+ * und löscht bei Änderung den zuletzt gezeichneten Text. Lag der alte
+ * Text über einem Paddle, wird dieses zum Neuzeichnen markiert; der
+ * Ball wird bei jeder Änderung ohnehin neu gezeichnet.
+ *
+ * Parameter:
+ *   g            – Zeiger auf aktuellen Spielzustand
+ *   fx           – UI‑Effekte mit Countdown/Game‑Over‑Status
+ *   player_dirty – Ausgabe: Spieler‑Paddle neu zeichnen (nur gesetzt)
+ *   bot_dirty    – Ausgabe: Bot‑Paddle neu zeichnen (nur gesetzt)
+ *
+ * Rückgabe:
+ *   true, wenn sich das Overlay geändert hat
+ * ------------------------------------------------------------------ */
+static bool update_overlay(const game_state_t *g, const render_fx_t *fx,
+                           bool *player_dirty, bool *bot_dirty)
+{
+    char txt[sizeof scene.overlay_txt] = "";
+    int  y = 0, x = 0;
+
+    if (fx->game_over) {
+        snprintf(txt, sizeof txt, "Game over - press any key");
+        y = g->field_height / 2;
+        x = 2;
+    } else if (fx->countdown > 0) {
+        snprintf(txt, sizeof txt, "%d", fx->countdown);
+        y = LINES / 2;
+        x = COLS / 2 - 1;
+    }
+
+    if (y == scene.overlay_y && x == scene.overlay_x &&
+        strcmp(txt, scene.overlay_txt) == 0)
+        return false;
+
+    for (int i = 0; scene.overlay_txt[i]; ++i) {
+        int cx = scene.overlay_x + i;
+        restore_cell(g, scene.overlay_y, cx);
+        if (span_covers(&scene.player, scene.overlay_y, cx)) *player_dirty = true;
+        if (span_covers(&scene.bot,    scene.overlay_y, cx)) *bot_dirty    = true;
+    }
+
+    scene.overlay_y = y;
+    scene.overlay_x = x;
+    memcpy(scene.overlay_txt, txt, sizeof txt);
+    return true;
+}
+
+/* ------------------------------------------------------------------
+ * nc_frame
+ * Zeichnet einen Frame im Retained Mode: nur Zellen, deren Inhalt
+ * sich seit dem letzten Frame geändert hat (Ball, Paddles, HUD),
+ * werden neu ausgegeben. Der Rahmen wird nur beim ersten Frame oder
+ * nach einem Terminal‑Resize neu gezeichnet. Countdown und Game‑Over‑
+ * Meldung liegen als Overlay über dem Spielfeld.
+ *
+ * Parameter:
+ *   g  – Zeiger auf aktuellen Spielzustand
+ *   fx – UI‑Effekte (Flash, Countdown, Game Over)
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+
+static void nc_frame(const game_state_t *g, const render_fx_t *fx)
+{
+    bool dirty = false;
+
+    /* 1.  Vollbild bei Start oder Resize --------------------------- */
+    int lines, cols;
+    getmaxyx(stdscr, lines, cols);
+    if (!scene.valid || lines != scene.lines || cols != scene.cols) {
+        erase();
+        draw_border(g);
+        scene.valid        = true;
+        scene.lines        = lines;
+        scene.cols         = cols;
+        scene.ball_drawn   = false;
+        scene.player.drawn = false;
+        scene.bot.drawn    = false;
+        scene.score_txt[0] = '\0';
+        scene.stats_txt[0] = '\0';
+        scene.overlay_txt[0] = '\0';
+        scene.perf_txt[0]  = '\0';
+        scene.hud_dirty    = true;
+        dirty = true;
+    }
+
+    /* 2.  Paddles: alte Spanne nur bei Änderung löschen -------------- */
+    bool player_dirty = update_paddle_span(g, &scene.player, &g->player,
+                                           fx->pose.player_x, fx->player_flash);
+    bool bot_dirty    = update_paddle_span(g, &scene.bot,    &g->bot,
+                                           fx->pose.bot_x,    fx->bot_flash);
+
+    /* 3.  Ball: verlassene Zelle wiederherstellen -------------------- */
+    int ball_y = (int)fx->pose.ball_y;
+    int ball_x = (int)fx->pose.ball_x;
+    bool ball_dirty = !scene.ball_drawn ||
+                      ball_y != scene.ball_y || ball_x != scene.ball_x;
+
+    if (ball_dirty && scene.ball_drawn) {
+        restore_cell(g, scene.ball_y, scene.ball_x);
+        /* Ball stand auf einem Paddle → Paddle dort neu zeichnen */
+        if (span_covers(&scene.player, scene.ball_y, scene.ball_x)) player_dirty = true;
+        if (span_covers(&scene.bot,    scene.ball_y, scene.ball_x)) bot_dirty    = true;
+    }
+
+    /* Overlay geändert → alten Text entfernen, verdeckte Objekte und
+       alles darüber neu */
+    if (update_overlay(g, fx, &player_dirty, &bot_dirty))
+        dirty = true;
+
+    /* 4.  HUD ------------------------------------------------------- */
+    if (draw_hud(g))
+        dirty = true;
+    if (draw_perf(g, fx))
+        dirty = true;
+
+    /* 5.  Spielobjekte --------------------------------------------- */
+    if (player_dirty) draw_paddle(&scene.player, 3);
+    if (bot_dirty)    draw_paddle(&scene.bot,    4);
+    dirty = dirty || player_dirty || bot_dirty || ball_dirty;
+
+    /* Ball zuletzt, damit er über neu gezeichneten Paddles/HUD liegt */
+    if (dirty) {
+        attron(COLOR_PAIR(2) | A_BOLD);
+        mvaddch(ball_y, ball_x, ACS_DIAMOND);
+        attroff(COLOR_PAIR(2) | A_BOLD);
+        scene.ball_drawn = true;
+        scene.ball_y     = ball_y;
+        scene.ball_x     = ball_x;
+
+        /* 6.  Overlay über allem ----------------------------------- */
+        if (scene.overlay_txt[0])
+            mvprintw(scene.overlay_y, scene.overlay_x, "%s", scene.overlay_txt);
+
+        if (fx->perf) {
+            uint64_t bytes0 = proc_wchar();
+            uint64_t t0     = instr_now_ns();
+            refresh();
+            uint64_t t1     = instr_now_ns();
+            uint64_t bytes1 = proc_wchar();
+            render_perf_output(t1 - t0, bytes1 > bytes0 ? bytes1 - bytes0 : 0);
+        } else {
+            refresh();
+        }
+    }
+}
+
+const render_backend_t render_backend_ncurses = {
+    .name      = "ncurses",
+    .input     = INPUT_SRC_NCURSES,
+    .headless  = false,
+    .init      = nc_init,
+    .size      = nc_size,
+    .frame     = nc_frame,
+    .shutdown  = nc_shutdown,
+};
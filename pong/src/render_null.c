@@ -0,0 +1,37 @@
+/* ------------------------------------------------------------------
+ * render_null.c - Leeres Backend für Headless-Läufe
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ *
+ * Zeichnet nichts und wartet nie. Damit läuft die komplette
+ * Spielschleife ohne Terminal mit maximaler Geschwindigkeit.
+ * ------------------------------------------------------------------ */
+
+#include "render_backend.h"
+
+static bool null_init(void) { return true; }
+
+/* Größe eines Standard‑Terminals, damit das Spielfeld gleich aussieht */
+static void null_size(int *width, int *height)
+{
+    *width  = 80;
+    *height = 24;
+}
+
+static void null_frame(const game_state_t *g, const render_fx_t *fx)
+{
+    (void)g;
+    (void)fx;
+}
+
+static void null_shutdown(void) {}
+
+const render_backend_t render_backend_null = {
+    .name      = "null",
+    .input     = INPUT_SRC_NONE,
+    .headless  = true,
+    .init      = null_init,
+    .size      = null_size,
+    .frame     = null_frame,
+    .shutdown  = null_shutdown,
+};
@@ -0,0 +1,360 @@
+/* ------------------------------------------------------------------
+ * render_raw.c - Darstellung über eigenen Framebuffer und ANSI-Codes
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ *
+ * Zwei Zellpuffer (front = Terminalinhalt, back = neuer Frame). Pro
+ * Frame wird back komponiert, gegen front verglichen und nur die
+ * geänderten Zellen als Cursor‑Sprung + SGR + Glyph in einen
+ * vorab allozierten Puffer kodiert, der mit genau einem write(2)
+ * ausgegeben wird.
+ * ------------------------------------------------------------------ */
+
+#include <errno.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+#include "render_backend.h"
+#include "cells.h"
+#include "instr.h"
+
+/* Worst case je Zelle: CUP (14) + SGR (14) + UTF‑8‑Glyph (3) */
+#define RAW_BYTES_PER_CELL 32
+#define RAW_BYTES_EXTRA    64
+
+static struct
+{
+    int     cols;
+    int     rows;
+    cell_t *front;
+    cell_t *back;
+    char   *out;
+    size_t  out_cap;
+
+    int     cur_y;          /* Cursorposition im Terminal, -1 = unbekannt */
+    int     cur_x;
+    int     cur_attr;       /* aktives SGR‑Attribut, -1 = unbekannt       */
+
+    struct termios saved_tio;
+    bool    tio_saved;
+} fb;
+
+static volatile sig_atomic_t resized = 0;
+
+/* UTF‑8‑Sequenzen der Sonder‑Glyphen (Index = GLYPH_*) */
+static const char *const glyph_utf8[] = {
+    " ", "\xe2\x94\x80", "\xe2\x94\x82", "\xe2\x94\x8c", "\xe2\x94\x90",
+    "\xe2\x94\x94", "\xe2\x94\x98", "\xe2\x96\x88", "\xe2\x97\x86",
+};
+
+/* ANSI‑Vordergrundfarbe je Farbpaar (wie init_pair in der ncurses‑UI) */
+static const char color_code[] = { 0, '7', '6', '3', '5', '2', '5', '6' };
+
+/* ------------------------------------------------------------------
+ * on_winch
+ * Signal‑Handler für SIGWINCH; merkt sich nur die Größenänderung.
+ * ------------------------------------------------------------------ */
+static void on_winch(int sig)
+{
+    (void)sig;
+    resized = 1;
+}
+
+/* ------------------------------------------------------------------
+ * write_all
+ * Gibt einen Puffer vollständig auf stdout aus (im Normalfall ein
+ * einziger write‑Aufruf).
+ *
+ * Parameter:
+ *   buf – Daten
+ *   len – Länge in Bytes
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void write_all(const char *buf, size_t len)
+{
+    while (len > 0) {
+        ssize_t n = write(STDOUT_FILENO, buf, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return;
+        }
+        buf += n;
+        len -= (size_t)n;
+    }
+}
+
+/* ------------------------------------------------------------------
+ * put_uint
+ * Hängt eine Dezimalzahl ohne printf an den Ausgabepuffer an.
+ *
+ * Parameter:
+ *   p – Schreibposition
+ *   v – Zahl
+ *
+ * Rückgabe:
+ *   neue Schreibposition
+ * ------------------------------------------------------------------ */
+static char *put_uint(char *p, unsigned int v)
+{
+    char tmp[10];
+    int n = 0;
+    do { tmp[n++] = (char)('0' + v % 10); v /= 10; } while (v);
+    while (n) *p++ = tmp[--n];
+    return p;
+}
+
+/* ------------------------------------------------------------------
+ * alloc_buffers
+ * Fragt die Terminalgröße ab und legt Zell- und Ausgabepuffer an.
+ * Läuft nur beim Start und nach einem Resize.
+ *
+ * Parameter:
+ *   keine
+ *
+ * Rückgabe:
+ *   true bei Erfolg
+ * ------------------------------------------------------------------ */
+static bool alloc_buffers(void)
+{
+    struct winsize ws;
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &ws) != 0 || ws.ws_col == 0) {
+        ws.ws_col = 80;
+        ws.ws_row = 24;
+    }
+
+    free(fb.front);
+    free(fb.back);
+    free(fb.out);
+
+    fb.cols    = ws.ws_col;
+    fb.rows    = ws.ws_row;
+    fb.front   = malloc(sizeof(cell_t) * (size_t)fb.cols * (size_t)fb.rows);
+    fb.back    = malloc(sizeof(cell_t) * (size_t)fb.cols * (size_t)fb.rows);
+    fb.out_cap = (size_t)fb.cols * (size_t)fb.rows * RAW_BYTES_PER_CELL + RAW_BYTES_EXTRA;
+    fb.out     = malloc(fb.out_cap);
+    if (!fb.front || !fb.back || !fb.out)
+        return false;
+
+    /* Terminal wird gelöscht → front entspricht leerem Bildschirm */
+    cells_clear(fb.front, fb.cols, fb.rows);
+    fb.cur_y = fb.cur_x = fb.cur_attr = -1;
+    write_all("\x1b[0m\x1b[2J", 8);
+    return true;
+}
+
+/* ------------------------------------------------------------------
+ * raw_init
+ * Schaltet das Terminal in den Raw‑Modus (alternativer Bildschirm,
+ * Cursor aus, kein Auto‑Wrap) und legt die Framebuffer an.
+ *
+ * Parameter:
+ *   keine
+ *
+ * Rückgabe:
+ *   true bei Erfolg
+ * ------------------------------------------------------------------ */
+static bool raw_init(void)
+{
+    struct termios tio;
+    if (tcgetattr(STDIN_FILENO, &fb.saved_tio) == 0) {
+        fb.tio_saved = true;
+        tio = fb.saved_tio;
+        tio.c_lflag &= ~(tcflag_t)(ICANON | ECHO);
+        tio.c_cc[VMIN]  = 0;
+        tio.c_cc[VTIME] = 0;
+        tcsetattr(STDIN_FILENO, TCSANOW, &tio);
+    }
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof sa);
+    sa.sa_handler = on_winch;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGWINCH, &sa, NULL);
+
+    /* alternativer Bildschirm, Cursor verstecken, Auto‑Wrap aus */
+    write_all("\x1b[?1049h\x1b[?25l\x1b[?7l", 19);
+    return alloc_buffers();
+}
+
+/* ------------------------------------------------------------------
+ * raw_size
+ * Liefert die aktuelle Terminalgröße in Zellen.
+ *
+ * Parameter:
+ *   cols, rows – Ausgabeparameter
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void raw_size(int *cols, int *rows)
+{
+    *cols = fb.cols;
+    *rows = fb.rows;
+}
+
+/* ------------------------------------------------------------------
+ * encode_diff
+ * Vergleicht back mit front und kodiert jede geänderte Zelle als
+ * minimale Folge aus Cursor‑Bewegung, SGR und Glyph.
+ *
+ * Parameter:
+ *   keine
+ *
+ * Rückgabe:
+ *   Anzahl kodierter Bytes
+ * ------------------------------------------------------------------ */
+static size_t encode_diff(void)
+{
+    char *p = fb.out;
+
+    for (int y = 0; y < fb.rows; ++y) {
+        const cell_t *f = fb.front + y * fb.cols;
+        const cell_t *b = fb.back  + y * fb.cols;
+
+        for (int x = 0; x < fb.cols; ++x) {
+            if (f[x].glyph == b[x].glyph && f[x].attr == b[x].attr)
+                continue;
+
+            /* Cursor: nichts, CUF (gleiche Zeile) oder CUP */
+            if (fb.cur_y != y || fb.cur_x != x) {
+                /* Kurze Lücke aus unveränderten ASCII-Zellen mit gleichem
+                   Attribut: Zeichen erneut ausgeben ist kürzer als CUF   */
+                int gap = (fb.cur_y == y && fb.cur_x >= 0) ? x - fb.cur_x : 0;
+                bool reuse = gap > 0 && gap <= 3;
+                for (int k = fb.cur_x; reuse && k < x; ++k)
+                    reuse = b[k].attr == fb.cur_attr && b[k].glyph > GLYPH_DIAMOND;
+                if (reuse) {
+                    for (int k = fb.cur_x; k < x; ++k)
+                        *p++ = (char)b[k].glyph;
+                } else if (gap > 0 && gap < 1000) {
+                    *p++ = '\x1b'; *p++ = '[';
+                    if (x - fb.cur_x > 1) p = put_uint(p, (unsigned)(x - fb.cur_x));
+                    *p++ = 'C';
+                } else {
+                    *p++ = '\x1b'; *p++ = '[';
+                    p = put_uint(p, (unsigned)y + 1);
+                    *p++ = ';';
+                    p = put_uint(p, (unsigned)x + 1);
+                    *p++ = 'H';
+                }
+            }
+
+            /* SGR nur bei Attributwechsel */
+            if (fb.cur_attr != b[x].attr) {
+                unsigned a = b[x].attr;
+                *p++ = '\x1b'; *p++ = '['; *p++ = '0';
+                if (a & CELL_BOLD)    { *p++ = ';'; *p++ = '1'; }
+                if (a & CELL_DIM)     { *p++ = ';'; *p++ = '2'; }
+                if (a & CELL_REVERSE) { *p++ = ';'; *p++ = '7'; }
+                if (a & CELL_COLOR_MASK) {
+                    *p++ = ';'; *p++ = '3'; *p++ = color_code[a & CELL_COLOR_MASK];
+                }
+                *p++ = 'm';
+                fb.cur_attr = b[x].attr;
+            }
+
+            unsigned char g = b[x].glyph;
+            if (g <= GLYPH_DIAMOND) {
+                const char *s = glyph_utf8[g];
+                while (*s) *p++ = *s++;
+            } else {
+                *p++ = (char)g;
+            }
+
+            fb.cur_y = y;
+            fb.cur_x = (x + 1 < fb.cols) ? x + 1 : -1;   /* ohne Auto‑Wrap */
+        }
+    }
+    return (size_t)(p - fb.out);
+}
+
+/* ------------------------------------------------------------------
+ * flush_back
+ * Kodiert die Differenz back/front, schreibt sie mit einem write()
+ * und tauscht die Puffer.
+ *
+ * Parameter:
+ *   keine
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void flush_back(void)
+{
+    size_t len = encode_diff();
+    if (len > 0) {
+        if (render_perf_shown()) {
+            uint64_t t0 = instr_now_ns();
+            write_all(fb.out, len);
+            render_perf_output(instr_now_ns() - t0, len);
+        } else {
+            write_all(fb.out, len);
+        }
+    }
+
+    cell_t *tmp = fb.front;
+    fb.front = fb.back;
+    fb.back  = tmp;
+}
+
+/* ------------------------------------------------------------------
+ * raw_frame
+ * Komponiert den Frame in den Back‑Buffer und gibt nur die
+ * Änderungen gegenüber dem letzten Frame aus.
+ *
+ * Parameter:
+ *   g  – Zeiger auf aktuellen Spielzustand
+ *   fx – UI‑Effekte (Flash, Countdown, Game Over)
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void raw_frame(const game_state_t *g, const render_fx_t *fx)
+{
+    if (resized) {
+        resized = 0;
+        if (!alloc_buffers())
+            return;
+    }
+
+    cells_compose(fb.back, fb.cols, fb.rows, g, fx);
+    flush_back();
+}
+
+/* ------------------------------------------------------------------
+ * raw_shutdown
+ * Stellt Terminalmodus und Bildschirm wieder her und gibt die Puffer
+ * frei.
+ *
+ * Parameter:
+ *   keine
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void raw_shutdown(void)
+{
+    write_all("\x1b[0m\x1b[?7h\x1b[?25h\x1b[?1049l", 23);
+    if (fb.tio_saved)
+        tcsetattr(STDIN_FILENO, TCSANOW, &fb.saved_tio);
+
+    free(fb.front);
+    free(fb.back);
+    free(fb.out);
+    memset(&fb, 0, sizeof fb);
+}
+
+const render_backend_t render_backend_raw = {
+    .name      = "raw",
+    .input     = INPUT_SRC_RAW,
+    .headless  = false,
+    .init      = raw_init,
+    .size      = raw_size,
+    .frame     = raw_frame,
+    .shutdown  = raw_shutdown,
+};
@@ -0,0 +1,816 @@
+/* ------------------------------------------------------------------
+ * replay.c - Aufzeichnung und Wiedergabe von Eingaben
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ *
+ * Aufgezeichnet wird nur, was die Simulation von außen bekommt: Seed
+ * und die Folge der Befehle "Spielerbewegung dx" und "Physik-Tick".
+ * Gleiche aufeinanderfolgende Befehle werden zu Läufen zusammengefasst
+ * und als Varint geschrieben; lange Phasen mit gleicher Taste kosten
+ * so nur wenige Bytes. Die Wiedergabe führt die Befehle in derselben
+ * Reihenfolge aus und vergleicht Score und Zustands-Hash am Ende.
+ *
+ * Alle REPLAY_KEYFRAME_TICKS Ticks steht ein vollständiger Snapshot im
+ * Befehlsstrom, ein Index am Dateiende verweist auf sie. Abgespielt
+ * wird aus einem Read-only-Mapping der Datei; Springen kostet einen
+ * Keyframe plus höchstens K nachsimulierte Ticks.
+ * ------------------------------------------------------------------ */
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "replay.h"
+#include "ai.h"
+
+static const char replay_magic[8] = { 'P', 'O', 'N', 'G', 'R', 'P', 'L', 'Y' };
+
+#define HEADER_SIZE  (8 + 2 + 2 + 2 + 8 + 8 + 4 + 2)
+#define TRAILER_SIZE (8 + 4 + 8)
+#define INDEX_ENTRY  (8 + 8)
+#define FOOTER_SIZE  (4 + 8 + 8)
+
+#define KEYFRAME_MARK 1u            /* Varint: Lauflänge 0, Code 1 */
+
+/* Keyframe hinter der Markierung, Feld für Feld (siehe keyframe_put) */
+#define PADDLE_SIZE   (4 + 4 + 4 + 4 + 4)
+#define KEYFRAME_SIZE (8 + 1 + 1 + 2 + 4 + 4 + 2 * PADDLE_SIZE + 4 * 4 + \
+                       4 + 4 + 8 + 8 + 1 + 3 * 4)
+
+static const char index_magic[8] = { 'P', 'O', 'N', 'G', 'I', 'D', 'X', '1' };
+
+/* ------------------------------------------------------------------
+ * put_le / get_le
+ * Schreiben bzw. lesen eine vorzeichenlose Zahl mit n Bytes, little
+ * endian – unabhängig von der Byte-Reihenfolge des Rechners.
+ * ------------------------------------------------------------------ */
+static uint8_t *put_le(uint8_t *p, uint64_t v, int n)
+{
+    for (int i = 0; i < n; ++i)
+        *p++ = (uint8_t)(v >> (8 * i));
+    return p;
+}
+
+static uint64_t get_le(const uint8_t *p, int n)
+{
+    uint64_t v = 0;
+    for (int i = 0; i < n; ++i)
+        v |= (uint64_t)p[i] << (8 * i);
+    return v;
+}
+
+/* ------------------------------------------------------------------
+ * put_f32 / get_f32 / put_i32 / get_i32
+ * float als IEEE-754-Bitmuster bzw. int als Zweierkomplement, je
+ * 4 Bytes little endian.
+ * ------------------------------------------------------------------ */
+static uint8_t *put_f32(uint8_t *p, float f)
+{
+    uint32_t u;
+    memcpy(&u, &f, sizeof u);
+    return put_le(p, u, 4);
+}
+
+static float get_f32(const uint8_t *p)
+{
+    uint32_t u = (uint32_t)get_le(p, 4);
+    float    f;
+    memcpy(&f, &u, sizeof f);
+    return f;
+}
+
+static uint8_t *put_i32(uint8_t *p, int v)
+{
+    return put_le(p, (uint32_t)v, 4);
+}
+
+static int get_i32(const uint8_t *p)
+{
+    return (int)(int32_t)(uint32_t)get_le(p, 4);
+}
+
+/* ------------------------------------------------------------------
+ * put_paddle / get_paddle
+ * Ein Paddle: f32 x, i32 y, i32 Breite, f32 vx, f32 ax.
+ * ------------------------------------------------------------------ */
+static uint8_t *put_paddle(uint8_t *p, const paddle_t *pd)
+{
+    p = put_f32(p, pd->x);
+    p = put_i32(p, pd->y);
+    p = put_i32(p, pd->width);
+    p = put_f32(p, pd->vx);
+    return put_f32(p, pd->ax);
+}
+
+static const uint8_t *get_paddle(const uint8_t *p, paddle_t *pd)
+{
+    pd->x     = get_f32(p);
+    pd->y     = get_i32(p + 4);
+    pd->width = get_i32(p + 8);
+    pd->vx    = get_f32(p + 12);
+    pd->ax    = get_f32(p + 16);
+    return p + PADDLE_SIZE;
+}
+
+/* ------------------------------------------------------------------
+ * keyframe_put
+ * Schreibt einen Snapshot in KEYFRAME_SIZE Bytes: u64 Tick, u8 Löser,
+ * u8 Zahlenformat, u16 Tickrate, i32 Breite, i32 Höhe, Spieler, Bot,
+ * Ball (4 × f32), i32 Score, i32 Paddle-Hits, u64 RNG-Zustand,
+ * u64 RNG-Inkrement, u8 KI-Cache gültig, 3 × f32 KI-Cache. Anders als
+ * der physics_snapshot_t im Speicher hängt das nicht von Byte-
+ * Reihenfolge, Füllbytes oder ABI ab.
+ *
+ * Parameter:
+ *   p    – Ziel (KEYFRAME_SIZE Bytes)
+ *   snap – Snapshot aus physics_save
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void keyframe_put(uint8_t *p, const physics_snapshot_t *snap)
+{
+    const game_state_t *g = &snap->game;
+
+    p = put_le(p, snap->tick, 8);
+    p = put_le(p, snap->solver, 1);
+    p = put_le(p, snap->numeric, 1);
+    p = put_le(p, snap->tick_hz, 2);
+    p = put_i32(p, g->field_width);
+    p = put_i32(p, g->field_height);
+    p = put_paddle(p, &g->player);
+    p = put_paddle(p, &g->bot);
+    p = put_f32(p, g->ball.x);
+    p = put_f32(p, g->ball.y);
+    p = put_f32(p, g->ball.vx);
+    p = put_f32(p, g->ball.vy);
+    p = put_i32(p, g->score);
+    p = put_i32(p, g->paddle_hits);
+    p = put_le(p, g->rng.state, 8);
+    p = put_le(p, g->rng.inc, 8);
+    p = put_le(p, g->bot_ai.valid ? 1u : 0u, 1);
+    p = put_f32(p, g->bot_ai.ball_vx);
+    p = put_f32(p, g->bot_ai.ball_vy);
+    put_f32(p, g->bot_ai.target_x);
+}
+
+/* ------------------------------------------------------------------
+ * keyframe_get
+ * Gegenstück zu keyframe_put: baut daraus einen Snapshot für
+ * physics_restore (Kennung, Version und Größe des laufenden
+ * Programms).
+ *
+ * Parameter:
+ *   p    – Quelle (KEYFRAME_SIZE Bytes, beliebig ausgerichtet)
+ *   snap – Ausgabe
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void keyframe_get(const uint8_t *p, physics_snapshot_t *snap)
+{
+    game_state_t *g = &snap->game;
+
+    memset(snap, 0, sizeof *snap);
+    snap->magic   = PHYS_SNAPSHOT_MAGIC;
+    snap->version = PHYS_SNAPSHOT_VERSION;
+    snap->size    = (uint16_t)sizeof *snap;
+    snap->tick    = get_le(p, 8);
+    snap->solver  = (uint8_t)p[8];
+    snap->numeric = (uint8_t)p[9];
+    snap->tick_hz = (uint16_t)get_le(p + 10, 2);
+    p += 12;
+    g->field_width  = get_i32(p);
+    g->field_height = get_i32(p + 4);
+    p = get_paddle(p + 8, &g->player);
+    p = get_paddle(p, &g->bot);
+    g->ball.x       = get_f32(p);
+    g->ball.y       = get_f32(p + 4);
+    g->ball.vx      = get_f32(p + 8);
+    g->ball.vy      = get_f32(p + 12);
+    g->score        = get_i32(p + 16);
+    g->paddle_hits  = get_i32(p + 20);
+    g->rng.state    = get_le(p + 24, 8);
+    g->rng.inc      = get_le(p + 32, 8);
+    g->bot_ai.valid    = p[40] != 0;
+    g->bot_ai.ball_vx  = get_f32(p + 41);
+    g->bot_ai.ball_vy  = get_f32(p + 45);
+    g->bot_ai.target_x = get_f32(p + 49);
+}
+
+/* ------------------------------------------------------------------
+ * replay_put_varint
+ * Kodiert v als LEB128 (7 Bit pro Byte, oberstes Bit = es folgt mehr).
+ *
+ * Parameter:
+ *   out – Ziel, mindestens 10 Bytes
+ *   v   – Wert
+ *
+ * Rückgabe:
+ *   Anzahl geschriebener Bytes
+ * ------------------------------------------------------------------ */
+size_t replay_put_varint(uint8_t *out, uint64_t v)
+{
+    size_t n = 0;
+    while (v >= 0x80u) {
+        out[n++] = (uint8_t)(v | 0x80u);
+        v >>= 7;
+    }
+    out[n++] = (uint8_t)v;
+    return n;
+}
+
+/* ------------------------------------------------------------------
+ * replay_get_varint
+ * Dekodiert einen LEB128-Wert.
+ *
+ * Parameter:
+ *   in  – Eingabe
+ *   len – verfügbare Bytes
+ *   v   – Ausgabe
+ *
+ * Rückgabe:
+ *   verbrauchte Bytes, 0 bei abgeschnittener oder zu langer Zahl
+ * ------------------------------------------------------------------ */
+size_t replay_get_varint(const uint8_t *in, size_t len, uint64_t *v)
+{
+    *v = 0;
+    for (size_t i = 0; i < len && i < 10; ++i) {
+        *v |= (uint64_t)(in[i] & 0x7Fu) << (7 * i);
+        if (!(in[i] & 0x80u))
+            return i + 1;
+    }
+    return 0;
+}
+
+/* ------------------------------------------------------------------
+ * rec_write / rec_flush
+ * Hängen Bytes an den Schreibpuffer bzw. geben ihn an die Datei ab.
+ * ------------------------------------------------------------------ */
+static void rec_flush(replay_rec_t *rec)
+{
+    if (rec->len > 0 && fwrite(rec->buf, 1, rec->len, rec->file) != rec->len)
+        rec->ok = false;
+    rec->len = 0;
+}
+
+static void rec_write(replay_rec_t *rec, const void *data, size_t n)
+{
+    if (rec->len + n > sizeof rec->buf)
+        rec_flush(rec);
+    if (n > sizeof rec->buf) {                  /* passt nie in den Puffer */
+        if (fwrite(data, 1, n, rec->file) != n)
+            rec->ok = false;
+    } else {
+        memcpy(rec->buf + rec->len, data, n);
+        rec->len += n;
+    }
+    rec->offset += n;
+}
+
+/* Schreibt den angefangenen Lauf; der nächste Befehl beginnt neu */
+static void rec_end_run(replay_rec_t *rec)
+{
+    if (rec->run_len > 0) {
+        uint8_t v[10];
+        rec_write(rec, v, replay_put_varint(v, rec->run_len << 3 | rec->run_code));
+    }
+    rec->run_len = 0;
+}
+
+/* ------------------------------------------------------------------
+ * rec_emit
+ * Zählt einen Befehl zum laufenden Lauf oder schließt den Lauf ab und
+ * beginnt einen neuen.
+ *
+ * Parameter:
+ *   rec  – Rekorder
+ *   code – Tick << 2 | Eingabecode
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void rec_emit(replay_rec_t *rec, unsigned code)
+{
+    if (rec->run_len > 0 && code == rec->run_code) {
+        rec->run_len++;
+        return;
+    }
+    rec_end_run(rec);
+    rec->run_code = code;
+    rec->run_len  = 1;
+}
+
+/* Eingabecode: 0 = dx 0, 1 = +1, 2 = -1, 3 = keine Bewegung */
+static unsigned input_code(int dx)
+{
+    if (dx == REPLAY_NO_INPUT) return 3u;
+    return dx > 0 ? 1u : dx < 0 ? 2u : 0u;
+}
+
+/* ------------------------------------------------------------------
+ * rec_keyframe
+ * Schließt den laufenden Lauf ab, schreibt Markierung und Snapshot
+ * und merkt sich Tick und Position für den Index.
+ *
+ * Parameter:
+ *   rec  – Rekorder
+ *   game – Zustand nach dem aktuellen Tick
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void rec_keyframe(replay_rec_t *rec, const game_state_t *game)
+{
+    if (rec->keyframes == rec->index_cap) {
+        size_t    cap   = rec->index_cap ? rec->index_cap * 2 : 64;
+        uint64_t *grown = realloc(rec->index, cap * 2 * sizeof *grown);
+        if (!grown) {
+            rec->ok = false;
+            return;
+        }
+        rec->index     = grown;
+        rec->index_cap = cap;
+    }
+    rec_end_run(rec);
+    rec->index[2 * rec->keyframes]     = rec->ticks;
+    rec->index[2 * rec->keyframes + 1] = rec->offset;
+    rec->keyframes++;
+
+    physics_snapshot_t snap;
+    uint8_t            kf[1 + KEYFRAME_SIZE];
+    physics_save(game, rec->ticks, &snap);
+    kf[0] = KEYFRAME_MARK;
+    keyframe_put(kf + 1, &snap);
+    rec_write(rec, kf, sizeof kf);
+}
+
+/* ------------------------------------------------------------------
+ * replay_rec_open
+ * Legt eine Aufzeichnung an und schreibt den Kopf.
+ *
+ * Parameter:
+ *   rec  – Rekorder
+ *   path – Dateiname
+ *   info – Startparameter des Spiels
+ *
+ * Rückgabe:
+ *   false, wenn die Datei nicht angelegt werden konnte
+ * ------------------------------------------------------------------ */
+bool replay_rec_open(replay_rec_t *rec, const char *path, const replay_info_t *info)
+{
+    memset(rec, 0, sizeof *rec);
+    rec->file = fopen(path, "wb");
+    if (!rec->file)
+        return false;
+    rec->ok      = true;
+    rec->pending = REPLAY_NO_INPUT;
+    rec->keyframe_ticks = REPLAY_KEYFRAME_TICKS;
+
+    uint8_t h[HEADER_SIZE], *p = h;
+    memcpy(p, replay_magic, sizeof replay_magic);
+    p += sizeof replay_magic;
+    p = put_le(p, REPLAY_VERSION, 2);
+    p = put_le(p, info->width, 2);
+    p = put_le(p, info->height, 2);
+    p = put_le(p, info->seed, 8);
+    p = put_le(p, info->stream, 8);
+    *p++ = info->solver;
+    *p++ = info->numeric;
+    *p++ = info->ai_mode;
+    *p++ = 0;
+    p = put_le(p, info->tick_hz, 2);
+    rec_write(rec, h, sizeof h);
+    return true;
+}
+
+/* ------------------------------------------------------------------
+ * replay_rec_input
+ * Meldet eine Spielerbewegung (physics_player_update mit dx). Sie wird
+ * mit dem folgenden Tick zu einem Befehl zusammengefasst.
+ *
+ * Parameter:
+ *   rec – Rekorder (NULL = keine Aufzeichnung)
+ *   dx  – Richtung -1/0/+1
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void replay_rec_input(replay_rec_t *rec, int dx)
+{
+    if (!rec)
+        return;
+    if (rec->pending != REPLAY_NO_INPUT)
+        rec_emit(rec, input_code(rec->pending));
+    rec->pending = dx;
+}
+
+/* ------------------------------------------------------------------
+ * replay_rec_tick
+ * Meldet einen Physik-Tick (ai_update + physics_update_ball_events);
+ * legt alle rec->keyframe_ticks Ticks (Standard REPLAY_KEYFRAME_TICKS,
+ * Tests wählen kleinere) einen Keyframe ab und schreibt
+ * den Puffer spätestens alle REPLAY_FLUSH_TICKS Ticks weg.
+ *
+ * Parameter:
+ *   rec  – Rekorder (NULL = keine Aufzeichnung)
+ *   game – Zustand nach dem Tick
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void replay_rec_tick(replay_rec_t *rec, const game_state_t *game)
+{
+    if (!rec)
+        return;
+    rec_emit(rec, 4u | input_code(rec->pending));
+    rec->pending = REPLAY_NO_INPUT;
+    rec->ticks++;
+
+    if (rec->ticks % rec->keyframe_ticks == 0)
+        rec_keyframe(rec, game);
+
+    if (++rec->unflushed >= REPLAY_FLUSH_TICKS) {
+        rec_flush(rec);
+        if (fflush(rec->file) != 0)
+            rec->ok = false;
+        rec->unflushed = 0;
+    }
+}
+
+/* ------------------------------------------------------------------
+ * replay_rec_close
+ * Schließt den letzten Lauf ab, schreibt Endmarke, Trailer mit dem
+ * Endzustand, Keyframe-Index und Fuß und schließt die Datei.
+ *
+ * Parameter:
+ *   rec  – Rekorder
+ *   game – Endzustand des Spiels
+ *
+ * Rückgabe:
+ *   false bei Schreibfehler
+ * ------------------------------------------------------------------ */
+bool replay_rec_close(replay_rec_t *rec, const game_state_t *game)
+{
+    if (rec->pending != REPLAY_NO_INPUT)
+        rec_emit(rec, input_code(rec->pending));
+    rec_end_run(rec);
+
+    uint8_t t[1 + TRAILER_SIZE], *p = t;
+    *p++ = 0;
+    p = put_le(p, rec->ticks, 8);
+    p = put_le(p, (uint32_t)game->score, 4);
+    p = put_le(p, physics_state_hash(game), 8);
+    rec_write(rec, t, sizeof t);
+
+    uint64_t index_pos = rec->offset;
+    for (size_t i = 0; i < rec->keyframes; ++i) {
+        uint8_t e[INDEX_ENTRY];
+        put_le(put_le(e, rec->index[2 * i], 8), rec->index[2 * i + 1], 8);
+        rec_write(rec, e, sizeof e);
+    }
+    uint8_t f[FOOTER_SIZE];
+    p = put_le(f, rec->keyframes, 4);
+    p = put_le(p, index_pos, 8);
+    memcpy(p, index_magic, sizeof index_magic);
+    rec_write(rec, f, sizeof f);
+    rec_flush(rec);
+
+    free(rec->index);
+    rec->index = NULL;
+
+    if (fclose(rec->file) != 0)
+        rec->ok = false;
+    rec->file = NULL;
+    return rec->ok;
+}
+
+/* ------------------------------------------------------------------
+ * replay_view_open
+ * Blendet eine Aufzeichnung read-only ein, prüft Kopf, Fuß und Index
+ * und stellt den Startzustand her (Tick 0). Tickrate, Löser,
+ * Zahlenformat und KI-Modus werden aus dem Kopf übernommen.
+ *
+ * Parameter:
+ *   view – Ausgabe
+ *   path – Dateiname
+ *
+ * Rückgabe:
+ *   false, wenn die Datei fehlt oder kein gültiges Replay ist
+ * ------------------------------------------------------------------ */
+bool replay_view_open(replay_view_t *view, const char *path)
+{
+    memset(view, 0, sizeof *view);
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    size_t size = 0;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+        size = (size_t)st.st_size;
+    if (size < HEADER_SIZE + 1 + TRAILER_SIZE + FOOTER_SIZE) {
+        close(fd);
+        return false;
+    }
+    void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);                          /* Mapping bleibt gültig */
+    if (map == MAP_FAILED)
+        return false;
+    /* Abspielen liest vorwärts: Kernel darf vorauslesen und freigeben */
+    posix_madvise(map, size, POSIX_MADV_SEQUENTIAL);
+
+    const uint8_t *m = map;
+    const uint8_t *f = m + size - FOOTER_SIZE;
+    uint32_t n         = (uint32_t)get_le(f, 4);
+    uint64_t index_pos = get_le(f + 4, 8);
+
+    bool ok = memcmp(m, replay_magic, sizeof replay_magic) == 0 &&
+              get_le(m + 8, 2) == REPLAY_VERSION &&
+              memcmp(f + 12, index_magic, sizeof index_magic) == 0 &&
+              index_pos >= HEADER_SIZE + 1 + TRAILER_SIZE &&
+              index_pos <= size - FOOTER_SIZE &&
+              (size - FOOTER_SIZE - index_pos) == (uint64_t)n * INDEX_ENTRY &&
+              m[index_pos - TRAILER_SIZE - 1] == 0;
+    if (!ok) {
+        munmap(map, size);
+        return false;
+    }
+
+    view->map       = m;
+    view->size      = size;
+    view->index     = m + index_pos;
+    view->keyframes = n;
+    view->body      = HEADER_SIZE;
+
+    const uint8_t *p = m + 10;
+    view->info.width   = (uint16_t)get_le(p, 2);
+    view->info.height  = (uint16_t)get_le(p + 2, 2);
+    view->info.seed    = get_le(p + 4, 8);
+    view->info.stream  = get_le(p + 12, 8);
+    view->info.solver  = p[20];
+    view->info.numeric = p[21];
+    view->info.ai_mode = p[22];
+    view->info.tick_hz = (uint16_t)get_le(p + 24, 2);
+
+    const uint8_t *t = m + index_pos - TRAILER_SIZE;
+    view->ticks = get_le(t, 8);
+    view->score = (int)(int32_t)get_le(t + 8, 4);
+    view->hash  = get_le(t + 12, 8);
+
+    if (!physics_set_tick_rate(view->info.tick_hz) ||
+        (view->info.numeric == PHYS_NUMERIC_FIXED &&
+         view->info.width > PHYS_FIXED_MAX_WIDTH)) {
+        replay_view_close(view);
+        return false;
+    }
+    physics_set_solver((physics_solver_t)view->info.solver);
+    physics_set_numeric((physics_numeric_t)view->info.numeric);
+    ai_config_t ai;
+    ai_config_defaults(&ai);
+    ai.mode = (ai_mode_t)view->info.ai_mode;
+    ai_configure(&ai);
+
+    return replay_view_seek(view, 0);
+}
+
+/* ------------------------------------------------------------------
+ * replay_view_close
+ * Gibt das Mapping frei.
+ *
+ * Parameter:
+ *   view – Wiedergabe
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void replay_view_close(replay_view_t *view)
+{
+    if (view->map)
+        munmap((void *)view->map, view->size);
+    view->map = NULL;
+}
+
+/* Ende des Befehlsstroms = Endmarke vor dem Trailer */
+static size_t view_end(const replay_view_t *view)
+{
+    return (size_t)(view->index - view->map) - TRAILER_SIZE - 1;
+}
+
+/* ------------------------------------------------------------------
+ * replay_view_step
+ * Führt Befehle bis einschließlich des nächsten Physik-Ticks aus;
+ * Keyframes im Strom werden übersprungen. Nach dem letzten Tick
+ * werden noch ausstehende Spielerbewegungen angewandt, dann ist
+ * view->done gesetzt.
+ *
+ * Parameter:
+ *   view – Wiedergabe
+ *
+ * Rückgabe:
+ *   Events des Ticks (PHYS_EVENT_NONE am Ende)
+ * ------------------------------------------------------------------ */
+physics_event_t replay_view_step(replay_view_t *view)
+{
+    size_t end = view_end(view);
+
+    while (!view->done) {
+        if (view->run_left == 0) {
+            uint64_t v;
+            size_t n = replay_get_varint(view->map + view->pos, end + 1 - view->pos, &v);
+            if (n == 0 || (v >> 3 == 0 && v != 0 && v != KEYFRAME_MARK)) {
+                view->bad = view->done = true;
+                break;
+            }
+            view->pos += n;
+            if (v == 0) {
+                view->done = true;
+            } else if (v == KEYFRAME_MARK) {
+                view->pos += KEYFRAME_SIZE;
+                if (view->pos > end)
+                    view->bad = view->done = true;
+            } else {
+                view->run_code = (unsigned)(v & 7u);
+                view->run_left = v >> 3;
+            }
+            continue;
+        }
+
+        view->run_left--;
+        switch (view->run_code & 3u) {
+        case 0: physics_player_update(&view->game,  0); break;
+        case 1: physics_player_update(&view->game, +1); break;
+        case 2: physics_player_update(&view->game, -1); break;
+        default: break;
+        }
+        if (view->run_code & 4u) {
+            ai_update(&view->game);
+            view->tick++;
+            return physics_update_ball_events(&view->game);
+        }
+    }
+    return PHYS_EVENT_NONE;
+}
+
+/* ------------------------------------------------------------------
+ * view_keyframe
+ * Binäre Suche im Index nach dem letzten Keyframe mit Tick ≤ tick.
+ *
+ * Parameter:
+ *   view – Wiedergabe
+ *   tick – Ziel
+ *
+ * Rückgabe:
+ *   Indexposition + 1, 0 = keiner (Start bei Tick 0)
+ * ------------------------------------------------------------------ */
+static uint32_t view_keyframe(const replay_view_t *view, uint64_t tick)
+{
+    uint32_t lo = 0, hi = view->keyframes;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (get_le(view->index + (size_t)mid * INDEX_ENTRY, 8) <= tick)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/* ------------------------------------------------------------------
+ * replay_view_seek
+ * Springt auf den Zustand nach `tick` Ticks (bzw. ans Ende, wenn die
+ * Aufzeichnung kürzer ist). Liegt das Ziel vor der aktuellen Position
+ * oder ist ein näherer Keyframe vorhanden, wird dieser geladen; danach
+ * wird vorwärts simuliert.
+ *
+ * Parameter:
+ *   view – Wiedergabe
+ *   tick – Ziel
+ *
+ * Rückgabe:
+ *   false bei defektem Keyframe
+ * ------------------------------------------------------------------ */
+bool replay_view_seek(replay_view_t *view, uint64_t tick)
+{
+    uint32_t k       = view_keyframe(view, tick);
+    uint64_t kf_tick = k ? get_le(view->index + (size_t)(k - 1) * INDEX_ENTRY, 8) : 0;
+    bool     fresh   = view->pos == 0;
+
+    view->seek_ticks = 0;
+    if (fresh || tick < view->tick || (kf_tick > view->tick && !view->done)) {
+        if (k == 0) {
+            view->game = physics_create_game_seeded(view->info.width, view->info.height,
+                                                    view->info.seed, view->info.stream);
+            view->tick = 0;
+            view->pos  = view->body;
+        } else {
+            uint64_t off = get_le(view->index + (size_t)(k - 1) * INDEX_ENTRY + 8, 8);
+            physics_snapshot_t snap;
+            if (off + 1 + KEYFRAME_SIZE > view_end(view) || view->map[off] != KEYFRAME_MARK)
+                return false;
+            keyframe_get(view->map + off + 1, &snap);
+            if (!physics_restore(&view->game, &view->tick, &snap))
+                return false;
+            view->pos = (size_t)off + 1 + KEYFRAME_SIZE;
+        }
+        view->run_left = 0;
+        view->done = view->bad = false;
+    }
+
+    while (view->tick < tick && !view->done) {
+        replay_view_step(view);
+        view->seek_ticks++;
+    }
+    return !view->bad;
+}
+
+/* ------------------------------------------------------------------
+ * replay_view_next_event / replay_view_prev_event
+ * Springen zum nächsten Tick nach bzw. letzten Tick vor der aktuellen
+ * Position, dessen Events `mask` enthalten. Rückwärts wird Abschnitt
+ * für Abschnitt ab dem jeweiligen Keyframe nachsimuliert.
+ *
+ * Parameter:
+ *   view – Wiedergabe
+ *   mask – gesuchte Events (z. B. PHYS_EVENT_SCORED)
+ *
+ * Rückgabe:
+ *   true, wenn ein solcher Tick gefunden wurde (sonst unverändert
+ *   bzw. beim Vorwärtssuchen am Ende)
+ * ------------------------------------------------------------------ */
+bool replay_view_next_event(replay_view_t *view, physics_event_t mask)
+{
+    while (!view->done)
+        if (replay_view_step(view) & mask)
+            return true;
+    return false;
+}
+
+bool replay_view_prev_event(replay_view_t *view, physics_event_t mask)
+{
+    uint64_t origin = view->tick;
+    uint64_t upper  = origin ? origin - 1 : 0;     /* letzter Kandidat */
+
+    while (upper > 0) {
+        /* Abschnitt (Keyframe, upper] durchsuchen – der Tick des
+           Keyframes selbst gehört zum vorigen Abschnitt */
+        uint32_t k     = view_keyframe(view, upper - 1);
+        uint64_t start = k ? get_le(view->index + (size_t)(k - 1) * INDEX_ENTRY, 8) : 0;
+        if (!replay_view_seek(view, start))
+            return false;
+
+        uint64_t found = 0;
+        bool     hit   = false;
+        while (view->tick < upper && !view->done) {
+            if (replay_view_step(view) & mask) {
+                found = view->tick;
+                hit   = true;
+            }
+        }
+        if (hit)
+            return replay_view_seek(view, found);
+        upper = start;
+    }
+    replay_view_seek(view, origin);                 /* kein Treffer: zurück */
+    return false;
+}
+
+/* ------------------------------------------------------------------
+ * replay_run
+ * Spielt eine Aufzeichnung headless mit maximaler Geschwindigkeit ab
+ * und vergleicht Ticks, Score und Hash mit dem Trailer.
+ *
+ * Parameter:
+ *   path – Dateiname
+ *   res  – Ausgabe: Ergebnis und Vergleich
+ *
+ * Rückgabe:
+ *   false, wenn die Datei fehlt oder kein gültiges Replay ist
+ * ------------------------------------------------------------------ */
+bool replay_run(const char *path, replay_result_t *res)
+{
+    replay_view_t view;
+    memset(res, 0, sizeof *res);
+    if (!replay_view_open(&view, path))
+        return false;
+
+    while (!view.done)
+        replay_view_step(&view);
+
+    res->info           = view.info;
+    res->ticks          = view.tick;
+    res->score          = view.game.score;
+    res->hash           = physics_state_hash(&view.game);
+    res->expected_ticks = view.ticks;
+    res->expected_score = view.score;
+    res->expected_hash  = view.hash;
+    res->match = !view.bad && res->ticks == res->expected_ticks &&
+                 res->score == res->expected_score &&
+                 res->hash == res->expected_hash;
+
+    bool ok = !view.bad;
+    replay_view_close(&view);
+    return ok;
+}
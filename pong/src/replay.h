@@ -0,0 +1,125 @@
+/* ------------------------------------------------------------------
+ * replay.h - Header für Aufzeichnung und Wiedergabe von Eingaben
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "physics.h"
+
+/* ---------------------------------------------------------------
+ * Dateiformat (little endian):
+ *   Kopf     "PONGRPLY", u16 Version, u16 Breite, u16 Höhe,
+ *            u64 Seed, u64 Stream, u8 Löser, u8 Zahlenformat,
+ *            u8 KI-Modus, u8 reserviert, u16 Tickrate
+ *   Befehle  Varints (LEB128): Lauflänge << 3 | Tick << 2 | Eingabe
+ *            Eingabe 0 = dx 0, 1 = +1, 2 = -1, 3 = keine Spielerbewegung;
+ *            Tick = danach ein Physik-Tick (ai_update + Ball)
+ *            Varint 1 (Lauflänge 0): es folgt ein Keyframe nach jedem
+ *            REPLAY_KEYFRAME_TICKS-ten Tick: u64 Tick, u8 Löser,
+ *            u8 Zahlenformat, u16 Tickrate, dann der Spielzustand Feld
+ *            für Feld (i32, f32 als Bitmuster, u64 RNG; replay.c)
+ *   Ende     Byte 0 (Lauflänge 0 kommt sonst nicht vor)
+ *   Trailer  u64 Ticks, i32 Score, u64 Zustands-Hash
+ *   Index    je Keyframe u64 Tick, u64 Dateiposition der Markierung
+ *   Fuß      u32 Anzahl Keyframes, u64 Position des Index, "PONGIDX1"
+ * Keyframes beginnen immer einen neuen Lauf; ab ihnen lässt sich
+ * also ohne Vorgeschichte weiterlesen.
+ * --------------------------------------------------------------- */
+#define REPLAY_VERSION        4u
+#define REPLAY_BUF_SIZE       4096    /* Schreibpuffer in Bytes          */
+#define REPLAY_FLUSH_TICKS    600     /* spätestens alle 600 Ticks auf Platte */
+#define REPLAY_KEYFRAME_TICKS 600     /* Keyframe-Abstand K in Ticks (1 min bei 10 Hz) */
+
+#define REPLAY_NO_INPUT     2       /* dx-Wert für "keine Spielerbewegung" */
+
+typedef struct
+{
+    uint16_t width;
+    uint16_t height;
+    uint64_t seed;
+    uint64_t stream;
+    uint8_t  solver;        /* physics_solver_t  */
+    uint8_t  numeric;       /* physics_numeric_t */
+    uint8_t  ai_mode;       /* ai_mode_t         */
+    uint16_t tick_hz;       /* Ticks pro Sekunde */
+} replay_info_t;
+
+typedef struct
+{
+    FILE    *file;
+    uint8_t  buf[REPLAY_BUF_SIZE];
+    size_t   len;
+    int      pending;       /* Eingabe ohne Tick, REPLAY_NO_INPUT = keine */
+    unsigned run_code;      /* aktueller Lauf                           */
+    uint64_t run_len;
+    uint64_t ticks;
+    uint64_t keyframe_ticks;/* Keyframe-Abstand, REPLAY_KEYFRAME_TICKS  */
+    uint64_t unflushed;     /* Ticks seit dem letzten fflush            */
+    uint64_t offset;        /* Dateiposition hinter dem Puffer          */
+    uint64_t *index;        /* Paare (Tick, Position) je Keyframe       */
+    size_t   keyframes, index_cap;
+    bool     ok;            /* false nach Schreibfehler                 */
+} replay_rec_t;
+
+typedef struct
+{
+    replay_info_t info;
+    uint64_t      ticks,  expected_ticks;
+    int           score,  expected_score;
+    uint64_t      hash,   expected_hash;
+    bool          match;    /* Ticks, Score und Hash stimmen überein */
+} replay_result_t;
+
+/* ---------------------------------------------------------------
+ * Wiedergabe direkt aus der per mmap eingeblendeten Datei: gelesen
+ * wird nur, was die Simulation gerade braucht. Seek stellt den
+ * nächsten Keyframe ≤ Ziel her und simuliert höchstens
+ * REPLAY_KEYFRAME_TICKS Ticks nach.
+ * --------------------------------------------------------------- */
+typedef struct
+{
+    const uint8_t *map;
+    size_t         size;
+    replay_info_t  info;
+    const uint8_t *index;       /* Index im Mapping                      */
+    uint32_t       keyframes;
+    size_t         body;        /* erster Befehl                         */
+    size_t         pos;         /* nächster ungelesener Befehl           */
+    unsigned       run_code;    /* angefangener Lauf                     */
+    uint64_t       run_left;
+    game_state_t   game;
+    uint64_t       tick;        /* ausgeführte Ticks                     */
+    uint64_t       ticks;       /* Ticks laut Trailer                    */
+    int            score;       /* Score laut Trailer                    */
+    uint64_t       hash;        /* Hash laut Trailer                     */
+    uint64_t       seek_ticks;  /* beim letzten Seek nachsimuliert       */
+    bool           done;        /* Endmarke erreicht                     */
+    bool           bad;         /* defekter Befehlsstrom                 */
+} replay_view_t;
+
+bool replay_rec_open(replay_rec_t *rec, const char *path, const replay_info_t *info);
+void replay_rec_input(replay_rec_t *rec, int dx);
+void replay_rec_tick(replay_rec_t *rec, const game_state_t *game);
+bool replay_rec_close(replay_rec_t *rec, const game_state_t *game);
+
+bool            replay_view_open(replay_view_t *view, const char *path);
+void            replay_view_close(replay_view_t *view);
+physics_event_t replay_view_step(replay_view_t *view);
+bool            replay_view_seek(replay_view_t *view, uint64_t tick);
+bool            replay_view_next_event(replay_view_t *view, physics_event_t mask);
+bool            replay_view_prev_event(replay_view_t *view, physics_event_t mask);
+
+/* Spielt eine Datei headless ab; false bei unlesbarer/defekter Datei */
+bool replay_run(const char *path, replay_result_t *res);
+
+/* Varint-Kodierung (für Tests offengelegt) */
+size_t replay_put_varint(uint8_t *out, uint64_t v);
+size_t replay_get_varint(const uint8_t *in, size_t len, uint64_t *v);
+
+#endif /* REPLAY_H */
@@ -0,0 +1,79 @@
+/* ------------------------------------------------------------------
+ * rng.c - Zufallsgenerator PCG32 (O'Neill, pcg-random.org)
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#include "rng.h"
+
+#define PCG_MULT 6364136223846793005ull
+
+/* ------------------------------------------------------------------
+ * rng_seed
+ * Initialisiert einen Generator mit Startwert und Stream.
+ *
+ * Parameter:
+ *   r      – Generator
+ *   seed   – Startwert
+ *   stream – Nummer der Folge (z. B. Spielindex)
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void rng_seed(rng_t *r, uint64_t seed, uint64_t stream)
+{
+    r->state = 0;
+    r->inc   = (stream << 1) | 1u;
+    rng_next(r);
+    r->state += seed;
+    rng_next(r);
+}
+
+/* ------------------------------------------------------------------
+ * rng_next
+ * Liefert die nächste 32‑Bit‑Zufallszahl.
+ *
+ * Parameter:
+ *   r – Generator
+ *
+ * Rückgabe:
+ *   Zufallszahl
+ * ------------------------------------------------------------------ */
+uint32_t rng_next(rng_t *r)
+{
+    uint64_t old = r->state;
+    r->state = old * PCG_MULT + r->inc;
+
+    uint32_t xorshifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+    uint32_t rot        = (uint32_t)(old >> 59);
+    return (xorshifted >> rot) | (xorshifted << ((32u - rot) & 31u));
+}
+
+/* ------------------------------------------------------------------
+ * rng_advance
+ * Springt delta Schritte vorwärts (Quadrieren der LCG-Abbildung,
+ * Brown 1994), ohne die Zahlen zu erzeugen.
+ *
+ * Parameter:
+ *   r     – Generator
+ *   delta – Anzahl Schritte
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void rng_advance(rng_t *r, uint64_t delta)
+{
+    uint64_t cur_mult = PCG_MULT, cur_plus = r->inc;
+    uint64_t acc_mult = 1u,       acc_plus = 0u;
+
+    while (delta > 0) {
+        if (delta & 1u) {
+            acc_mult *= cur_mult;
+            acc_plus  = acc_plus * cur_mult + cur_plus;
+        }
+        cur_plus  = (cur_mult + 1u) * cur_plus;
+        cur_mult *= cur_mult;
+        delta   >>= 1;
+    }
+    r->state = acc_mult * r->state + acc_plus;
+}
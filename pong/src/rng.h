@@ -0,0 +1,27 @@
+/* ------------------------------------------------------------------
+ * rng.h - Header des Zufallsgenerators (PCG32, pro Spiel)
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdint.h>
+
+/* ---------------------------------------------------------------
+ * PCG32 (XSH-RR): 64‑Bit‑LCG mit permutierter 32‑Bit‑Ausgabe.
+ * stream wählt eine von 2^63 unabhängigen Folgen, rng_advance
+ * springt in O(log n) beliebig weit. Kein globaler Zustand.
+ * --------------------------------------------------------------- */
+typedef struct
+{
+    uint64_t state;
+    uint64_t inc;       /* immer ungerade, kodiert den Stream */
+} rng_t;
+
+void     rng_seed(rng_t *r, uint64_t seed, uint64_t stream);
+uint32_t rng_next(rng_t *r);
+void     rng_advance(rng_t *r, uint64_t delta);
+
+#endif /* RNG_H */
@@ -0,0 +1,123 @@
+/* ------------------------------------------------------------------
+ * snapshot.c - Snapshots und Rückspul-Ringpuffer
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ *
+ * Ein Snapshot bündelt physics_save und render_ui_save. Der Ring hält
+ * die letzten SNAP_RING_LEN Ticks; Zurückspulen stellt den jüngsten
+ * Snapshot ≤ Ziel-Tick her und verwirft alle neueren, damit der
+ * Aufrufer von dort (ggf. mit anderen Eingaben) neu simulieren kann.
+ * ------------------------------------------------------------------ */
+
+#include <stddef.h>
+#include "snapshot.h"
+
+/* ------------------------------------------------------------------
+ * snapshot_take / snapshot_apply
+ * Sichern bzw. Wiederherstellen von Physik- und UI-Zustand.
+ *
+ * Parameter:
+ *   snap – Snapshot
+ *   game – Spielzustand
+ *   tick – Tick (Eingabe bzw. Ausgabe, darf beim Laden NULL sein)
+ *
+ * Rückgabe:
+ *   snapshot_apply: false bei unpassendem Format
+ * ------------------------------------------------------------------ */
+void snapshot_take(snapshot_t *snap, const game_state_t *game, uint64_t tick)
+{
+    physics_save(game, tick, &snap->phys);
+    render_ui_save(&snap->ui);
+}
+
+bool snapshot_apply(const snapshot_t *snap, game_state_t *game, uint64_t *tick)
+{
+    if (!physics_restore(game, tick, &snap->phys))
+        return false;
+    render_ui_restore(&snap->ui);
+    return true;
+}
+
+/* ------------------------------------------------------------------
+ * snap_ring_reset
+ * Leert den Ringpuffer.
+ *
+ * Parameter:
+ *   ring – Ringpuffer
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void snap_ring_reset(snap_ring_t *ring)
+{
+    ring->count = 0;
+}
+
+/* ------------------------------------------------------------------
+ * snap_ring_push
+ * Legt einen Snapshot ab und überschreibt dabei den ältesten.
+ *
+ * Parameter:
+ *   ring – Ringpuffer
+ *   game – Spielzustand
+ *   tick – aktueller Tick (aufsteigend)
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void snap_ring_push(snap_ring_t *ring, const game_state_t *game, uint64_t tick)
+{
+    snapshot_take(&ring->slot[ring->count % SNAP_RING_LEN], game, tick);
+    ring->count++;
+}
+
+/* ------------------------------------------------------------------
+ * snap_ring_find
+ * Sucht den jüngsten Snapshot mit Tick ≤ tick (höchstens
+ * SNAP_RING_LEN Vergleiche).
+ *
+ * Parameter:
+ *   ring – Ringpuffer
+ *   tick – Ziel-Tick
+ *
+ * Rückgabe:
+ *   Snapshot oder NULL, wenn tick älter als der Ring ist
+ * ------------------------------------------------------------------ */
+const snapshot_t *snap_ring_find(const snap_ring_t *ring, uint64_t tick)
+{
+    uint64_t n = ring->count < SNAP_RING_LEN ? ring->count : SNAP_RING_LEN;
+    for (uint64_t i = 1; i <= n; ++i) {
+        const snapshot_t *s = &ring->slot[(ring->count - i) % SNAP_RING_LEN];
+        if (s->phys.tick <= tick)
+            return s;
+    }
+    return NULL;
+}
+
+/* ------------------------------------------------------------------
+ * snap_ring_rewind
+ * Stellt den jüngsten Snapshot ≤ tick her und entfernt alle neueren
+ * aus dem Ring; der wiederhergestellte bleibt als neuester erhalten.
+ *
+ * Parameter:
+ *   ring          – Ringpuffer
+ *   tick          – Ziel-Tick
+ *   game          – Ausgabe: Spielzustand
+ *   restored_tick – Ausgabe: Tick des Snapshots (darf NULL sein)
+ *
+ * Rückgabe:
+ *   false, wenn tick nicht mehr im Ring liegt
+ * ------------------------------------------------------------------ */
+bool snap_ring_rewind(snap_ring_t *ring, uint64_t tick,
+                      game_state_t *game, uint64_t *restored_tick)
+{
+    const snapshot_t *s = snap_ring_find(ring, tick);
+    if (!s || !snapshot_apply(s, game, restored_tick))
+        return false;
+
+    /* neuere Einträge verwerfen: s wird wieder das jüngste Element */
+    uint64_t idx = (uint64_t)(s - ring->slot);
+    uint64_t newest = (ring->count - 1) % SNAP_RING_LEN;
+    ring->count -= (newest + SNAP_RING_LEN - idx) % SNAP_RING_LEN;
+    return true;
+}
@@ -0,0 +1,41 @@
+/* ------------------------------------------------------------------
+ * snapshot.h - Header für Snapshots und Rückspul-Ringpuffer
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "physics.h"
+#include "render.h"
+
+/* Anzahl Ticks, die der Ringpuffer zurückreicht */
+#define SNAP_RING_LEN 64
+
+/* Physik + UI: alles, was zum bitgleichen Fortsetzen nötig ist */
+typedef struct
+{
+    physics_snapshot_t phys;
+    render_ui_t        ui;
+} snapshot_t;
+
+/* Die letzten SNAP_RING_LEN Snapshots, fest eingebettet (kein Heap) */
+typedef struct
+{
+    snapshot_t slot[SNAP_RING_LEN];
+    uint64_t   count;           /* bisher abgelegte Snapshots */
+} snap_ring_t;
+
+void snapshot_take(snapshot_t *snap, const game_state_t *game, uint64_t tick);
+bool snapshot_apply(const snapshot_t *snap, game_state_t *game, uint64_t *tick);
+
+void snap_ring_reset(snap_ring_t *ring);
+void snap_ring_push(snap_ring_t *ring, const game_state_t *game, uint64_t tick);
+const snapshot_t *snap_ring_find(const snap_ring_t *ring, uint64_t tick);
+bool snap_ring_rewind(snap_ring_t *ring, uint64_t tick,
+                      game_state_t *game, uint64_t *restored_tick);
+
+#endif /* SNAPSHOT_H */
@@ -0,0 +1,314 @@
+/* ------------------------------------------------------------------
+ * trace.c - Ereignis-Tracer mit Ringpuffer je Thread
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ *
+ * Jeder Thread schreibt Beginn/Ende-Ereignisse (Zeitstempel, Name,
+ * Phase) ohne Sperren in seinen eigenen, einmal angelegten Ring.
+ * trace_write setzt daraus das Chrome-Trace-Event-JSON zusammen,
+ * das Perfetto und chrome://tracing als Zeitleiste anzeigen.
+ * ------------------------------------------------------------------ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "trace.h"
+
+typedef struct
+{
+    uint64_t    ts_ns;
+    const char *name;
+    char        ph;         /* 'B'/'E' verschachtelt, 'b'/'e' asynchron */
+} trace_event_t;
+
+typedef struct
+{
+    trace_event_t *ev;
+    uint64_t       next;    /* Anzahl geschriebener Ereignisse */
+    const char    *name;    /* Spurname oder NULL              */
+} trace_ring_t;
+
+static trace_ring_t rings[TRACE_MAX_THREADS];
+static unsigned     ring_count  = 0;   /* vergebene Plätze (atomar) */
+static size_t       ring_mask   = 0;   /* Ringgröße - 1 (Zweierpotenz) */
+static bool         active      = false;
+static unsigned     generation  = 0;   /* trennt Läufe für die TLS-Zeiger */
+static uint64_t     origin_ns   = 0;
+
+/* Ring des Threads; gilt nur für die passende generation */
+static __thread trace_ring_t *my_ring = NULL;
+static __thread unsigned      my_gen  = 0;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/* ------------------------------------------------------------------
+ * thread_ring
+ * Liefert den Ring des aufrufenden Threads und legt ihn beim ersten
+ * Aufruf an (einzige Allokation je Thread).
+ *
+ * Parameter:
+ *   keine
+ *
+ * Rückgabe:
+ *   Ring oder NULL (alle Plätze belegt, kein Speicher)
+ * ------------------------------------------------------------------ */
+static trace_ring_t *thread_ring(void)
+{
+    unsigned gen = __atomic_load_n(&generation, __ATOMIC_ACQUIRE);
+    if (my_ring && my_gen == gen)
+        return my_ring;
+
+    my_ring = NULL;
+    my_gen  = gen;
+    unsigned idx = __atomic_fetch_add(&ring_count, 1, __ATOMIC_ACQ_REL);
+    if (idx >= TRACE_MAX_THREADS)
+        return NULL;
+
+    trace_ring_t *r = &rings[idx];
+    r->ev = malloc((ring_mask + 1) * sizeof *r->ev);
+    if (!r->ev)
+        return NULL;
+    r->next  = 0;
+    my_ring  = r;
+    return r;
+}
+
+/* ------------------------------------------------------------------
+ * record
+ * Trägt ein Ereignis in den Ring des Threads ein; ein voller Ring
+ * überschreibt das älteste.
+ *
+ * Parameter:
+ *   ph   – Phase ('B', 'E', 'b', 'e')
+ *   name – Ereignisname (statisch)
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void record(char ph, const char *name)
+{
+    if (!__atomic_load_n(&active, __ATOMIC_RELAXED))
+        return;
+    trace_ring_t *r = thread_ring();
+    if (!r)
+        return;
+
+    trace_event_t *e = &r->ev[r->next & ring_mask];
+    e->ts_ns = now_ns();
+    e->name  = name;
+    e->ph    = ph;
+    r->next++;
+}
+
+void trace_begin(const char *name)       { record('B', name); }
+void trace_end(const char *name)         { record('E', name); }
+void trace_async_begin(const char *name) { record('b', name); }
+void trace_async_end(const char *name)   { record('e', name); }
+
+bool trace_enabled(void)
+{
+    return __atomic_load_n(&active, __ATOMIC_RELAXED);
+}
+
+/* ------------------------------------------------------------------
+ * trace_start
+ * Beginnt eine Aufzeichnung und legt den Ring des aufrufenden
+ * Threads an. Läuft bereits eine, wird sie verworfen.
+ *
+ * Parameter:
+ *   ring_events – Ereignisse je Thread, auf eine Zweierpotenz
+ *                 aufgerundet (0 = TRACE_RING_EVENTS)
+ *
+ * Rückgabe:
+ *   false bei Speichermangel
+ * ------------------------------------------------------------------ */
+bool trace_start(size_t ring_events)
+{
+    trace_stop();
+
+    size_t cap = 1;
+    while (cap < (ring_events ? ring_events : TRACE_RING_EVENTS))
+        cap <<= 1;
+    ring_mask = cap - 1;
+    origin_ns = now_ns();
+    __atomic_store_n(&active, true, __ATOMIC_RELEASE);
+
+    if (!trace_thread_init(NULL)) {
+        trace_stop();
+        return false;
+    }
+    return true;
+}
+
+/* ------------------------------------------------------------------
+ * trace_thread_init
+ * Legt den Ring des aufrufenden Threads an, bevor er Ereignisse
+ * schreibt, und setzt den Spurnamen.
+ *
+ * Parameter:
+ *   name – Spurname (statisch) oder NULL
+ *
+ * Rückgabe:
+ *   false, wenn nicht aktiv oder kein Ring verfügbar
+ * ------------------------------------------------------------------ */
+bool trace_thread_init(const char *name)
+{
+    if (!trace_enabled())
+        return false;
+    trace_ring_t *r = thread_ring();
+    if (!r)
+        return false;
+    if (name)
+        r->name = name;
+    return true;
+}
+
+/* ------------------------------------------------------------------
+ * trace_stop
+ * Beendet die Aufzeichnung und gibt alle Ringe frei.
+ *
+ * Parameter:
+ *   keine
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+void trace_stop(void)
+{
+    __atomic_store_n(&active, false, __ATOMIC_RELEASE);
+    for (unsigned i = 0; i < TRACE_MAX_THREADS; ++i) {
+        free(rings[i].ev);
+        rings[i] = (trace_ring_t){0};
+    }
+    ring_count = 0;
+    __atomic_add_fetch(&generation, 1, __ATOMIC_ACQ_REL);
+}
+
+/* ------------------------------------------------------------------
+ * trace_dropped
+ * Anzahl überschriebener (verlorener) Ereignisse aller Threads.
+ *
+ * Parameter:
+ *   keine
+ *
+ * Rückgabe:
+ *   Ereignisse
+ * ------------------------------------------------------------------ */
+uint64_t trace_dropped(void)
+{
+    uint64_t n = 0;
+    for (unsigned i = 0; i < TRACE_MAX_THREADS; ++i)
+        if (rings[i].ev && rings[i].next > ring_mask + 1)
+            n += rings[i].next - (ring_mask + 1);
+    return n;
+}
+
+/* ------------------------------------------------------------------
+ * write_ring
+ * Gibt einen Ring als Trace-Events aus. Nach einem Überlauf beginnt
+ * der Ring mitten in einer Verschachtelung: Enden ohne passenden
+ * Beginn werden übersprungen, offene Abschnitte am Ende mit dem
+ * letzten Zeitstempel geschlossen.
+ *
+ * Parameter:
+ *   f     – Zieldatei
+ *   r     – Ring
+ *   tid   – Spurnummer
+ *   first – true, solange noch kein Ereignis geschrieben wurde
+ *
+ * Rückgabe:
+ *   neuer Wert für first
+ * ------------------------------------------------------------------ */
+static bool write_ring(FILE *f, const trace_ring_t *r, unsigned tid, bool first)
+{
+    const char *open_names[64];
+    unsigned    depth   = 0;
+    unsigned    pending = 0;           /* offene asynchrone Zeiträume */
+    uint64_t    start   = r->next > ring_mask + 1 ? r->next - (ring_mask + 1) : 0;
+    uint64_t    last_ts = origin_ns;
+
+    char tname[32];
+    if (!r->name)
+        snprintf(tname, sizeof tname, "thread %u", tid);
+    fprintf(f, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+               "\"args\":{\"name\":\"%s\"}}",
+            first ? "" : ",", tid, r->name ? r->name : tname);
+
+    for (uint64_t k = start; k < r->next; ++k) {
+        const trace_event_t *e = &r->ev[k & ring_mask];
+        const char *extra = "";
+
+        switch (e->ph) {
+        case 'B':
+            if (depth < sizeof open_names / sizeof open_names[0])
+                open_names[depth] = e->name;
+            depth++;
+            break;
+        case 'E':
+            if (depth == 0)
+                continue;
+            depth--;
+            break;
+        case 'b':
+            pending++;
+            extra = ",\"cat\":\"loop\",\"id\":1";
+            break;
+        case 'e':
+            if (pending == 0)
+                continue;
+            pending--;
+            extra = ",\"cat\":\"loop\",\"id\":1";
+            break;
+        default:
+            continue;
+        }
+        last_ts = e->ts_ns;
+        fprintf(f, ",\n{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u%s}",
+                e->name, e->ph, (double)(e->ts_ns - origin_ns) / 1000.0, tid, extra);
+    }
+
+    while (depth > 0) {
+        depth--;
+        const char *name = depth < sizeof open_names / sizeof open_names[0]
+                         ? open_names[depth] : "?";
+        fprintf(f, ",\n{\"name\":\"%s\",\"ph\":\"E\",\"ts\":%.3f,\"pid\":1,\"tid\":%u}",
+                name, (double)(last_ts - origin_ns) / 1000.0, tid);
+    }
+    return false;
+}
+
+/* ------------------------------------------------------------------
+ * trace_write
+ * Schreibt alle Ringe als Chrome-Trace-Event-JSON (Zeiten in µs seit
+ * trace_start, eine Spur je Thread).
+ *
+ * Parameter:
+ *   path – Zieldatei
+ *
+ * Rückgabe:
+ *   false, wenn nicht aktiv oder die Datei nicht geschrieben werden
+ *   konnte
+ * ------------------------------------------------------------------ */
+bool trace_write(const char *path)
+{
+    if (!trace_enabled())
+        return false;
+
+    FILE *f = fopen(path, "w");
+    if (!f)
+        return false;
+
+    bool first = true;
+    fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    for (unsigned i = 0; i < TRACE_MAX_THREADS; ++i)
+        if (rings[i].ev)
+            first = write_ring(f, &rings[i], i + 1, first);
+    fprintf(f, "\n]}\n");
+    return fclose(f) == 0;
+}
@@ -0,0 +1,42 @@
+/* ------------------------------------------------------------------
+ * trace.h - Header des Ereignis-Tracers (Chrome-Trace-Format)
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Ereignisse je Thread-Ring (je 24 Byte); ist der Ring voll, werden
+   die ältesten überschrieben */
+#define TRACE_RING_EVENTS  (1u << 16)
+#define TRACE_MAX_THREADS  64
+
+/* Aufzeichnung starten; reserviert den Ring des aufrufenden Threads
+   (ring_events = 0 → TRACE_RING_EVENTS). false bei Speichermangel */
+bool trace_start(size_t ring_events);
+/* Ring für den aufrufenden Thread vorab anlegen (sonst beim ersten
+   Ereignis) und die Spur benennen (statischer String, NULL = Nummer);
+   false, wenn nicht aktiv oder alle Plätze belegt */
+bool trace_thread_init(const char *name);
+bool trace_enabled(void);
+
+/* Ereignisse; name muss ein String mit statischer Lebensdauer sein.
+   Ohne trace_start kehren alle sofort zurück */
+void trace_begin(const char *name);
+void trace_end(const char *name);
+/* Zeitraum über mehrere Frames (eigene Spur, z. B. Countdown) */
+void trace_async_begin(const char *name);
+void trace_async_end(const char *name);
+
+/* Alle Ringe als Chrome-Trace-JSON schreiben (Perfetto, chrome://tracing);
+   erst aufrufen, wenn keine anderen Threads mehr aufzeichnen */
+bool     trace_write(const char *path);
+uint64_t trace_dropped(void);
+void     trace_stop(void);
+
+#endif /* TRACE_H */
@@ -44,7 +44,8 @@ void test_ai_accel_includes_score(void)
 
     ai_update(&g);
 
-    float expected_ax = BOT_BASE_ACCELERATION + score * BOT_ACCEL_PER_POINT;
+    /* config.h in Zellen / s², je Tick bei 10 Hz: a / 100 */
+    float expected_ax = (BOT_BASE_ACCELERATION + score * BOT_ACCEL_PER_POINT) / 100.0f;
     /* vx == ax, weil v_start = 0 und genau ein Physik‑Frame vergangen ist */
     TEST_ASSERT_FLOAT_WITHIN(0.0001f, expected_ax, g.bot.vx);
 }
@@ -56,7 +57,7 @@ void test_ai_accel_base_speed(void)
 
     ai_update(&g);
 
-    TEST_ASSERT_FLOAT_WITHIN(0.0001f, BOT_BASE_ACCELERATION, g.bot.vx);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, BOT_BASE_ACCELERATION / 100.0f, g.bot.vx);
 }
 
 /* 3.   Bot stoppt korrekt an der rechten Spielfeldgrenze           */
@@ -4,6 +4,7 @@
  * Autor: Mats-Luca Dagott
  * ------------------------------------------------------------------ */
 
+#include <string.h>
 #include "unity.h"
 #include "physics.h"
 #include "ai.h"
@@ -12,7 +13,22 @@
 /* Diese Tests prüfen das Bewegungsverhalten der KI unter verschiedenen Bedingungen */
 
 void setUp(void) {}
-void tearDown(void) {}
+
+void tearDown(void) {
+    ai_config_t cfg;
+    ai_config_defaults(&cfg);
+    ai_configure(&cfg);
+}
+
+/* Vorhersage-Modus mit wählbarer Streuung aktivieren */
+static void use_predict(float error_base, float error_per_sec) {
+    ai_config_t cfg;
+    ai_config_defaults(&cfg);
+    cfg.mode           = AI_MODE_PREDICT;
+    cfg.error_base     = error_base;
+    cfg.error_per_sec  = error_per_sec;
+    ai_configure(&cfg);
+}
 
 /* ------------------------------------------------------------------
  * make_game
@@ -64,6 +80,83 @@ void test_ai_not_beyond_right_boundary(void) {
     TEST_ASSERT_EQUAL_INT(max_x, game.bot.x);
 }
 
+/* Vorhersage: Bot steuert den Auftreffpunkt an, nicht die Ball-x */
+void test_predict_steers_to_intercept(void) {
+    game_state_t game = make_game(10.0f, 30, 100);
+    game.ball.y  = 20.0f;
+    game.ball.vx = 2.0f;
+    game.ball.vy = -1.0f;           /* trifft Zeile bot.y + 1 = 2 bei x = 46 */
+    use_predict(0.0f, 0.0f);
+    ai_update(&game);
+    TEST_ASSERT_TRUE(game.bot.x > 30);
+    TEST_ASSERT_EQUAL_FLOAT(46.0f, game.bot_ai.target_x);
+}
+
+/* Ziel wird nur bei geänderter Ballrichtung neu berechnet (Zufall
+   wird nur dann verbraucht) */
+void test_predict_caches_target(void) {
+    game_state_t game = make_game(40.0f, 30, 100);
+    game.ball.y  = 20.0f;
+    game.ball.vx = 0.5f;
+    game.ball.vy = -1.0f;
+    use_predict(2.0f, 2.0f);
+
+    ai_update(&game);
+    rng_t after_first = game.rng;
+    float target      = game.bot_ai.target_x;
+    for (int i = 0; i < 5; ++i) {
+        game.ball.x += game.ball.vx;
+        game.ball.y += game.ball.vy;
+        ai_update(&game);
+    }
+    TEST_ASSERT_EQUAL_MEMORY(&after_first, &game.rng, sizeof after_first);
+    TEST_ASSERT_EQUAL_FLOAT(target, game.bot_ai.target_x);
+
+    game.ball.vx = -game.ball.vx;   /* Wandkontakt → neue Bahn */
+    ai_update(&game);
+    TEST_ASSERT_FALSE(memcmp(&after_first, &game.rng, sizeof after_first) == 0);
+}
+
+/* Streuung: Ziele bleiben im Fehlerband und unterscheiden sich */
+void test_predict_error_band(void) {
+    use_predict(1.0f, 1.0f);
+    float lo = 1e9f, hi = -1e9f;
+    for (uint64_t s = 0; s < 64; ++s) {
+        game_state_t game = physics_create_game_seeded(100, 24, 7u, s);
+        game.ball.x  = 50.0f;
+        game.ball.y  = 12.0f;
+        game.ball.vx = 0.0f;
+        game.ball.vy = -1.0f;       /* 10 Ticks = 1 s bis zur Bot-Zeile */
+        ai_update(&game);
+        float t = game.bot_ai.target_x;
+        TEST_ASSERT_TRUE(t >= 48.0f && t <= 52.0f);
+        if (t < lo) lo = t;
+        if (t > hi) hi = t;
+    }
+    TEST_ASSERT_TRUE(hi - lo > 1.0f);
+}
+
+/* Provider liefert 2^31: u = v = 0.5, also keine Streuung */
+static unsigned int half_rand(void) { return 0x80000000u; }
+
+/* Die Streuung zieht über den Zufalls-Provider der Physik, nicht am
+   Spielgenerator vorbei */
+void test_predict_noise_uses_random_provider(void) {
+    game_state_t game = make_game(10.0f, 30, 100);
+    game.ball.y  = 20.0f;
+    game.ball.vx = 2.0f;
+    game.ball.vy = -1.0f;           /* exakter Auftreffpunkt x = 46 */
+    rng_t before = game.rng;
+    use_predict(4.0f, 4.0f);
+
+    physics_set_random_provider(half_rand);
+    ai_update(&game);
+    physics_set_random_provider(NULL);
+
+    TEST_ASSERT_EQUAL_FLOAT(46.0f, game.bot_ai.target_x);
+    TEST_ASSERT_EQUAL_MEMORY(&before, &game.rng, sizeof before);
+}
+
 int main(void) {
     UNITY_BEGIN();
 
@@ -71,6 +164,10 @@ int main(void) {
     RUN_TEST(test_ai_moves_bot_left_when_ball_is_left);
     RUN_TEST(test_ai_not_beyond_left_boundary);
     RUN_TEST(test_ai_not_beyond_right_boundary);
+    RUN_TEST(test_predict_steers_to_intercept);
+    RUN_TEST(test_predict_caches_target);
+    RUN_TEST(test_predict_error_band);
+    RUN_TEST(test_predict_noise_uses_random_provider);
 
     return UNITY_END();
 }
@@ -31,7 +31,7 @@ static void force_score(game_state_t *g)
 }
 
 /*  Erwartung:  v = BALL_INITIAL_SPEED * (1 + score * SPEED_PER_POINT)
-    (ggf. gedeckelt durch BALL_MAX_SPEED)                            */
+    (ggf. gedeckelt durch BALL_MAX_SPEED), je Tick                   */
 void test_speed_after_score_scaling(void)
 {
     game_state_t g = physics_create_game(80, 24);
@@ -41,9 +41,10 @@ void test_speed_after_score_scaling(void)
 
     force_score(&g);            /* macht Punkt 5, ruft reset_ball   */
 
-    float expected = BALL_INITIAL_SPEED * (1 + 5 * SPEED_PER_POINT);
-    if (expected > BALL_MAX_SPEED)
-        expected = BALL_MAX_SPEED;
+    const physics_rate_t *r = physics_rate();
+    float expected = r->ball_initial_speed * (1 + 5 * SPEED_PER_POINT);
+    if (expected > r->ball_max_speed)
+        expected = r->ball_max_speed;
 
     TEST_ASSERT_FLOAT_WITHIN(0.001f, expected, fabsf(g.ball.vx));
 }
@@ -0,0 +1,210 @@
+/* ------------------------------------------------------------------
+ * test_batch_unity.c - Unity-Tests für den Batch-Simulator
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#include <string.h>
+#include "unity.h"
+#include "batch.h"
+#include "physics.h"
+#include "ai.h"
+#include "config.h"
+
+/* Anzahl Spiele bewusst kein Vielfaches der Vektorbreite */
+#define N_GAMES 37
+#define N_TICKS 300
+
+void setUp(void)    { physics_set_solver(PHYS_SOLVER_ANALYTIC); }
+void tearDown(void) {}
+
+/* ------------------------------------------------------------------
+ * make_game
+ * Erzeugt ein Spiel i mit gestreutem Ball- und Paddlezustand.
+ *
+ * Parameter:
+ *   i – Spielindex
+ *
+ * Rückgabe:
+ *   game_state_t
+ * ------------------------------------------------------------------ */
+static game_state_t make_game(int i)
+{
+    game_state_t g = physics_create_game(80, 24);
+    g.ball.x   = 5.0f + (float)((i * 7) % 70);
+    g.ball.y   = 3.0f + (float)((i * 5) % 18);
+    g.ball.vx  = (float)((i % 9) - 4) * 0.7f;
+    g.ball.vy  = ((i % 2) ? 1.0f : -1.0f) * (0.5f + (float)(i % 5) * 0.6f);
+    g.player.x = (float)((i * 11) % 60);
+    g.bot.x    = (float)((i * 13) % 60);
+    return g;
+}
+
+/* Bitmuster eines float (TEST_ASSERT_EQUAL_FLOAT lässt Abweichungen zu) */
+static uint32_t float_bits(float f)
+{
+    uint32_t u;
+    memcpy(&u, &f, sizeof u);
+    return u;
+}
+
+#define TEST_ASSERT_SAME_FLOAT(expected, actual) \
+    TEST_ASSERT_EQUAL_HEX32(float_bits(expected), float_bits(actual))
+
+/* Ohne Punkt (Zufall) rechnet der Batch bitgleich zum skalaren Code */
+void test_batch_matches_scalar(void)
+{
+    batch_t *b = batch_create(N_GAMES, 80, 24, 1u);
+    TEST_ASSERT_NOT_NULL(b);
+
+    game_state_t games[N_GAMES];
+    bool         compare[N_GAMES];
+    float        dir[N_GAMES];
+    for (int i = 0; i < N_GAMES; ++i) {
+        games[i]   = make_game(i);
+        compare[i] = true;
+        batch_load(b, i, &games[i]);
+    }
+
+    int checked = 0, hits = 0;
+    for (int t = 0; t < N_TICKS; ++t) {
+        /* Spieler folgt dem Ball grob, mit Pausen → lange Ballwechsel */
+        for (int i = 0; i < N_GAMES; ++i) {
+            float mid = b->player_x[i] + b->paddle_width / 2.0f;
+            dir[i] = ((i + t) % 4 == 0) ? 0.0f : (b->ball_x[i] > mid ? 1.0f : -1.0f);
+        }
+        batch_step(b, dir);
+
+        for (int i = 0; i < N_GAMES; ++i) {
+            if (!compare[i])
+                continue;
+            game_state_t *g = &games[i];
+            physics_player_update(g, (int)dir[i]);
+            ai_update(g);
+            physics_event_t ev = physics_update_ball_events(g);
+
+            TEST_ASSERT_EQUAL_UINT32(ev, b->events[i]);
+            TEST_ASSERT_SAME_FLOAT(g->player.x, b->player_x[i]);
+            TEST_ASSERT_SAME_FLOAT(g->bot.x,    b->bot_x[i]);
+            TEST_ASSERT_SAME_FLOAT(g->bot.vx,   b->bot_vx[i]);
+            TEST_ASSERT_SAME_FLOAT(g->ball.y,   b->ball_y[i]);
+            TEST_ASSERT_SAME_FLOAT(g->ball.vy,  b->ball_vy[i]);
+            if (!(ev & PHYS_EVENT_SCORED)) {
+                TEST_ASSERT_SAME_FLOAT(g->ball.x,  b->ball_x[i]);
+                TEST_ASSERT_SAME_FLOAT(g->ball.vx, b->ball_vx[i]);
+            }
+            TEST_ASSERT_SAME_FLOAT((float)g->paddle_hits, b->paddle_hits[i]);
+            checked++;
+            if (ev & (PHYS_EVENT_HIT_BOT | PHYS_EVENT_HIT_PLAYER))
+                hits++;
+
+            /* Nach Punkt (andere Zufallsquelle) bzw. Spielende nicht weiter vergleichen */
+            if (ev & (PHYS_EVENT_SCORED | PHYS_EVENT_GAME_OVER))
+                compare[i] = false;
+        }
+    }
+    TEST_ASSERT_TRUE(checked > N_GAMES * 20);
+    TEST_ASSERT_TRUE(hits > N_GAMES);
+    batch_destroy(b);
+}
+
+/* Game Over friert die Lane ein und wird genau einmal gemeldet */
+void test_game_over_freezes_lane(void)
+{
+    batch_t *b = batch_create(3, 80, 24, 7u);
+    game_state_t g = make_game(0);
+    g.player.x = 0.0f;
+    g.ball.x   = 60.0f;
+    g.ball.y   = 23.5f;
+    g.ball.vx  = 0.0f;
+    g.ball.vy  = 1.0f;
+    batch_load(b, 1, &g);
+
+    float still[3] = {0};
+    int running = batch_step(b, still);
+    TEST_ASSERT_EQUAL_INT(2, running);
+    TEST_ASSERT_EQUAL_UINT32(PHYS_EVENT_GAME_OVER, b->events[1]);
+    TEST_ASSERT_EQUAL_UINT32(0u, b->alive[1]);
+
+    float y = b->ball_y[1];
+    batch_step(b, still);
+    TEST_ASSERT_EQUAL_UINT32(0u, b->events[1]);
+    TEST_ASSERT_EQUAL_FLOAT(y, b->ball_y[1]);
+    batch_destroy(b);
+}
+
+/* Punkt: Score steigt, Ball startet unter dem Bot mit höherem Tempo */
+void test_score_resets_ball(void)
+{
+    batch_t *b = batch_create(1, 80, 24, 3u);
+    game_state_t g = make_game(0);
+    g.bot.x   = 0.0f;
+    g.ball.x  = 70.0f;
+    g.ball.y  = 0.5f;
+    g.ball.vx = 0.0f;
+    g.ball.vy = -2.0f;
+    batch_load(b, 0, &g);
+
+    batch_step(b, NULL);
+    batch_store(b, 0, &g);
+
+    float base = physics_rate()->ball_initial_speed * (1.0f + 1 * SPEED_PER_POINT);
+    TEST_ASSERT_EQUAL_UINT32(PHYS_EVENT_SCORED, b->events[0]);
+    TEST_ASSERT_EQUAL_INT(1, g.score);
+    TEST_ASSERT_EQUAL_INT(0, g.paddle_hits);
+    TEST_ASSERT_EQUAL_FLOAT((float)(g.bot.y + 1), g.ball.y);
+    TEST_ASSERT_EQUAL_FLOAT(base, g.ball.vy);
+    TEST_ASSERT_EQUAL_FLOAT(base, fabsf(g.ball.vx));
+    batch_destroy(b);
+}
+
+/* Gleicher Seed → gleicher Verlauf, unabhängig von der Spielanzahl */
+void test_seed_is_deterministic(void)
+{
+    batch_t *a = batch_create(5, 80, 24, 42u);
+    batch_t *c = batch_create(21, 80, 24, 42u);
+    for (int t = 0; t < 2000; ++t) {
+        batch_step(a, NULL);
+        batch_step(c, NULL);
+    }
+    for (int i = 0; i < 5; ++i) {
+        TEST_ASSERT_EQUAL_FLOAT(a->ball_x[i], c->ball_x[i]);
+        TEST_ASSERT_EQUAL_FLOAT(a->score[i],  c->score[i]);
+        TEST_ASSERT_EQUAL_UINT32(a->alive[i], c->alive[i]);
+    }
+    batch_destroy(a);
+    batch_destroy(c);
+}
+
+/* Kompaktieren: laufende Spiele vorne, id[] zeigt auf das Original */
+void test_compact_keeps_running_games(void)
+{
+    batch_t *b = batch_create(10, 80, 24, 5u);
+    b->alive[2] = b->alive[7] = 0;
+    float y3 = b->ball_y[3] = 5.0f;
+    float y9 = b->ball_y[9] = 9.0f;
+
+    batch_compact(b);
+    TEST_ASSERT_EQUAL_INT(8, b->active);
+    for (int i = 0; i < b->active; ++i) {
+        TEST_ASSERT_NOT_EQUAL(0u, b->alive[i]);
+        TEST_ASSERT_NOT_EQUAL(2, b->id[i]);
+        TEST_ASSERT_NOT_EQUAL(7, b->id[i]);
+        if (b->id[i] == 3) TEST_ASSERT_EQUAL_FLOAT(y3, b->ball_y[i]);
+        if (b->id[i] == 9) TEST_ASSERT_EQUAL_FLOAT(y9, b->ball_y[i]);
+    }
+    batch_destroy(b);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_batch_matches_scalar);
+    RUN_TEST(test_game_over_freezes_lane);
+    RUN_TEST(test_score_resets_ball);
+    RUN_TEST(test_seed_is_deterministic);
+    RUN_TEST(test_compact_keeps_running_games);
+
+    return UNITY_END();
+}
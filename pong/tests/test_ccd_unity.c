@@ -0,0 +1,131 @@
+/* ------------------------------------------------------------------
+ * test_ccd_unity.c - Unity-Tests für die analytische Kollision
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#include "unity.h"
+#include "physics.h"
+#include "config.h"
+#include <math.h>
+
+/* Diese Tests vergleichen den analytischen Löser (Standard) mit dem
+   Sub-Step-Kompatibilitätsmodus */
+
+void setUp(void)    { physics_set_solver(PHYS_SOLVER_ANALYTIC); }
+void tearDown(void) { physics_set_solver(PHYS_SOLVER_ANALYTIC); }
+
+/* ------------------------------------------------------------------
+ * free_field
+ * Spielfeld, in dem die Paddles aus dem Weg sind, damit nur Wände
+ * den Ball ablenken.
+ *
+ * Parameter:
+ *   x, y, vx, vy – Startzustand des Balls
+ *
+ * Rückgabe:
+ *   game_state_t
+ * ------------------------------------------------------------------ */
+static game_state_t free_field(float x, float y, float vx, float vy)
+{
+    game_state_t g = physics_create_game(80, 24);
+    g.bot.x    = -1000.0f;
+    g.player.x = -1000.0f;
+    g.ball.x  = x;
+    g.ball.y  = y;
+    g.ball.vx = vx;
+    g.ball.vy = vy;
+    return g;
+}
+
+/* Reflexion an der Wand verliert keine Strecke (Sub-Step klemmt) */
+void test_wall_reflection_is_exact(void)
+{
+    game_state_t g = free_field(0.5f, 12.0f, -3.0f, 0.0f);
+    physics_update_ball_events(&g);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 2.5f, g.ball.x);
+    TEST_ASSERT_EQUAL_FLOAT(3.0f, g.ball.vx);
+
+    physics_set_solver(PHYS_SOLVER_SUBSTEP);
+    g = free_field(0.5f, 12.0f, -3.0f, 0.0f);
+    physics_update_ball_events(&g);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 2.0f, g.ball.x);   /* bisheriges Ergebnis */
+}
+
+/* Sehr schneller Ball: mehrere Wandkontakte in einem Tick */
+void test_multiple_wall_contacts_per_tick(void)
+{
+    /* 40 → 79 (39), → 0 (79), → 79 (79), Rest 3 zurück → 76 */
+    game_state_t g = free_field(40.0f, 12.0f, 200.0f, 0.0f);
+    physics_update_ball_events(&g);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 76.0f, g.ball.x);
+    TEST_ASSERT_TRUE(g.ball.vx < 0.0f);
+}
+
+/* Schneller Ball tunnelt nicht durch das Paddle */
+void test_fast_ball_hits_paddle(void)
+{
+    game_state_t g = physics_create_game(80, 24);
+    g.player.x = 30.0f;
+    g.ball.x  = 35.0f;
+    g.ball.y  = 10.0f;
+    g.ball.vx = 0.0f;
+    g.ball.vy = 40.0f;                 /* weit über BALL_MAX_SPEED     */
+
+    physics_event_t ev = physics_update_ball_events(&g);
+
+    TEST_ASSERT_TRUE(ev & PHYS_EVENT_HIT_PLAYER);
+    TEST_ASSERT_FALSE(ev & PHYS_EVENT_GAME_OVER);
+    TEST_ASSERT_TRUE(g.ball.vy < 0.0f);
+    TEST_ASSERT_EQUAL_INT(1, g.paddle_hits);
+}
+
+/* Ball, der das Paddle knapp verfehlt, fällt ins Aus */
+void test_ball_misses_paddle(void)
+{
+    game_state_t g = physics_create_game(80, 24);
+    g.player.x = 30.0f;
+    g.ball.x  = 20.0f;
+    g.ball.y  = 20.0f;
+    g.ball.vx = 0.0f;
+    g.ball.vy = 5.0f;
+
+    physics_event_t ev = physics_update_ball_events(&g);
+
+    TEST_ASSERT_FALSE(ev & PHYS_EVENT_HIT_PLAYER);
+    TEST_ASSERT_TRUE(ev & PHYS_EVENT_GAME_OVER);
+}
+
+/* Beide Löser liefern bei normalem Tempo dieselben Ereignisse */
+void test_solvers_agree_on_events(void)
+{
+    for (int mode = 0; mode < 2; ++mode) {
+        physics_set_solver(mode ? PHYS_SOLVER_SUBSTEP : PHYS_SOLVER_ANALYTIC);
+        game_state_t g = physics_create_game(80, 24);
+        g.player.x = 30.0f;
+        g.ball.x  = 35.0f;
+        g.ball.y  = 15.0f;
+        g.ball.vx = 0.3f;
+        g.ball.vy = 1.0f;
+
+        int hits = 0;
+        for (int t = 0; t < 10; ++t)
+            if (physics_update_ball_events(&g) & PHYS_EVENT_HIT_PLAYER)
+                hits++;
+        TEST_ASSERT_EQUAL_INT(1, hits);
+        TEST_ASSERT_TRUE(g.ball.vy < 0.0f);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_wall_reflection_is_exact);
+    RUN_TEST(test_multiple_wall_contacts_per_tick);
+    RUN_TEST(test_fast_ball_hits_paddle);
+    RUN_TEST(test_ball_misses_paddle);
+    RUN_TEST(test_solvers_agree_on_events);
+
+    return UNITY_END();
+}
@@ -0,0 +1,131 @@
+/* ------------------------------------------------------------------
+ * test_farm_unity.c - Unity-Tests für den Farmbetrieb
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#include "unity.h"
+#include "farm.h"
+#include <string.h>
+
+void setUp(void)    {}
+void tearDown(void) {}
+
+/* ------------------------------------------------------------------
+ * run_farm_chunk / run_farm
+ * Führen einen kleinen Farmlauf mit gegebener Engine/Thread-Zahl aus
+ * (run_farm mit Paketgröße 7).
+ *
+ * Parameter:
+ *   engine  – Simulationskern
+ *   threads – Anzahl Threads
+ *   seed    – Seed
+ *   chunk   – Spiele je Paket
+ *
+ * Rückgabe:
+ *   Ergebnis
+ * ------------------------------------------------------------------ */
+static farm_result_t run_farm_chunk(farm_engine_t engine, int threads, uint32_t seed,
+                                    int chunk)
+{
+    farm_config_t cfg;
+    farm_config_defaults(&cfg);
+    cfg.games   = 300;
+    cfg.ticks   = 400;
+    cfg.seed    = seed;
+    cfg.threads = threads;
+    cfg.chunk   = chunk;
+    cfg.engine  = engine;
+
+    farm_result_t res;
+    TEST_ASSERT_TRUE(farm_run(&cfg, &res));
+    return res;
+}
+
+static farm_result_t run_farm(farm_engine_t engine, int threads, uint32_t seed)
+{
+    return run_farm_chunk(engine, threads, seed, 7);   /* viele kleine Pakete → Stehlen wahrscheinlich */
+}
+
+/* ------------------------------------------------------------------
+ * assert_same_stats
+ * Vergleicht alle Statistikfelder zweier Läufe (ohne Zeit/Threads).
+ *
+ * Parameter:
+ *   a, b – Ergebnisse
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void assert_same_stats(const farm_result_t *a, const farm_result_t *b)
+{
+    TEST_ASSERT_EQUAL_UINT32(a->games,      b->games);
+    TEST_ASSERT_EQUAL_UINT32(a->ticks,      b->ticks);
+    TEST_ASSERT_EQUAL_UINT32(a->game_overs, b->game_overs);
+    TEST_ASSERT_EQUAL_UINT32(a->score_sum,  b->score_sum);
+    TEST_ASSERT_EQUAL_INT(a->score_min, b->score_min);
+    TEST_ASSERT_EQUAL_INT(a->score_max, b->score_max);
+    TEST_ASSERT_EQUAL_UINT32(a->rallies,    b->rallies);
+    TEST_ASSERT_EQUAL_UINT32(a->rally_hits, b->rally_hits);
+    TEST_ASSERT_EQUAL_UINT32(a->rally_max,  b->rally_max);
+    TEST_ASSERT_EQUAL_MEMORY(a->score_hist, b->score_hist, sizeof a->score_hist);
+    TEST_ASSERT_EQUAL_MEMORY(a->rally_hist, b->rally_hist, sizeof a->rally_hist);
+}
+
+/* Gleicher Seed → gleiches Ergebnis, egal wie viele Threads */
+void test_scalar_reproducible_across_threads(void)
+{
+    farm_result_t one  = run_farm(FARM_ENGINE_SCALAR, 1, 11u);
+    farm_result_t many = run_farm(FARM_ENGINE_SCALAR, 5, 11u);
+    assert_same_stats(&one, &many);
+    TEST_ASSERT_EQUAL_INT(5, many.threads);
+}
+
+void test_batch_reproducible_across_threads(void)
+{
+    farm_result_t one  = run_farm(FARM_ENGINE_BATCH, 1, 11u);
+    farm_result_t many = run_farm(FARM_ENGINE_BATCH, 4, 11u);
+    assert_same_stats(&one, &many);
+}
+
+/* Die Paketgröße bestimmt nur die Aufteilung, nicht den Zufall der Spiele */
+void test_batch_reproducible_across_chunks(void)
+{
+    farm_result_t small = run_farm_chunk(FARM_ENGINE_BATCH, 2, 11u, 4);
+    farm_result_t large = run_farm_chunk(FARM_ENGINE_BATCH, 2, 11u, 128);
+    assert_same_stats(&small, &large);
+}
+
+/* Jedes Spiel wird genau einmal gezählt, Ticks respektieren das Limit */
+void test_every_game_counted_once(void)
+{
+    farm_result_t r = run_farm(FARM_ENGINE_SCALAR, 3, 2u);
+    unsigned long hist = 0;
+    for (int i = 0; i < FARM_HIST_BUCKETS; ++i)
+        hist += r.score_hist[i];
+    TEST_ASSERT_EQUAL_UINT32(300, r.games);
+    TEST_ASSERT_EQUAL_UINT32(300, hist);
+    TEST_ASSERT_TRUE(r.ticks <= 300ul * 400ul);
+    TEST_ASSERT_TRUE(r.rallies >= r.games);
+}
+
+/* Anderer Seed → anderer Verlauf */
+void test_seed_changes_outcome(void)
+{
+    farm_result_t a = run_farm(FARM_ENGINE_SCALAR, 2, 1u);
+    farm_result_t b = run_farm(FARM_ENGINE_SCALAR, 2, 2u);
+    TEST_ASSERT_TRUE(a.ticks != b.ticks || a.rally_hits != b.rally_hits);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_scalar_reproducible_across_threads);
+    RUN_TEST(test_batch_reproducible_across_threads);
+    RUN_TEST(test_batch_reproducible_across_chunks);
+    RUN_TEST(test_every_game_counted_once);
+    RUN_TEST(test_seed_changes_outcome);
+
+    return UNITY_END();
+}
@@ -0,0 +1,166 @@
+/* ------------------------------------------------------------------
+ * test_fixed_unity.c - Unity-Tests für die Festkomma-Physik
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#include <math.h>
+#include "unity.h"
+#include "fixed.h"
+#include "physics.h"
+#include "ai.h"
+
+/* Prüfsumme von run_games(16, 2000); gleich für -O0, -O3 -march=native
+   und -O3 -ffast-math */
+#define FIXED_GOLDEN 0x239B0DD3u
+
+void setUp(void)    { physics_set_numeric(PHYS_NUMERIC_FIXED); }
+void tearDown(void) { physics_set_numeric(PHYS_NUMERIC_FLOAT); }
+
+/* ------------------------------------------------------------------
+ * run_games
+ * Spielt mehrere Bot-gegen-Bot-Spiele und faltet den kompletten
+ * Zustand jedes Ticks (Bitmuster der floats) in eine FNV-1a-Prüfsumme.
+ *
+ * Parameter:
+ *   games – Anzahl Spiele
+ *   ticks – Ticks pro Spiel
+ *   hits  – Ausgabe: Paddle-Treffer insgesamt
+ *
+ * Rückgabe:
+ *   Prüfsumme
+ * ------------------------------------------------------------------ */
+static uint32_t run_games(int games, int ticks, int *hits)
+{
+    uint32_t h = 2166136261u;
+    *hits = 0;
+    for (int i = 0; i < games; ++i) {
+        game_state_t g = physics_create_game_seeded(80, 24, 1u, (uint64_t)i);
+        for (int t = 0; t < ticks; ++t) {
+            ai_player_update(&g);
+            ai_update(&g);
+            physics_event_t ev = physics_update_ball_events(&g);
+            if (ev & (PHYS_EVENT_HIT_BOT | PHYS_EVENT_HIT_PLAYER))
+                (*hits)++;
+
+            fix_t words[] = {
+                fix_from_float(g.ball.x), fix_from_float(g.ball.y),
+                fix_from_float(g.ball.vx), fix_from_float(g.ball.vy),
+                fix_from_float(g.player.x), fix_from_float(g.bot.x),
+                (fix_t)ev, g.score,
+            };
+            for (size_t k = 0; k < sizeof words / sizeof words[0]; ++k) {
+                h ^= (uint32_t)words[k];
+                h *= 16777619u;
+            }
+            if (ev & PHYS_EVENT_GAME_OVER)
+                break;
+        }
+    }
+    return h;
+}
+
+/* Ganzzahlige Wurzel: exakt abgerundet, auch an Quadratgrenzen */
+void test_isqrt_exact(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(0u, fix_isqrt64(0u));
+    TEST_ASSERT_EQUAL_UINT32(3u, fix_isqrt64(15u));
+    TEST_ASSERT_EQUAL_UINT32(4u, fix_isqrt64(16u));
+    TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFu, fix_isqrt64(UINT64_MAX));
+    TEST_ASSERT_EQUAL_INT32(FIX_INT(3), fix_sqrt(FIX_INT(9)));
+    TEST_ASSERT_EQUAL_INT32(FIX_INT(5), fix_hypot(FIX_INT(3), FIX_INT(-4)));
+}
+
+/* Multiplikation/Division runden symmetrisch gegen 0, Division sättigt */
+void test_mul_div_round_toward_zero(void)
+{
+    TEST_ASSERT_EQUAL_INT32(FIX_INT(6), fix_mul(FIX_INT(2), FIX_INT(3)));
+    TEST_ASSERT_EQUAL_INT32(-fix_mul(3, FIX_HALF), fix_mul(-3, FIX_HALF));
+    TEST_ASSERT_EQUAL_INT32(FIX_HALF, fix_div(FIX_INT(1), FIX_INT(2)));
+    TEST_ASSERT_EQUAL_INT32(-fix_div(FIX_INT(1), 3), fix_div(FIX_INT(-1), 3));
+    TEST_ASSERT_EQUAL_INT32(FIX_MAX, fix_div(FIX_INT(1000), 1));
+    TEST_ASSERT_EQUAL_INT32(-FIX_MAX, fix_div(FIX_INT(-1), 0));
+}
+
+/* float-Felder tragen Q16.16-Werte verlustfrei (|v| < 256) */
+void test_float_round_trip(void)
+{
+    fix_t v[] = { 1, -1, FIX_INT(255) + 0xFFFF, -FIX_INT(200) - 7, 0 };
+    for (size_t i = 0; i < sizeof v / sizeof v[0]; ++i)
+        TEST_ASSERT_EQUAL_INT32(v[i], fix_from_float(fix_to_float(v[i])));
+}
+
+/* Reflexion: Richtung umgekehrt, Tempo in den Grenzen, Steigung ≥ 25 % */
+void test_reflect_limits(void)
+{
+    fix_paddle_t p = { FIX_INT(10), 1, 8, FIX_INT(2), 0 };
+    fix_t v_max = fix_from_float(physics_rate()->ball_max_speed);
+    fix_t v_min = fix_from_float(physics_rate()->ball_min_speed);
+    for (int x = 8; x <= 20; ++x) {
+        fix_ball_t b = { FIX_INT(x), FIX_INT(1), FIX_INT(1), -FIX_INT(2) };
+        fix_reflect_paddle(&b, &p, 3);
+        fix_t mag = fix_hypot(b.vx, b.vy);
+        TEST_ASSERT_TRUE(b.vy > 0);
+        TEST_ASSERT_TRUE(mag <= v_max + 2);
+        TEST_ASSERT_TRUE(mag >= fix_mul(v_min, FIX_CONST(1.15)) - 2);
+        TEST_ASSERT_TRUE(b.vy >= fix_mul(mag, FIX_CONST(BALL_MIN_VY_FRAC)) - 2);
+    }
+}
+
+/* Festkomma folgt dem float-Modus bis auf Rundung; der Bot kann an der
+   Entscheidungsschwelle (0.5 Zellen) einen Tick früher losfahren */
+void test_fixed_tracks_float(void)
+{
+    game_state_t a = physics_create_game_seeded(80, 24, 3u, 0u);
+    game_state_t b = a;
+    for (int t = 0; t < 20; ++t) {
+        physics_set_numeric(PHYS_NUMERIC_FLOAT);
+        ai_update(&a);
+        physics_update_ball_events(&a);
+        physics_set_numeric(PHYS_NUMERIC_FIXED);
+        ai_update(&b);
+        physics_update_ball_events(&b);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, a.ball.x, b.ball.x);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, a.ball.y, b.ball.y);
+    TEST_ASSERT_FLOAT_WITHIN(0.5f,  a.bot.x,  b.bot.x);
+}
+
+/* Beide Paddles laufen im Festkomma-Modus über fix_update_paddle:
+   Position und Tempo liegen nach jedem Tick im Q16.16-Raster */
+void test_paddles_stay_on_fixed_grid(void)
+{
+    game_state_t g = physics_create_game_seeded(80, 24, 5u, 0u);
+    for (int t = 0; t < 50; ++t) {
+        physics_player_update(&g, t < 20 ? +1 : 0);
+        physics_bot_update(&g, t < 30 ? -1 : 0);
+        const float v[] = { g.player.x, g.player.vx, g.bot.x, g.bot.vx };
+        for (size_t k = 0; k < sizeof v / sizeof v[0]; ++k)
+            TEST_ASSERT_EQUAL_FLOAT(v[k], fix_to_float(fix_from_float(v[k])));
+    }
+    TEST_ASSERT_TRUE(g.player.x > 0.0f);
+}
+
+/* Goldene Prüfsumme: muss auf jeder Plattform und bei jedem -O gleich sein */
+void test_golden_checksum(void)
+{
+    int hits;
+    uint32_t h = run_games(16, 2000, &hits);
+    TEST_ASSERT_TRUE(hits > 16);
+    TEST_ASSERT_EQUAL_HEX32(FIXED_GOLDEN, h);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_isqrt_exact);
+    RUN_TEST(test_mul_div_round_toward_zero);
+    RUN_TEST(test_float_round_trip);
+    RUN_TEST(test_reflect_limits);
+    RUN_TEST(test_fixed_tracks_float);
+    RUN_TEST(test_paddles_stay_on_fixed_grid);
+    RUN_TEST(test_golden_checksum);
+
+    return UNITY_END();
+}
@@ -0,0 +1,133 @@
+/* ------------------------------------------------------------------
+ * test_hist_unity.c - Unity-Tests für Histogramm und Laufzeitmessung
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+#include "hist.h"
+#include "instr.h"
+#include "rng.h"
+
+#define DUMP_FILE "build/test_instr.txt"
+
+static hist_t h;
+
+void setUp(void)    { hist_reset(&h); }
+void tearDown(void) { remove(DUMP_FILE); }
+
+static int cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+/* Eimer lückenlos und monoton; jeder Wert liegt in seinem Eimer,
+   die Eimerbreite ist höchstens 1/HIST_SUB_COUNT des Werts */
+void test_buckets_cover_range_with_bounded_error(void)
+{
+    rng_t r;
+    rng_seed(&r, 1u, 0u);
+    for (int i = 0; i < 100000; ++i) {
+        uint64_t v = ((uint64_t)rng_next(&r) << 32 | rng_next(&r)) >> (rng_next(&r) % 64);
+        if (v >= HIST_MAX_VALUE)
+            v %= HIST_MAX_VALUE;
+        unsigned b    = hist_bucket(v);
+        uint64_t high = hist_bucket_high(b);
+        uint64_t low  = b ? hist_bucket_high(b - 1) + 1 : 0;
+        TEST_ASSERT_TRUE(b < HIST_BUCKETS);
+        TEST_ASSERT_TRUE(low <= v && v <= high);
+        TEST_ASSERT_TRUE((double)(high - low) <= (double)v / HIST_SUB_COUNT);
+    }
+    TEST_ASSERT_EQUAL_UINT(HIST_BUCKETS - 1, hist_bucket(HIST_MAX_VALUE - 1));
+    TEST_ASSERT_EQUAL_UINT(HIST_BUCKETS - 1, hist_bucket(UINT64_MAX));
+}
+
+/* Kleine Werte sind exakt */
+void test_small_values_are_exact(void)
+{
+    for (uint64_t v = 1; v <= 10; ++v)
+        hist_record(&h, v);
+    TEST_ASSERT_EQUAL_UINT64(5, hist_percentile(&h, 50.0));
+    TEST_ASSERT_EQUAL_UINT64(9, hist_percentile(&h, 90.0));
+    TEST_ASSERT_EQUAL_UINT64(10, hist_percentile(&h, 100.0));
+    TEST_ASSERT_EQUAL_UINT64(1, h.min);
+    TEST_ASSERT_EQUAL_FLOAT(5.5f, (float)hist_mean(&h));
+}
+
+/* Perzentile wie aus der sortierten Messreihe, bis auf die Eimerbreite */
+void test_percentiles_match_sorted_samples(void)
+{
+    enum { N = 20000 };
+    static uint64_t v[N];
+    rng_t r;
+    rng_seed(&r, 9u, 0u);
+    for (int i = 0; i < N; ++i) {
+        /* schief wie Frame-Zeiten: meist ~40 µs, selten bis 20 ms */
+        v[i] = 40000u + rng_next(&r) % 5000u;
+        if (rng_next(&r) % 200u == 0)
+            v[i] = 1000000u + rng_next(&r) % 19000000u;
+        hist_record(&h, v[i]);
+    }
+    qsort(v, N, sizeof v[0], cmp_u64);
+
+    const double ps[] = { 50.0, 90.0, 99.0, 99.9 };
+    for (int i = 0; i < 4; ++i) {
+        uint64_t exact = v[(size_t)(ps[i] / 100.0 * N + 0.999999) - 1];
+        uint64_t got   = hist_percentile(&h, ps[i]);
+        TEST_ASSERT_TRUE(got >= exact);
+        TEST_ASSERT_TRUE((double)(got - exact) <= (double)exact / HIST_SUB_COUNT);
+    }
+    TEST_ASSERT_EQUAL_UINT64(v[N - 1], hist_percentile(&h, 100.0));
+    TEST_ASSERT_EQUAL_UINT64(v[N - 1], h.max);
+}
+
+void test_empty_histogram(void)
+{
+    TEST_ASSERT_EQUAL_UINT64(0, hist_percentile(&h, 99.0));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, (float)hist_mean(&h));
+}
+
+/* Ausgabe enthält jeden Abschnitt mit seiner Anzahl */
+void test_instr_dump_lists_all_phases(void)
+{
+    instr_reset();
+    instr_record(INSTR_PHYSICS, 1500);
+    instr_record(INSTR_PHYSICS, 2500);
+    TEST_ASSERT_EQUAL_UINT64(2, instr_hist(INSTR_PHYSICS)->total);
+    TEST_ASSERT_TRUE(instr_dump(DUMP_FILE));
+
+    FILE *f = fopen(DUMP_FILE, "r");
+    TEST_ASSERT_NOT_NULL(f);
+    char line[256];
+    int  phases = 0;
+    while (fgets(line, sizeof line, f)) {
+        for (int p = 0; p < INSTR_PHASES; ++p) {
+            const char *name = instr_phase_name((instr_phase_t)p);
+            if (strncmp(line, name, strlen(name)) == 0 && line[strlen(name)] == ' ') {
+                phases++;
+                if (p == INSTR_PHYSICS) {
+                    unsigned long long count = 0;
+                    sscanf(line + strlen(name), "%llu", &count);
+                    TEST_ASSERT_EQUAL_UINT64(2, count);
+                }
+            }
+        }
+    }
+    fclose(f);
+    TEST_ASSERT_EQUAL_INT(INSTR_PHASES, phases);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_buckets_cover_range_with_bounded_error);
+    RUN_TEST(test_small_values_are_exact);
+    RUN_TEST(test_percentiles_match_sorted_samples);
+    RUN_TEST(test_empty_histogram);
+    RUN_TEST(test_instr_dump_lists_all_phases);
+    return UNITY_END();
+}
@@ -0,0 +1,85 @@
+/* ------------------------------------------------------------------
+ * test_hudstats_unity.c - Unity-Tests für die Leistungsfenster
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#include <string.h>
+#include "unity.h"
+#include "hudstats.h"
+
+static hudstats_t w;
+
+void setUp(void)    { hudstats_reset(&w); }
+void tearDown(void) {}
+
+static void push(uint64_t frame_ns, uint64_t flush_ns, uint32_t bytes, uint32_t ticks)
+{
+    hudstats_sample_t s = { frame_ns, flush_ns, bytes, ticks };
+    hudstats_push(&w, &s);
+}
+
+/* Gleichmäßige 16-ms-Frames: 62,5 fps, Bytes/s aus der Fensterdauer */
+void test_steady_frames(void)
+{
+    for (int i = 0; i < 10; ++i)
+        push(16000000u, 500000u, 1000u, i % 2);
+
+    hudstats_summary_t sum;
+    hudstats_summary(&w, &sum);
+    TEST_ASSERT_EQUAL_UINT(10, w.count);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 62.5f, (float)sum.fps);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.5f, (float)sum.ticks_per_frame);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 16.0f, (float)sum.frame_avg_ms);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 16.0f, (float)sum.frame_max_ms);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.5f, (float)sum.flush_avg_ms);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 62500.0f, (float)sum.bytes_per_s);
+}
+
+/* Ein Ruckler zählt, bis er aus dem Fenster gefallen ist */
+void test_spike_leaves_window(void)
+{
+    push(200000000u, 0, 0, 12);
+    for (int i = 0; i < HUDSTATS_WINDOW - 1; ++i)
+        push(16000000u, 0, 0, 0);
+
+    hudstats_summary_t sum;
+    hudstats_summary(&w, &sum);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 200.0f, (float)sum.frame_max_ms);
+    TEST_ASSERT_EQUAL_UINT64(12, w.sum_ticks);
+
+    push(16000000u, 0, 0, 0);
+    hudstats_summary(&w, &sum);
+    TEST_ASSERT_EQUAL_UINT(HUDSTATS_WINDOW, w.count);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 16.0f, (float)sum.frame_max_ms);
+    TEST_ASSERT_EQUAL_UINT64(0, w.sum_ticks);
+    TEST_ASSERT_EQUAL_UINT64(16000000ull * HUDSTATS_WINDOW, w.sum_frame_ns);
+}
+
+/* Leeres Fenster: keine Division durch 0 */
+void test_empty_window(void)
+{
+    hudstats_summary_t sum;
+    hudstats_summary(&w, &sum);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, (float)sum.fps);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, (float)sum.bytes_per_s);
+}
+
+void test_format(void)
+{
+    hudstats_summary_t sum = { 60.0, 0.16, 16.7, 18.24, 0.05, 1234.0 };
+    char buf[96];
+    hudstats_format(&sum, buf, sizeof buf);
+    TEST_ASSERT_EQUAL_STRING(
+        "60 fps  0.16 t/f  frame 16.7/18.2 ms  refresh 0.05 ms  1.2 kB/s", buf);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_steady_frames);
+    RUN_TEST(test_spike_leaves_window);
+    RUN_TEST(test_empty_window);
+    RUN_TEST(test_format);
+    return UNITY_END();
+}
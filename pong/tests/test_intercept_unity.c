@@ -0,0 +1,107 @@
+/* ------------------------------------------------------------------
+ * test_intercept_unity.c - Unity-Tests für die Trefferpunkt-Vorhersage
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#include "unity.h"
+#include "physics.h"
+#include "rng.h"
+
+#define FIELD_H 200
+
+void setUp(void)    { physics_set_solver(PHYS_SOLVER_ANALYTIC); }
+void tearDown(void) {}
+
+/* ------------------------------------------------------------------
+ * free_field
+ * Hohes Spielfeld ohne erreichbare Paddles: nur Wände lenken ab.
+ *
+ * Parameter:
+ *   w            – Spielfeldbreite
+ *   x, y, vx, vy – Startzustand des Balls
+ *
+ * Rückgabe:
+ *   game_state_t
+ * ------------------------------------------------------------------ */
+static game_state_t free_field(int w, float x, float y, float vx, float vy)
+{
+    game_state_t g = physics_create_game(w, FIELD_H);
+    g.bot.x    = -1000.0f;
+    g.player.x = -1000.0f;
+    g.ball.x   = x;
+    g.ball.y   = y;
+    g.ball.vx  = vx;
+    g.ball.vy  = vy;
+    return g;
+}
+
+/* Von Hand: 1 Wandkontakt rechts, Auftreffpunkt gespiegelt */
+void test_single_bounce(void)
+{
+    game_state_t g = free_field(21, 18.0f, 50.0f, 1.0f, 1.0f);
+    physics_intercept_t hit;
+    TEST_ASSERT_TRUE(physics_predict_intercept(&g, 56, &hit));
+    TEST_ASSERT_EQUAL_FLOAT(6.0f, hit.t);
+    TEST_ASSERT_EQUAL_FLOAT(16.0f, hit.x);     /* 18 → 20 → 16 */
+    TEST_ASSERT_EQUAL_INT(1, hit.bounces);
+}
+
+/* Ball fliegt weg oder steht vertikal → keine Vorhersage */
+void test_moving_away(void)
+{
+    physics_intercept_t hit;
+    game_state_t g = free_field(40, 10.0f, 50.0f, 1.0f, -1.0f);
+    TEST_ASSERT_FALSE(physics_predict_intercept(&g, 60, &hit));
+    g.ball.vy = 0.0f;
+    TEST_ASSERT_FALSE(physics_predict_intercept(&g, 60, &hit));
+}
+
+/* Eigenschaft: Vorhersage == Tick-für-Tick-Simulation, für zufällige
+   Breiten, Positionen und Tempi (vy so gewählt, dass die Zeile genau
+   an einer Tickgrenze erreicht wird) */
+void test_matches_brute_force(void)
+{
+    static const float vys[] = { 0.25f, 0.5f, 1.0f, 2.0f, 4.0f };
+    rng_t r;
+    rng_seed(&r, 2025u, 10u);
+
+    for (int n = 0; n < 500; ++n) {
+        int   w     = 20 + (int)(rng_next(&r) % 100);
+        float vy    = vys[rng_next(&r) % 5];
+        int   ticks = 1 + (int)(rng_next(&r) % 40);
+        bool  down  = rng_next(&r) & 1u;
+        int   row   = down ? 180 : 20;
+        float y     = down ? row - vy * ticks : row + vy * ticks;
+        float x     = (float)(rng_next(&r) % (unsigned)(w - 1) * 1000u) / 1000.0f;
+        float vx    = ((float)(rng_next(&r) % 10001u) - 5000.0f) / 1000.0f;
+
+        game_state_t g = free_field(w, x, y, vx, down ? vy : -vy);
+        physics_intercept_t hit;
+        TEST_ASSERT_TRUE(physics_predict_intercept(&g, row, &hit));
+        TEST_ASSERT_EQUAL_FLOAT((float)ticks, hit.t);
+
+        int bounces = 0;
+        for (int t = 0; t < ticks; ++t) {
+            float before = g.ball.vx;
+            TEST_ASSERT_EQUAL_UINT32(PHYS_EVENT_NONE, physics_update_ball_events(&g));
+            if ((before < 0.0f) != (g.ball.vx < 0.0f))
+                bounces++;
+        }
+        TEST_ASSERT_EQUAL_FLOAT((float)row, g.ball.y);
+        TEST_ASSERT_FLOAT_WITHIN(1e-3f, g.ball.x, hit.x);
+        TEST_ASSERT_EQUAL_INT(bounces, hit.bounces);
+        TEST_ASSERT_TRUE(hit.x >= 0.0f && hit.x <= (float)(w - 1));
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_single_bounce);
+    RUN_TEST(test_moving_away);
+    RUN_TEST(test_matches_brute_force);
+
+    return UNITY_END();
+}
@@ -0,0 +1,432 @@
+/* ------------------------------------------------------------------
+ * test_loop_unity.c - Unity-Tests für die Spielschleife
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "loop.h"
+#include "render.h"
+#include "physics.h"
+#include "config.h"
+
+/* Die Schleife läuft headless (null-Renderer, virtuelle Uhr) */
+
+void setUp(void)
+{
+    TEST_ASSERT_TRUE(render_select("null"));
+    TEST_ASSERT_TRUE(render_init());
+}
+
+void tearDown(void)
+{
+    render_shutdown();
+}
+
+/* Skript für die Eingabe: ab Frame quit_at wird beendet */
+typedef struct
+{
+    int frame;
+    int dx;
+    int quit_at;
+} script_t;
+
+static input_action_t scripted_poll(void *user)
+{
+    script_t *s = user;
+    input_action_t a = { s->dx, 0, s->dx != 0, 0, 0 };
+    s->frame++;
+    if (s->quit_at > 0 && s->frame >= s->quit_at)
+        a.quit = 1;
+    return a;
+}
+
+/* ------------------------------------------------------------------
+ * make_scoring_game
+ * Erstellt einen Spielzustand, in dem der Ball im ersten Physik‑Tick
+ * oben herausfliegt (Punkt für den Spieler).
+ *
+ * Parameter:
+ *   keine
+ *
+ * Rückgabe:
+ *   game_state_t kurz vor dem Punkt
+ * ------------------------------------------------------------------ */
+static game_state_t make_scoring_game(void)
+{
+    game_state_t g = physics_create_game(80, 24);
+    g.bot.x  = 0.0f;          /* Bot weit weg vom Ball              */
+    g.ball.x = 60.0f;
+    g.ball.y = 0.5f;
+    g.ball.vx = 0.0f;
+    g.ball.vy = -1.0f;
+    return g;
+}
+
+/* Erster Tick bei 7 * 16 ms = 112 ms, Countdown endet 1200 ms später */
+#define SCORE_FRAME      7
+#define COUNTDOWN_FRAMES ((COUNTDOWN_STEPS * COUNTDOWN_DELAY_MS) / RENDER_DT_MS)
+
+/* Prüft, dass die Physik während des Countdowns pausiert */
+void test_countdown_pauses_physics(void)
+{
+    game_state_t g = make_scoring_game();
+    loop_config_t cfg = { .headless = true,
+                          .max_frames = SCORE_FRAME + COUNTDOWN_FRAMES - 1 };
+    loop_result_t res;
+
+    loop_run(&g, &cfg, &res);
+
+    TEST_ASSERT_EQUAL_INT(1, g.score);
+    TEST_ASSERT_EQUAL_UINT(1, res.ticks);
+    TEST_ASSERT_EQUAL_INT(LOOP_COUNTDOWN, res.state);
+}
+
+/* Prüft, dass nach dem Countdown kein Nachhol-Burst entsteht */
+void test_no_physics_burst_after_countdown(void)
+{
+    game_state_t g = make_scoring_game();
+    unsigned long frames = 200;
+    loop_config_t cfg = { .headless = true, .max_frames = frames };
+    loop_result_t res;
+
+    loop_run(&g, &cfg, &res);
+
+    unsigned long resume = SCORE_FRAME + COUNTDOWN_FRAMES;
+    unsigned long expect = 1 + ((frames - resume) * RENDER_DT_MS) / (1000 / PHYSICS_HZ_DEFAULT);
+    TEST_ASSERT_EQUAL_INT(LOOP_PLAYING, res.state);
+    TEST_ASSERT_EQUAL_UINT(1, res.max_ticks_per_frame);
+    TEST_ASSERT_EQUAL_UINT(expect, res.ticks);
+}
+
+/* Lässt headless frames Frames der Dauer frame_ms laufen, Ball steht */
+static loop_result_t run_overloaded(unsigned long frame_ms, unsigned long max_ticks,
+                                    loop_catchup_t catchup, unsigned long frames)
+{
+    game_state_t g = physics_create_game(80, 24);
+    g.ball.vx = g.ball.vy = 0.0f;
+    loop_config_t cfg = { .headless = true, .max_frames = frames, .frame_ms = frame_ms,
+                          .max_ticks = max_ticks, .catchup = catchup };
+    loop_result_t res;
+
+    loop_run(&g, &cfg, &res);
+    TEST_ASSERT_EQUAL_INT(LOOP_PLAYING, res.state);
+    return res;
+}
+
+/* Prüft, dass nach einem Hänger höchstens max_ticks Ticks je Frame
+   laufen und der Rest verworfen und gezählt wird */
+void test_catchup_drops_excess_ticks(void)
+{
+    /* 1 s je Frame = 10 fällige Ticks, davon 3 */
+    loop_result_t res = run_overloaded(1000, 3, LOOP_CATCHUP_DROP, 5);
+
+    TEST_ASSERT_EQUAL_UINT(15, res.ticks);
+    TEST_ASSERT_EQUAL_UINT(3, res.max_ticks_per_frame);
+    TEST_ASSERT_EQUAL_UINT(35, res.ticks_dropped);
+    TEST_ASSERT_EQUAL_UINT(0, res.ticks_dilated);
+}
+
+/* Prüft, dass DILATE die Zeit dehnt statt Ticks zu verwerfen: bei 1.5
+   fälligen Ticks je Frame und Grenze 1 läuft je Frame ein Tick, jeder
+   ausgelassene zählt genau einmal */
+void test_catchup_dilate_slows_game_time(void)
+{
+    loop_result_t drop   = run_overloaded(150, 1, LOOP_CATCHUP_DROP, 10);
+    loop_result_t dilate = run_overloaded(150, 1, LOOP_CATCHUP_DILATE, 10);
+
+    TEST_ASSERT_EQUAL_UINT(10, drop.ticks);
+    TEST_ASSERT_EQUAL_UINT(5, drop.ticks_dropped);
+    TEST_ASSERT_EQUAL_UINT(10, dilate.ticks);
+    TEST_ASSERT_EQUAL_UINT(1, dilate.max_ticks_per_frame);
+    TEST_ASSERT_EQUAL_UINT(0, dilate.ticks_dropped);
+    TEST_ASSERT_EQUAL_UINT(5, dilate.ticks_dilated);
+    TEST_ASSERT_EQUAL_UINT(15, dilate.ticks + dilate.ticks_dilated);
+}
+
+/* Prüft, dass der Countdown unter DILATE der gedehnten Spielzeit folgt:
+   bei 1 s je Frame rückt sie nur 200 ms vor (Grenze 2 Ticks), der
+   Countdown (1200 ms) läuft nach 6 Frames noch, mit DROP nach 3 nicht */
+void test_catchup_dilate_stretches_countdown(void)
+{
+    game_state_t g = make_scoring_game();
+    loop_config_t cfg = { .headless = true, .max_frames = 6, .frame_ms = 1000,
+                          .catchup = LOOP_CATCHUP_DILATE };
+    loop_result_t res;
+
+    loop_run(&g, &cfg, &res);
+    TEST_ASSERT_EQUAL_INT(1, g.score);
+    TEST_ASSERT_EQUAL_INT(LOOP_COUNTDOWN, res.state);
+    TEST_ASSERT_EQUAL_UINT(6 * 8, res.ticks_dilated);
+
+    g = make_scoring_game();
+    cfg.max_frames = 3;
+    cfg.catchup    = LOOP_CATCHUP_DROP;
+    loop_run(&g, &cfg, &res);
+    TEST_ASSERT_EQUAL_INT(LOOP_PLAYING, res.state);
+}
+
+/* Prüft, dass die Grenze ohne Vorgabe LOOP_CATCHUP_MS entspricht */
+void test_catchup_default_limit(void)
+{
+    loop_result_t res = run_overloaded(1000, 0, LOOP_CATCHUP_DROP, 1);
+
+    TEST_ASSERT_EQUAL_UINT(LOOP_CATCHUP_MS * PHYSICS_HZ_DEFAULT / 1000, res.ticks);
+}
+
+/* Virtuelle Uhr fürs Pacing: Schlafen springt ans Ziel, jedes Ablesen
+   kostet read_ns (damit aktives Warten endet), die Eingabe täuscht je
+   Frame work_ms Millisekunden Arbeit vor, im ersten zusätzlich einen
+   Hänger von stall_ms */
+typedef struct
+{
+    uint64_t      t;
+    uint64_t      read_ns;
+    unsigned long work_ms;
+    unsigned long sleeps;
+    unsigned long stall_ms;
+} vclock_t;
+
+static uint64_t vclock_now(void *user)
+{
+    vclock_t *c = user;
+    c->t += c->read_ns;
+    return c->t;
+}
+
+static void vclock_sleep(void *user, uint64_t ns)
+{
+    vclock_t *c = user;
+    c->sleeps++;
+    if (ns > c->t)
+        c->t = ns;
+}
+
+static input_action_t vclock_work(void *user)
+{
+    vclock_t *c = user;
+    c->t += (c->work_ms + c->stall_ms) * 1000000u;
+    c->stall_ms = 0;
+    return (input_action_t){ 0, 0, 0, 0, 0 };
+}
+
+/* Lässt frames Frames mit Terminal-Pacing auf der virtuellen Uhr laufen
+   (Ball steht); elapsed_ns ist die vergangene virtuelle Zeit */
+static loop_result_t run_paced(vclock_t *c, unsigned long spin_us, loop_catchup_t catchup,
+                               unsigned long frames, uint64_t *elapsed_ns)
+{
+    game_state_t g = physics_create_game(80, 24);
+    g.ball.vx = g.ball.vy = 0.0f;
+    loop_clock_t  clock = { vclock_now, vclock_sleep, c };
+    loop_config_t cfg = { .headless = false, .max_frames = frames, .spin_us = spin_us,
+                          .catchup = catchup, .poll = vclock_work, .user = c, .clock = &clock };
+    loop_result_t res;
+
+    uint64_t t0 = c->t;
+    loop_run(&g, &cfg, &res);
+    *elapsed_ns = c->t - t0;
+    return res;
+}
+
+/* Prüft, dass die Arbeit eines Frames in seine Periode fällt statt
+   hinzuzukommen: 10 Frames mit je 8 ms Arbeit dauern genau 160 ms,
+   nicht 10 · (16 + 8) ms */
+void test_pacing_absorbs_frame_work(void)
+{
+    vclock_t c = { 1000000000u, 0, 8, 0, 0 };
+    uint64_t elapsed;
+    loop_result_t res = run_paced(&c, 0, LOOP_CATCHUP_DROP, 10, &elapsed);
+
+    TEST_ASSERT_EQUAL_UINT64(10u * RENDER_DT_MS * 1000000u, elapsed);
+    TEST_ASSERT_EQUAL_UINT(10, c.sleeps);
+    TEST_ASSERT_EQUAL_UINT(0, res.deadline_misses);
+}
+
+/* Prüft, dass mit --spin nur bis spin_us vor der Deadline geschlafen
+   und der Rest aktiv gewartet wird – genau bis zur Deadline */
+void test_pacing_spins_before_deadline(void)
+{
+    vclock_t c = { 1000000000u, 1000u, 8, 0, 0 };
+    uint64_t elapsed;
+    loop_result_t res = run_paced(&c, LOOP_SPIN_MAX_US, LOOP_CATCHUP_DROP, 10, &elapsed);
+
+    /* das Raster beginnt beim ersten Ablesen, ein read_ns nach t0 */
+    TEST_ASSERT_EQUAL_UINT64(10u * RENDER_DT_MS * 1000000u + c.read_ns, elapsed);
+    TEST_ASSERT_EQUAL_UINT(10, c.sleeps);
+    TEST_ASSERT_EQUAL_UINT(0, res.deadline_misses);
+}
+
+/* Prüft, dass zu lange Frames als verpasste Deadline gezählt werden
+   und die Schleife dann ohne Schlaf weiterläuft */
+void test_pacing_counts_deadline_misses(void)
+{
+    vclock_t c = { 1000000000u, 0, RENDER_DT_MS + 4, 0, 0 };
+    uint64_t elapsed;
+    loop_result_t res = run_paced(&c, 0, LOOP_CATCHUP_DROP, 5, &elapsed);
+
+    TEST_ASSERT_EQUAL_UINT(5, res.deadline_misses);
+    TEST_ASSERT_EQUAL_UINT(5, res.frames);
+    TEST_ASSERT_EQUAL_UINT(0, c.sleeps);
+    TEST_ASSERT_EQUAL_UINT64(5u * (RENDER_DT_MS + 4) * 1000000u, elapsed);
+}
+
+/* Prüft, dass DILATE nach einem Hänger nicht vorspult: die folgenden
+   Frames laufen im normalen Takt wie mit DROP, nur die Zählung der
+   8 ausgelassenen Ticks (1 s Hänger, Grenze 2) unterscheidet sich */
+void test_catchup_dilate_no_fast_forward_after_stall(void)
+{
+    vclock_t c1 = { 1000000000u, 0, 0, 0, 1000 };
+    vclock_t c2 = c1;
+    uint64_t elapsed;
+    loop_result_t drop   = run_paced(&c1, 0, LOOP_CATCHUP_DROP, 10, &elapsed);
+    loop_result_t dilate = run_paced(&c2, 0, LOOP_CATCHUP_DILATE, 10, &elapsed);
+
+    TEST_ASSERT_EQUAL_UINT(8, drop.ticks_dropped);
+    TEST_ASSERT_EQUAL_UINT(8, dilate.ticks_dilated);
+    TEST_ASSERT_EQUAL_UINT(0, dilate.ticks_dropped);
+    TEST_ASSERT_EQUAL_UINT(2, dilate.max_ticks_per_frame);
+    TEST_ASSERT_EQUAL_UINT(drop.ticks, dilate.ticks);
+}
+
+/* Prüft, dass Eingabe und Quit während des Countdowns wirken */
+void test_input_live_during_countdown(void)
+{
+    game_state_t g = make_scoring_game();
+    script_t s = { 0, +1, SCORE_FRAME + 20 };
+    loop_config_t cfg = { .headless = true, .poll = scripted_poll, .user = &s };
+    loop_result_t res;
+
+    g.player.x = 0.0f;
+    loop_run(&g, &cfg, &res);
+
+    TEST_ASSERT_TRUE(res.quit);
+    TEST_ASSERT_EQUAL_UINT(SCORE_FRAME + 19, res.frames);
+    TEST_ASSERT_EQUAL_INT(LOOP_COUNTDOWN, res.state);
+    TEST_ASSERT_TRUE(g.player.x > 0.0f);
+}
+
+/* Prüft, dass Game Over headless die Schleife beendet */
+void test_game_over_ends_headless_loop(void)
+{
+    game_state_t g = physics_create_game(80, 24);
+    g.player.x = 0.0f;
+    g.ball.x   = 60.0f;
+    g.ball.y   = 23.5f;
+    g.ball.vx  = 0.0f;
+    g.ball.vy  = 1.0f;
+    loop_config_t cfg = { .headless = true };
+    loop_result_t res;
+
+    loop_run(&g, &cfg, &res);
+
+    TEST_ASSERT_EQUAL_INT(LOOP_GAME_OVER, res.state);
+    TEST_ASSERT_FALSE(res.quit);
+    TEST_ASSERT_EQUAL_UINT(SCORE_FRAME, res.frames);
+}
+
+/* Spieler folgt dem Ball; Ende, sobald die Aufzeichnung ticks Ticks hat */
+typedef struct
+{
+    const game_state_t *game;
+    const replay_rec_t *rec;
+    uint64_t            ticks;
+} follow_script_t;
+
+static input_action_t follow_poll(void *user)
+{
+    follow_script_t *s = user;
+    float mid = s->game->player.x + s->game->player.width / 2.0f;
+    input_action_t a = { 0, 0, 0, 0, 0 };
+
+    if (s->game->ball.x > mid + 0.5f)      a.dx = +1;
+    else if (s->game->ball.x < mid - 0.5f) a.dx = -1;
+    a.key  = a.dx != 0;
+    a.quit = s->rec->ticks >= s->ticks;
+    return a;
+}
+
+#define FPS_FILE  "build/test_loop_fps.rpl"
+#define FPS_TICKS 600
+
+/* ------------------------------------------------------------------
+ * run_at_frame_rate
+ * Spielt FPS_TICKS Ticks headless mit der angegebenen Frame-Dauer,
+ * zeichnet dabei alle Befehle auf und lädt die Aufzeichnung.
+ *
+ * Parameter:
+ *   frame_ms – virtuelle Frame-Dauer
+ *   buf, cap – Puffer für die Aufzeichnung
+ *   len      – Ausgabe: Länge der Aufzeichnung
+ *
+ * Rückgabe:
+ *   Endzustand
+ * ------------------------------------------------------------------ */
+static game_state_t run_at_frame_rate(unsigned long frame_ms,
+                                      unsigned char *buf, size_t cap, size_t *len)
+{
+    replay_info_t info = { 80, 24, 21u, 0u, 0, 0, 0, PHYSICS_HZ_DEFAULT };
+    replay_rec_t  rec;
+    TEST_ASSERT_TRUE(replay_rec_open(&rec, FPS_FILE, &info));
+
+    game_state_t    g = physics_create_game_seeded(80, 24, info.seed, info.stream);
+    follow_script_t s = { &g, &rec, FPS_TICKS };
+    loop_config_t cfg = { .headless = true, .frame_ms = frame_ms,
+                          .poll = follow_poll, .user = &s, .record = &rec };
+    loop_result_t res;
+
+    loop_run(&g, &cfg, &res);
+    TEST_ASSERT_TRUE(res.quit);
+    TEST_ASSERT_EQUAL_UINT(FPS_TICKS, res.ticks);
+    TEST_ASSERT_TRUE(replay_rec_close(&rec, &g));
+
+    FILE *f = fopen(FPS_FILE, "rb");
+    TEST_ASSERT_NOT_NULL(f);
+    *len = fread(buf, 1, cap, f);
+    fclose(f);
+    remove(FPS_FILE);
+    return g;
+}
+
+/* Gleiche Tick-Befehle und gleicher Endzustand bei ~30, ~60 und
+   ~144 FPS (ganze Millisekunden: 33, 16, 7 ms) – auch über Punkte
+   und Countdowns hinweg */
+void test_outcome_independent_of_frame_rate(void)
+{
+    static const unsigned long frame_ms[] = { 33, 16, 7 };
+    static unsigned char ref[1 << 16], cur[1 << 16];
+    size_t ref_len, cur_len;
+
+    game_state_t a = run_at_frame_rate(frame_ms[0], ref, sizeof ref, &ref_len);
+    TEST_ASSERT_TRUE(a.score > 0);
+
+    for (int i = 1; i < 3; ++i) {
+        game_state_t b = run_at_frame_rate(frame_ms[i], cur, sizeof cur, &cur_len);
+        TEST_ASSERT_EQUAL_UINT64(physics_state_hash(&a), physics_state_hash(&b));
+        TEST_ASSERT_EQUAL_INT(a.score, b.score);
+        TEST_ASSERT_EQUAL_size_t(ref_len, cur_len);
+        TEST_ASSERT_EQUAL_MEMORY(ref, cur, ref_len);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_countdown_pauses_physics);
+    RUN_TEST(test_no_physics_burst_after_countdown);
+    RUN_TEST(test_catchup_drops_excess_ticks);
+    RUN_TEST(test_catchup_dilate_slows_game_time);
+    RUN_TEST(test_catchup_dilate_stretches_countdown);
+    RUN_TEST(test_catchup_default_limit);
+    RUN_TEST(test_pacing_absorbs_frame_work);
+    RUN_TEST(test_pacing_spins_before_deadline);
+    RUN_TEST(test_pacing_counts_deadline_misses);
+    RUN_TEST(test_catchup_dilate_no_fast_forward_after_stall);
+    RUN_TEST(test_input_live_during_countdown);
+    RUN_TEST(test_game_over_ends_headless_loop);
+    RUN_TEST(test_outcome_independent_of_frame_rate);
+
+    return UNITY_END();
+}
@@ -26,9 +26,9 @@ void test_physics_ball_creation(void)
     TEST_ASSERT_EQUAL_FLOAT(40.0f, game.ball.x);
     TEST_ASSERT_EQUAL_FLOAT(12.0f, game.ball.y);
 
-    /* Startgeschwindigkeit des Balls prüfen */
-    TEST_ASSERT_EQUAL_FLOAT(BALL_INITIAL_SPEED, game.ball.vx);
-    TEST_ASSERT_EQUAL_FLOAT(-BALL_INITIAL_SPEED, game.ball.vy);
+    /* Startgeschwindigkeit des Balls prüfen (Zellen je Tick, 10 Hz) */
+    TEST_ASSERT_EQUAL_FLOAT(BALL_INITIAL_SPEED / 10.0f, game.ball.vx);
+    TEST_ASSERT_EQUAL_FLOAT(-BALL_INITIAL_SPEED / 10.0f, game.ball.vy);
 }
 
 /* Prüft Initialisierung der Paddles */
@@ -55,11 +55,12 @@ void test_physics_paddle_movement(void)
     /* Ein Update mit Rechts-Input */
     physics_player_update(&game, 1);
 
-    /* Geschwindigkeitszuwachs = PLAYER_ACCELERATION */
-    TEST_ASSERT_FLOAT_WITHIN(1e-6, PLAYER_ACCELERATION, game.player.vx);
+    /* Geschwindigkeitszuwachs = PLAYER_ACCELERATION · dt² (10 Hz) */
+    float a = PLAYER_ACCELERATION / 100.0f;
+    TEST_ASSERT_FLOAT_WITHIN(1e-6, a, game.player.vx);
 
-    /* Position erhöht sich um vx (== PLAYER_ACCELERATION) */
-    TEST_ASSERT_FLOAT_WITHIN(1e-6, initial_x + PLAYER_ACCELERATION, game.player.x);
+    /* Position erhöht sich um vx (== a) */
+    TEST_ASSERT_FLOAT_WITHIN(1e-6, initial_x + a, game.player.x);
 }
 
 /* Prüft Behandlung der Spielfeld-Randbedingungen */
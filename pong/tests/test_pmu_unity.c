@@ -0,0 +1,142 @@
+/* ------------------------------------------------------------------
+ * test_pmu_unity.c - Unity-Tests für die Zähler-Regionen
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "pmu.h"
+#include "loop.h"
+#include "render.h"
+#include "physics.h"
+
+#define WORK_ITERS 100000
+
+void setUp(void)    {}
+void tearDown(void) { pmu_close(); }
+
+/* Rechenarbeit, die der Compiler nicht wegoptimieren darf */
+static volatile unsigned sink;
+static void work(void)
+{
+    unsigned x = 1;
+    for (int i = 0; i < WORK_ITERS; ++i)
+        x = x * 1664525u + 1013904223u;
+    sink = x;
+}
+
+/* Nur Wanduhr: Aufrufe und Zeit, Zählerspalten bleiben leer */
+void test_wall_time_fallback(void)
+{
+    TEST_ASSERT_FALSE(pmu_init(false));
+    TEST_ASSERT_TRUE(pmu_enabled());
+    for (int i = 0; i < 10; ++i) {
+        pmu_begin(PMU_USER0);
+        work();
+        pmu_end(PMU_USER0);
+    }
+
+    pmu_totals_t t;
+    pmu_get(PMU_USER0, &t);
+    TEST_ASSERT_EQUAL_UINT64(10, t.calls);
+    TEST_ASSERT_TRUE(t.ns > 0);
+    TEST_ASSERT_EQUAL_UINT64(0, t.cycles);
+
+    char  out[1024] = "";
+    FILE *f = fmemopen(out, sizeof out - 1, "w");
+    TEST_ASSERT_NOT_NULL(f);
+    pmu_report(f);
+    fclose(f);
+    TEST_ASSERT_NOT_NULL(strstr(out, "wall time only"));
+    TEST_ASSERT_NOT_NULL(strstr(out, "user0"));
+    TEST_ASSERT_NULL(strstr(out, "physics"));        /* ohne Aufrufe */
+}
+
+/* Mit Zählern (falls der Kernel sie erlaubt) mindestens eine
+   Instruktion je Schleifendurchlauf, sonst dieselbe Rückfallebene */
+void test_hardware_counters_or_fallback(void)
+{
+    bool hw = pmu_init(true);
+    TEST_ASSERT_EQUAL(hw, pmu_hw_available());
+    pmu_begin(PMU_USER0);
+    work();
+    pmu_end(PMU_USER0);
+
+    pmu_totals_t t;
+    pmu_get(PMU_USER0, &t);
+    TEST_ASSERT_EQUAL_UINT64(1, t.calls);
+    TEST_ASSERT_TRUE(t.ns > 0);
+    if (hw) {
+        TEST_ASSERT_TRUE(t.cycles > 0);
+        TEST_ASSERT_TRUE(t.instructions >= WORK_ITERS);
+    } else {
+        TEST_ASSERT_EQUAL_UINT64(0, t.instructions);
+    }
+}
+
+/* Verschachtelte Plätze messen unabhängig voneinander */
+void test_nested_regions(void)
+{
+    pmu_init(false);
+    pmu_begin(PMU_USER0);
+    work();
+    pmu_begin(PMU_USER1);
+    work();
+    pmu_end(PMU_USER1);
+    pmu_end(PMU_USER0);
+
+    pmu_totals_t outer, inner;
+    pmu_get(PMU_USER0, &outer);
+    pmu_get(PMU_USER1, &inner);
+    TEST_ASSERT_EQUAL_UINT64(1, inner.calls);
+    TEST_ASSERT_TRUE(outer.ns > inner.ns);
+}
+
+/* Ohne pmu_init bzw. nach pmu_close wird nichts gezählt */
+void test_disabled_is_noop(void)
+{
+    pmu_init(false);
+    pmu_close();
+    pmu_begin(PMU_USER0);
+    pmu_end(PMU_USER0);
+
+    pmu_totals_t t;
+    pmu_get(PMU_USER0, &t);
+    TEST_ASSERT_EQUAL_UINT64(0, t.calls);
+}
+
+/* Die Schleife misst KI und Physik je Tick, Rendern je Frame */
+void test_loop_regions(void)
+{
+    TEST_ASSERT_TRUE(render_select("null"));
+    TEST_ASSERT_TRUE(render_init());
+
+    game_state_t  g   = physics_create_game_seeded(80, 24, 5u, 0u);
+    loop_config_t cfg = { .headless = true, .max_frames = 500 };
+    loop_result_t res;
+
+    pmu_init(true);
+    loop_run(&g, &cfg, &res);
+    render_shutdown();
+
+    pmu_totals_t ai, phys, render;
+    pmu_get(PMU_AI, &ai);
+    pmu_get(PMU_PHYSICS, &phys);
+    pmu_get(PMU_RENDER, &render);
+    TEST_ASSERT_EQUAL_UINT64(res.ticks, ai.calls);
+    TEST_ASSERT_EQUAL_UINT64(res.ticks, phys.calls);
+    TEST_ASSERT_EQUAL_UINT64(res.frames, render.calls);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_wall_time_fallback);
+    RUN_TEST(test_hardware_counters_or_fallback);
+    RUN_TEST(test_nested_regions);
+    RUN_TEST(test_disabled_is_noop);
+    RUN_TEST(test_loop_regions);
+    return UNITY_END();
+}
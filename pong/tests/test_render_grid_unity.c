@@ -0,0 +1,155 @@
+/* ------------------------------------------------------------------
+ * test_render_grid_unity.c - Unity-Tests für die Render-Backends
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#include <string.h>
+#include "unity.h"
+#include "config.h"
+#include "render.h"
+#include "render_grid.h"
+#include "physics.h"
+
+/* Diese Tests zeichnen ohne Terminal in das In-Memory-Raster */
+
+void setUp(void)
+{
+    TEST_ASSERT_TRUE(render_select("grid"));
+    render_grid_set_size(80, 24);
+    TEST_ASSERT_TRUE(render_init());
+}
+
+void tearDown(void)
+{
+    render_shutdown();
+}
+
+/* ------------------------------------------------------------------
+ * cell_at
+ * Liefert die Zelle an Position (y, x) des zuletzt gezeichneten
+ * Frames.
+ *
+ * Parameter:
+ *   y, x – Position
+ *
+ * Rückgabe:
+ *   Zelle an dieser Position
+ * ------------------------------------------------------------------ */
+static cell_t cell_at(int y, int x)
+{
+    int cols, rows;
+    const cell_t *cells = render_grid_cells(&cols, &rows);
+    return cells[y * cols + x];
+}
+
+/* Prüft, dass Ball, Paddles und Rahmen an der richtigen Stelle liegen */
+void test_grid_frame_layout(void)
+{
+    game_state_t g = physics_create_game(80, 24);
+    g.ball.x = 10.5f;
+    g.ball.y = 7.2f;
+
+    render_frame(&g, PHYS_EVENT_NONE);
+
+    TEST_ASSERT_EQUAL_UINT8(GLYPH_DIAMOND,  cell_at(7, 10).glyph);
+    TEST_ASSERT_EQUAL_UINT8(GLYPH_BLOCK,    cell_at(g.player.y, (int)g.player.x).glyph);
+    TEST_ASSERT_EQUAL_UINT8(GLYPH_BLOCK,    cell_at(g.bot.y, (int)g.bot.x).glyph);
+    TEST_ASSERT_EQUAL_UINT8(GLYPH_LLCORNER, cell_at(g.player.y + 1, 0).glyph);
+    TEST_ASSERT_EQUAL_UINT8(GLYPH_VLINE,    cell_at(5, 79).glyph);
+    TEST_ASSERT_EQUAL_UINT8('S',            cell_at(0, 2).glyph);
+    TEST_ASSERT_EQUAL_UINT(1, render_grid_frames());
+}
+
+/* Prüft, dass ein Treffer das Paddle invertiert und der Flash abklingt */
+void test_grid_flash_on_hit(void)
+{
+    game_state_t g = physics_create_game(80, 24);
+    int px = (int)g.player.x;
+
+    render_frame(&g, PHYS_EVENT_HIT_PLAYER);
+    TEST_ASSERT_TRUE(cell_at(g.player.y, px).attr & CELL_REVERSE);
+
+    for (int i = 0; i < FLASH_FRAMES; ++i)
+        render_frame(&g, PHYS_EVENT_NONE);
+    TEST_ASSERT_FALSE(cell_at(g.player.y, px).attr & CELL_REVERSE);
+}
+
+/* Prüft, dass das Zwischenbild Ball und Paddles nach alpha zwischen
+   zwei Ticks platziert und alpha auf 0 … 1 begrenzt */
+void test_grid_lerp_between_ticks(void)
+{
+    game_state_t cur = physics_create_game(80, 24);
+    cur.ball.x   = 10.0f;  cur.ball.y = 4.0f;
+    cur.player.x = 30.0f;
+    render_pose_t prev = render_pose_of(&cur);
+    cur.ball.x   = 20.0f;  cur.ball.y = 8.0f;
+    cur.player.x = 40.0f;
+
+    render_frame_lerp(&prev, &cur, 0.5f, PHYS_EVENT_NONE);
+    TEST_ASSERT_EQUAL_UINT8(GLYPH_DIAMOND, cell_at(6, 15).glyph);
+    TEST_ASSERT_EQUAL_UINT8(GLYPH_BLOCK,   cell_at(cur.player.y, 35).glyph);
+    TEST_ASSERT_NOT_EQUAL(GLYPH_BLOCK,     cell_at(cur.player.y, 34).glyph);
+
+    render_frame_lerp(&prev, &cur, 2.0f, PHYS_EVENT_NONE);
+    TEST_ASSERT_EQUAL_UINT8(GLYPH_DIAMOND, cell_at(8, 20).glyph);
+
+    render_frame_lerp(&prev, &cur, 0.0f, PHYS_EVENT_NONE);
+    TEST_ASSERT_EQUAL_UINT8(GLYPH_DIAMOND, cell_at(4, 10).glyph);
+    TEST_ASSERT_EQUAL_UINT8(GLYPH_BLOCK,   cell_at(cur.player.y, 30).glyph);
+}
+
+/* Prüft, dass Headless-Backends ohne Terminal auskommen */
+void test_headless_backends(void)
+{
+    TEST_ASSERT_TRUE(render_is_headless());
+    TEST_ASSERT_EQUAL_INT(INPUT_SRC_NONE, render_input_source());
+
+    TEST_ASSERT_TRUE(render_select("null"));
+    TEST_ASSERT_TRUE(render_is_headless());
+    TEST_ASSERT_FALSE(render_select("does-not-exist"));
+    TEST_ASSERT_EQUAL_STRING("null", render_backend_name());
+    TEST_ASSERT_TRUE(render_select("grid"));
+}
+
+/* Prüft, dass das Leistungs-Overlay in der unteren Kante erscheint
+   und beim Ausblenden der Rahmen zurückkommt */
+void test_grid_perf_overlay(void)
+{
+    game_state_t g = physics_create_game(80, 24);
+    int bottom = g.player.y + 1;
+
+    TEST_ASSERT_FALSE(render_perf_shown());
+    render_perf_toggle();
+    TEST_ASSERT_TRUE(render_perf_shown());
+    for (int i = 0; i < PERF_TEXT_FRAMES + 1; ++i) {
+        render_perf_ticks(1);
+        render_frame(&g, PHYS_EVENT_NONE);
+    }
+
+    int cols, rows;
+    const cell_t *cells = render_grid_cells(&cols, &rows);
+    char line[81];
+    for (int x = 0; x < cols; ++x)
+        line[x] = (char)cells[bottom * cols + x].glyph;
+    line[cols] = '\0';
+    TEST_ASSERT_NOT_NULL(strstr(line, " fps  1.00 t/f  frame "));
+    TEST_ASSERT_EQUAL_UINT8(GLYPH_LRCORNER, cell_at(bottom, 79).glyph);
+
+    render_perf_toggle();
+    render_frame(&g, PHYS_EVENT_NONE);
+    TEST_ASSERT_EQUAL_UINT8(GLYPH_HLINE, cell_at(bottom, 2).glyph);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_grid_frame_layout);
+    RUN_TEST(test_grid_flash_on_hit);
+    RUN_TEST(test_grid_lerp_between_ticks);
+    RUN_TEST(test_headless_backends);
+    RUN_TEST(test_grid_perf_overlay);
+
+    return UNITY_END();
+}
@@ -0,0 +1,470 @@
+/* ------------------------------------------------------------------
+ * test_replay_unity.c - Unity-Tests für Aufzeichnung und Wiedergabe
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#include <stdio.h>
+#include "unity.h"
+#include "replay.h"
+#include "loop.h"
+#include "render.h"
+#include "ai.h"
+
+#define REPLAY_FILE "build/test_replay.rpl"
+
+void setUp(void)
+{
+    TEST_ASSERT_TRUE(render_select("null"));
+    TEST_ASSERT_TRUE(render_init());
+}
+
+void tearDown(void)
+{
+    render_shutdown();
+    remove(REPLAY_FILE);
+    physics_set_tick_rate(PHYSICS_HZ_DEFAULT);
+    physics_set_numeric(PHYS_NUMERIC_FLOAT);
+    ai_config_t ai;
+    ai_config_defaults(&ai);
+    ai_configure(&ai);
+}
+
+/* Eingabe: Spieler folgt dem Ball mit etwas Verzögerung */
+typedef struct
+{
+    const game_state_t *game;
+    int frame;
+} follow_t;
+
+static input_action_t follow_poll(void *user)
+{
+    follow_t *f = user;
+    float mid = f->game->player.x + f->game->player.width / 2.0f;
+    int dx = 0;
+    if ((f->frame++ / 3) % 2 == 0)          /* jede zweite Dreiergruppe still */
+        dx = f->game->ball.x > mid + 1.0f ? 1 : f->game->ball.x < mid - 1.0f ? -1 : 0;
+    input_action_t a = { dx, 0, dx != 0, 0, 0 };
+    return a;
+}
+
+static replay_info_t make_info(uint64_t seed)
+{
+    ai_config_t ai;
+    ai_get_config(&ai);
+    replay_info_t info = { 80, 24, seed, 3u,
+                           (uint8_t)physics_get_solver(),
+                           (uint8_t)physics_get_numeric(),
+                           (uint8_t)ai.mode,
+                           (uint16_t)physics_tick_rate() };
+    return info;
+}
+
+/* ------------------------------------------------------------------
+ * record_session
+ * Spielt eine Partie headless durch die Spielschleife und zeichnet
+ * sie auf.
+ *
+ * Parameter:
+ *   frames – Anzahl Frames
+ *   end    – Ausgabe: Endzustand
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void record_session(unsigned long frames, game_state_t *end)
+{
+    replay_info_t info = make_info(0xC0FFEEu);
+    replay_rec_t  rec;
+    TEST_ASSERT_TRUE(replay_rec_open(&rec, REPLAY_FILE, &info));
+
+    *end = physics_create_game_seeded(info.width, info.height, info.seed, info.stream);
+    follow_t f = { end, 0 };
+    loop_config_t cfg = { .headless = true, .max_frames = frames,
+                          .poll = follow_poll, .user = &f, .record = &rec };
+    loop_result_t res;
+    loop_run(end, &cfg, &res);
+
+    TEST_ASSERT_EQUAL_UINT64(res.ticks, rec.ticks);
+    TEST_ASSERT_TRUE(replay_rec_close(&rec, end));
+}
+
+/* Varints: Grenzen der 7-Bit-Gruppen und Maximalwert */
+void test_varint_roundtrip(void)
+{
+    const uint64_t values[] = { 0, 1, 127, 128, 16383, 16384,
+                                0xFFFFFFFFull, UINT64_MAX };
+    for (size_t i = 0; i < sizeof values / sizeof values[0]; ++i) {
+        uint8_t  buf[10];
+        uint64_t v;
+        size_t   n = replay_put_varint(buf, values[i]);
+        TEST_ASSERT_EQUAL_size_t(n, replay_get_varint(buf, n, &v));
+        TEST_ASSERT_EQUAL_UINT64(values[i], v);
+        TEST_ASSERT_EQUAL_size_t(0, replay_get_varint(buf, n - 1, &v));
+    }
+}
+
+/* Aufgezeichnete Partie (mit Punkten) wird bitgleich nachgespielt */
+void test_replay_reproduces_session(void)
+{
+    game_state_t end;
+    record_session(6000, &end);
+    TEST_ASSERT_TRUE(end.score > 0);
+
+    replay_result_t rr;
+    TEST_ASSERT_TRUE(replay_run(REPLAY_FILE, &rr));
+    TEST_ASSERT_TRUE(rr.match);
+    TEST_ASSERT_EQUAL_INT(end.score, rr.score);
+    TEST_ASSERT_EQUAL_UINT64(physics_state_hash(&end), rr.hash);
+}
+
+/* Modi und Tickrate aus dem Kopf werden beim Abspielen übernommen */
+void test_replay_restores_modes(void)
+{
+    physics_set_numeric(PHYS_NUMERIC_FIXED);
+    TEST_ASSERT_TRUE(physics_set_tick_rate(60));
+    ai_config_t ai;
+    ai_config_defaults(&ai);
+    ai.mode = AI_MODE_PREDICT;
+    ai_configure(&ai);
+
+    game_state_t end;
+    record_session(3000, &end);
+
+    /* Abspielen setzt die Modi selbst */
+    physics_set_numeric(PHYS_NUMERIC_FLOAT);
+    physics_set_tick_rate(PHYSICS_HZ_DEFAULT);
+    ai_config_defaults(&ai);
+    ai_configure(&ai);
+
+    replay_result_t rr;
+    TEST_ASSERT_TRUE(replay_run(REPLAY_FILE, &rr));
+    TEST_ASSERT_TRUE(rr.match);
+    TEST_ASSERT_EQUAL_UINT8(PHYS_NUMERIC_FIXED, rr.info.numeric);
+    TEST_ASSERT_EQUAL_UINT8(AI_MODE_PREDICT, rr.info.ai_mode);
+    TEST_ASSERT_EQUAL_UINT16(60, rr.info.tick_hz);
+    TEST_ASSERT_EQUAL_UINT(60, physics_tick_rate());
+}
+
+/* Eine veränderte Eingabe fällt beim Vergleich auf */
+void test_tampered_log_is_detected(void)
+{
+    game_state_t end;
+    record_session(3000, &end);
+
+    FILE *f = fopen(REPLAY_FILE, "r+b");
+    TEST_ASSERT_NOT_NULL(f);
+    TEST_ASSERT_EQUAL_INT(0, fseek(f, 40, SEEK_SET));  /* erste Befehle nach dem Kopf */
+    int c = fgetc(f);
+    TEST_ASSERT_EQUAL_INT(0, fseek(f, 40, SEEK_SET));
+    fputc(c ^ 0x01, f);                               /* Eingabecode +1 ↔ 0 / -1 ↔ keine */
+    fclose(f);
+
+    replay_result_t rr;
+    replay_run(REPLAY_FILE, &rr);
+    TEST_ASSERT_FALSE(rr.match);
+}
+
+/* Dateigröße in Bytes */
+static long file_size(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    TEST_ASSERT_NOT_NULL(f);
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fclose(f);
+    return size;
+}
+
+/* Platz für Keyframes: Markierung, Snapshot und Indexeintrag */
+#define KEYFRAME_BYTES(rec) ((long)(rec).keyframes * (long)(1 + sizeof(physics_snapshot_t) + 16))
+
+/* Eine Stunde ohne Tastendruck, 60 Frames und 10 Ticks pro Sekunde:
+   pro Tick zwei Läufe, also Kilobytes statt Megabytes */
+void test_idle_hour_stays_small(void)
+{
+    replay_info_t info = make_info(1u);
+    replay_rec_t  rec;
+    game_state_t  g = physics_create_game_seeded(80, 24, 1u, 3u);
+    TEST_ASSERT_TRUE(replay_rec_open(&rec, REPLAY_FILE, &info));
+
+    unsigned long acc = 0;
+    for (unsigned long frame = 0; frame < 3600ul * 1000 / RENDER_DT_MS; ++frame) {
+        replay_rec_input(&rec, 0);
+        for (acc += RENDER_DT_MS * PHYSICS_HZ_DEFAULT; acc >= 1000; acc -= 1000)
+            replay_rec_tick(&rec, &g);
+    }
+    size_t keyframes = rec.keyframes;
+    TEST_ASSERT_TRUE(replay_rec_close(&rec, &g));
+
+    TEST_ASSERT_EQUAL_UINT64(36000u, rec.ticks);
+    TEST_ASSERT_EQUAL_size_t(36000u / REPLAY_KEYFRAME_TICKS, keyframes);
+    TEST_ASSERT_TRUE(file_size(REPLAY_FILE) - KEYFRAME_BYTES(rec) < 80 * 1024);
+}
+
+/* Gehaltene Taste mit einer Eingabe pro Tick: ein Lauf je Keyframe-Abschnitt */
+void test_held_input_per_tick_is_one_run(void)
+{
+    replay_info_t info = make_info(1u);
+    replay_rec_t  rec;
+    game_state_t  g = physics_create_game_seeded(80, 24, 1u, 3u);
+    TEST_ASSERT_TRUE(replay_rec_open(&rec, REPLAY_FILE, &info));
+    for (int t = 0; t < 36000; ++t) {
+        replay_rec_input(&rec, 1);
+        replay_rec_tick(&rec, &g);
+    }
+    TEST_ASSERT_TRUE(replay_rec_close(&rec, &g));
+
+    long commands = file_size(REPLAY_FILE) - KEYFRAME_BYTES(rec);
+    TEST_ASSERT_TRUE(commands < 128 + (long)rec.keyframes * 4);
+}
+
+/* ------------------------------------------------------------------
+ * record_bot_game
+ * Zeichnet `ticks` Ticks auf, in denen ein Skript-Spieler dem Ball
+ * folgt (eine Eingabe pro Tick, das Spiel läuft über Game Over
+ * hinaus weiter).
+ *
+ * Parameter:
+ *   ticks    – Anzahl Ticks
+ *   keyframe – Keyframe-Abstand
+ *
+ * Rückgabe:
+ *   keine
+ * ------------------------------------------------------------------ */
+static void record_bot_game_kf(int ticks, uint64_t keyframe)
+{
+    replay_info_t info = make_info(77u);
+    replay_rec_t  rec;
+    TEST_ASSERT_TRUE(replay_rec_open(&rec, REPLAY_FILE, &info));
+    rec.keyframe_ticks = keyframe;
+
+    game_state_t g = physics_create_game_seeded(info.width, info.height, info.seed, info.stream);
+    follow_t f = { &g, 0 };
+    for (int t = 0; t < ticks; ++t) {
+        int dx = follow_poll(&f).dx;
+        physics_player_update(&g, dx);
+        replay_rec_input(&rec, dx);
+        ai_update(&g);
+        physics_update_ball_events(&g);
+        replay_rec_tick(&rec, &g);
+    }
+    TEST_ASSERT_TRUE(replay_rec_close(&rec, &g));
+}
+
+static void record_bot_game(int ticks)
+{
+    record_bot_game_kf(ticks, REPLAY_KEYFRAME_TICKS);
+}
+
+#define SEEK_TICKS 3000
+
+/* Springen (vor und zurück) liefert denselben Zustand wie lineares
+   Abspielen und simuliert höchstens K Ticks nach */
+void test_seek_matches_linear_playback(void)
+{
+    static uint64_t hash[SEEK_TICKS + 1];
+    record_bot_game(SEEK_TICKS);
+
+    replay_view_t view;
+    TEST_ASSERT_TRUE(replay_view_open(&view, REPLAY_FILE));
+    TEST_ASSERT_EQUAL_UINT32(SEEK_TICKS / REPLAY_KEYFRAME_TICKS, view.keyframes);
+    hash[0] = physics_state_hash(&view.game);
+    for (int t = 1; t <= SEEK_TICKS; ++t) {
+        replay_view_step(&view);
+        hash[t] = physics_state_hash(&view.game);
+    }
+    TEST_ASSERT_EQUAL_UINT64(SEEK_TICKS, view.tick);
+
+    rng_t r;
+    rng_seed(&r, 5u, 0u);
+    for (int i = 0; i < 200; ++i) {
+        uint64_t t = rng_next(&r) % (SEEK_TICKS + 1);
+        TEST_ASSERT_TRUE(replay_view_seek(&view, t));
+        TEST_ASSERT_EQUAL_UINT64(t, view.tick);
+        TEST_ASSERT_EQUAL_UINT64(hash[t], physics_state_hash(&view.game));
+        TEST_ASSERT_TRUE(view.seek_ticks <= REPLAY_KEYFRAME_TICKS);
+    }
+    replay_view_close(&view);
+}
+
+/* Liest n Bytes little endian */
+static uint64_t le(const uint8_t *p, int n)
+{
+    uint64_t v = 0;
+    for (int i = 0; i < n; ++i)
+        v |= (uint64_t)p[i] << (8 * i);
+    return v;
+}
+
+/* Keyframes liegen Feld für Feld little endian in der Datei, nicht als
+   Speicherabbild des Snapshots */
+void test_keyframe_layout_is_portable(void)
+{
+    record_bot_game(REPLAY_KEYFRAME_TICKS);
+
+    replay_view_t view;
+    TEST_ASSERT_TRUE(replay_view_open(&view, REPLAY_FILE));
+    TEST_ASSERT_EQUAL_UINT32(1, view.keyframes);
+    TEST_ASSERT_EQUAL_UINT64(REPLAY_KEYFRAME_TICKS, le(view.index, 8));
+    const uint8_t *kf = view.map + le(view.index + 8, 8);
+
+    TEST_ASSERT_EQUAL_UINT8(1, kf[0]);                          /* Markierung */
+    TEST_ASSERT_EQUAL_UINT64(REPLAY_KEYFRAME_TICKS, le(kf + 1, 8));
+    TEST_ASSERT_EQUAL_UINT8(physics_get_solver(), kf[9]);
+    TEST_ASSERT_EQUAL_UINT8(physics_get_numeric(), kf[10]);
+    TEST_ASSERT_EQUAL_UINT16(physics_tick_rate(), le(kf + 11, 2));
+    TEST_ASSERT_EQUAL_UINT32(80, le(kf + 13, 4));
+    TEST_ASSERT_EQUAL_UINT32(24, le(kf + 17, 4));
+
+    while (view.tick < REPLAY_KEYFRAME_TICKS)
+        replay_view_step(&view);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)view.game.score, le(kf + 1 + 76, 4));
+    TEST_ASSERT_EQUAL_UINT64(view.game.rng.state, le(kf + 1 + 84, 8));
+    replay_view_close(&view);
+}
+
+/* Vor- und Zurückspringen zu Punkten trifft dieselben Ticks */
+void test_jump_to_scored_events(void)
+{
+    uint64_t scored[256];
+    int      n = 0;
+    record_bot_game(SEEK_TICKS);
+
+    replay_view_t view;
+    TEST_ASSERT_TRUE(replay_view_open(&view, REPLAY_FILE));
+    while (!view.done)
+        if ((replay_view_step(&view) & PHYS_EVENT_SCORED) && n < 256)
+            scored[n++] = view.tick;
+    TEST_ASSERT_TRUE(n >= 2);
+
+    TEST_ASSERT_TRUE(replay_view_seek(&view, 0));
+    for (int i = 0; i < n; ++i) {
+        TEST_ASSERT_TRUE(replay_view_next_event(&view, PHYS_EVENT_SCORED));
+        TEST_ASSERT_EQUAL_UINT64(scored[i], view.tick);
+    }
+    TEST_ASSERT_FALSE(replay_view_next_event(&view, PHYS_EVENT_SCORED));
+
+    for (int i = n - 1; i >= 0; --i) {
+        TEST_ASSERT_TRUE(replay_view_prev_event(&view, PHYS_EVENT_SCORED));
+        TEST_ASSERT_EQUAL_UINT64(scored[i], view.tick);
+    }
+    TEST_ASSERT_FALSE(replay_view_prev_event(&view, PHYS_EVENT_SCORED));
+    TEST_ASSERT_EQUAL_UINT64(scored[0], view.tick);
+    replay_view_close(&view);
+}
+
+/* Ereignisse genau auf einem Keyframe-Tick werden rückwärts gefunden:
+   der Keyframe-Abstand wird so gewählt, dass der zweite Punkt auf
+   einem Keyframe liegt (der Verlauf hängt nicht vom Abstand ab) */
+void test_prev_event_on_keyframe_tick(void)
+{
+    uint64_t scored[256];
+    int      n = 0;
+    record_bot_game(SEEK_TICKS);
+
+    replay_view_t view;
+    TEST_ASSERT_TRUE(replay_view_open(&view, REPLAY_FILE));
+    while (!view.done)
+        if ((replay_view_step(&view) & PHYS_EVENT_SCORED) && n < 256)
+            scored[n++] = view.tick;
+    replay_view_close(&view);
+    TEST_ASSERT_TRUE(n >= 2);
+
+    record_bot_game_kf(SEEK_TICKS, scored[1]);
+    TEST_ASSERT_TRUE(replay_view_open(&view, REPLAY_FILE));
+    TEST_ASSERT_TRUE(view.keyframes >= 1);
+    TEST_ASSERT_EQUAL_UINT64(scored[1], le(view.index, 8));
+
+    /* aus dem Abschnitt dahinter und direkt vom Tick danach */
+    TEST_ASSERT_TRUE(replay_view_seek(&view, scored[1] + 5));
+    TEST_ASSERT_TRUE(replay_view_prev_event(&view, PHYS_EVENT_SCORED));
+    TEST_ASSERT_EQUAL_UINT64(scored[1], view.tick);
+    TEST_ASSERT_TRUE(replay_view_seek(&view, scored[1] + 1));
+    TEST_ASSERT_TRUE(replay_view_prev_event(&view, PHYS_EVENT_SCORED));
+    TEST_ASSERT_EQUAL_UINT64(scored[1], view.tick);
+
+    /* alle Punkte rückwärts vom Ende */
+    TEST_ASSERT_TRUE(replay_view_seek(&view, SEEK_TICKS));
+    for (int i = n - 1; i >= 0; --i) {
+        TEST_ASSERT_TRUE(replay_view_prev_event(&view, PHYS_EVENT_SCORED));
+        TEST_ASSERT_EQUAL_UINT64(scored[i], view.tick);
+    }
+    replay_view_close(&view);
+}
+
+/* Ohne früheren Treffer bleibt die Wiedergabe, wo sie war */
+void test_prev_event_without_match_keeps_position(void)
+{
+    record_bot_game(SEEK_TICKS);
+
+    replay_view_t view;
+    TEST_ASSERT_TRUE(replay_view_open(&view, REPLAY_FILE));
+    TEST_ASSERT_TRUE(replay_view_seek(&view, REPLAY_KEYFRAME_TICKS + 123));
+    uint64_t hash = physics_state_hash(&view.game);
+
+    /* Game Over kommt in der Aufzeichnung nicht vor */
+    TEST_ASSERT_FALSE(replay_view_prev_event(&view, PHYS_EVENT_GAME_OVER));
+    TEST_ASSERT_EQUAL_UINT64(REPLAY_KEYFRAME_TICKS + 123, view.tick);
+    TEST_ASSERT_EQUAL_UINT64(hash, physics_state_hash(&view.game));
+
+    /* Weiterspielen geht ab derselben Stelle */
+    replay_view_step(&view);
+    TEST_ASSERT_EQUAL_UINT64(REPLAY_KEYFRAME_TICKS + 124, view.tick);
+    replay_view_close(&view);
+}
+
+/* Viewer-Eingabe: ein Zeichen im ersten Frame, danach nichts */
+static input_action_t key_once_poll(void *user)
+{
+    int *ch = user;
+    input_action_t a = { 0, 0, *ch != 0, *ch, 0 };
+    *ch = 0;
+    return a;
+}
+
+/* Viewer-Schleife: "n" springt zum ersten Punkt, danach läuft sie
+   headless bis zum Ende der Aufzeichnung */
+void test_view_loop_jumps_and_plays_to_end(void)
+{
+    record_bot_game(SEEK_TICKS);
+
+    replay_view_t view;
+    TEST_ASSERT_TRUE(replay_view_open(&view, REPLAY_FILE));
+    TEST_ASSERT_TRUE(replay_view_next_event(&view, PHYS_EVENT_SCORED));
+    uint64_t first = view.tick;
+    TEST_ASSERT_TRUE(replay_view_seek(&view, 0));
+
+    int ch = 'n';
+    loop_config_t cfg = { .headless = true, .max_frames = 1,
+                          .poll = key_once_poll, .user = &ch };
+    loop_result_t res;
+    loop_view(&view, &cfg, &res);
+    TEST_ASSERT_EQUAL_UINT64(first, view.tick);     /* 16 ms: noch kein Tick */
+
+    cfg.max_frames = 0;
+    loop_view(&view, &cfg, &res);
+    TEST_ASSERT_TRUE(view.done);
+    TEST_ASSERT_EQUAL_INT(LOOP_GAME_OVER, res.state);
+    TEST_ASSERT_EQUAL_UINT64(SEEK_TICKS, view.tick);
+    TEST_ASSERT_EQUAL_UINT64(view.hash, physics_state_hash(&view.game));
+    replay_view_close(&view);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_varint_roundtrip);
+    RUN_TEST(test_replay_reproduces_session);
+    RUN_TEST(test_replay_restores_modes);
+    RUN_TEST(test_tampered_log_is_detected);
+    RUN_TEST(test_idle_hour_stays_small);
+    RUN_TEST(test_held_input_per_tick_is_one_run);
+    RUN_TEST(test_seek_matches_linear_playback);
+    RUN_TEST(test_keyframe_layout_is_portable);
+    RUN_TEST(test_jump_to_scored_events);
+    RUN_TEST(test_prev_event_on_keyframe_tick);
+    RUN_TEST(test_prev_event_without_match_keeps_position);
+    RUN_TEST(test_view_loop_jumps_and_plays_to_end);
+    return UNITY_END();
+}
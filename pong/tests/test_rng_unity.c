@@ -0,0 +1,83 @@
+/* ------------------------------------------------------------------
+ * test_rng_unity.c - Unity-Tests für den Zufallsgenerator pro Spiel
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#include "unity.h"
+#include "rng.h"
+#include "physics.h"
+
+void setUp(void)    {}
+void tearDown(void) { physics_set_random_provider(NULL); }
+
+/* Referenzwert der PCG32-Implementierung (seed 42, stream 54) */
+void test_known_answer(void)
+{
+    rng_t r;
+    rng_seed(&r, 42u, 54u);
+    TEST_ASSERT_EQUAL_HEX32(0xa15c02b7u, rng_next(&r));
+}
+
+/* rng_advance(n) landet genau dort, wo n Aufrufe von rng_next landen */
+void test_advance_matches_next(void)
+{
+    rng_t a, b;
+    rng_seed(&a, 7u, 3u);
+    b = a;
+    for (int i = 0; i < 1000; ++i)
+        rng_next(&a);
+    rng_advance(&b, 1000u);
+    TEST_ASSERT_EQUAL_UINT32(rng_next(&a), rng_next(&b));
+}
+
+/* Verschiedene Streams mit gleichem Seed liefern verschiedene Folgen */
+void test_streams_differ(void)
+{
+    rng_t a, b;
+    rng_seed(&a, 1u, 0u);
+    rng_seed(&b, 1u, 1u);
+    int same = 0;
+    for (int i = 0; i < 64; ++i)
+        same += rng_next(&a) == rng_next(&b);
+    TEST_ASSERT_TRUE(same < 4);
+}
+
+/* Gleiches (seed, stream) → gleicher Aufschlag und gleiche Folge,
+   ein anderes Spiel verbraucht nur seinen eigenen Zufall */
+void test_seeded_games_are_independent(void)
+{
+    game_state_t a = physics_create_game_seeded(80, 24, 9u, 2u);
+    game_state_t c = physics_create_game_seeded(80, 24, 9u, 5u);
+    game_state_t b = physics_create_game_seeded(80, 24, 9u, 2u);
+    TEST_ASSERT_EQUAL_FLOAT(a.ball.vx, b.ball.vx);
+    for (int i = 0; i < 32; ++i) {
+        rng_next(&c.rng);
+        TEST_ASSERT_EQUAL_UINT32(rng_next(&a.rng), rng_next(&b.rng));
+    }
+}
+
+static unsigned int always_even(void) { return 0u; }
+
+/* Ein gesetzter Provider hat weiterhin Vorrang (Tests, Debugging) */
+void test_provider_override(void)
+{
+    physics_set_random_provider(always_even);
+    for (uint64_t s = 0; s < 8; ++s) {
+        game_state_t g = physics_create_game_seeded(80, 24, 1u, s);
+        TEST_ASSERT_TRUE(g.ball.vx < 0.0f);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_known_answer);
+    RUN_TEST(test_advance_matches_next);
+    RUN_TEST(test_streams_differ);
+    RUN_TEST(test_seeded_games_are_independent);
+    RUN_TEST(test_provider_override);
+
+    return UNITY_END();
+}
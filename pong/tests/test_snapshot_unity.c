@@ -0,0 +1,191 @@
+/* ------------------------------------------------------------------
+ * test_snapshot_unity.c - Unity-Tests für Snapshots und Rückspulen
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#include "unity.h"
+#include "snapshot.h"
+#include "ai.h"
+
+static snap_ring_t ring;
+
+void setUp(void)    { snap_ring_reset(&ring); }
+void tearDown(void)
+{
+    physics_set_solver(PHYS_SOLVER_ANALYTIC);
+    physics_set_numeric(PHYS_NUMERIC_FLOAT);
+}
+
+/* ------------------------------------------------------------------
+ * step
+ * Ein Tick Bot gegen Bot.
+ *
+ * Parameter:
+ *   g – Spielzustand
+ *
+ * Rückgabe:
+ *   Event-Bitmaske
+ * ------------------------------------------------------------------ */
+static physics_event_t step(game_state_t *g)
+{
+    ai_player_update(g);
+    ai_update(g);
+    return physics_update_ball_events(g);
+}
+
+/* ------------------------------------------------------------------
+ * assert_same_game
+ * Vergleicht alle simulationsrelevanten Felder zweier Spielzustände.
+ * ------------------------------------------------------------------ */
+static void assert_same_game(const game_state_t *a, const game_state_t *b)
+{
+    TEST_ASSERT_EQUAL_FLOAT(a->ball.x,   b->ball.x);
+    TEST_ASSERT_EQUAL_FLOAT(a->ball.y,   b->ball.y);
+    TEST_ASSERT_EQUAL_FLOAT(a->ball.vx,  b->ball.vx);
+    TEST_ASSERT_EQUAL_FLOAT(a->ball.vy,  b->ball.vy);
+    TEST_ASSERT_EQUAL_FLOAT(a->player.x, b->player.x);
+    TEST_ASSERT_EQUAL_FLOAT(a->player.vx, b->player.vx);
+    TEST_ASSERT_EQUAL_FLOAT(a->bot.x,    b->bot.x);
+    TEST_ASSERT_EQUAL_FLOAT(a->bot.vx,   b->bot.vx);
+    TEST_ASSERT_EQUAL_INT(a->score,       b->score);
+    TEST_ASSERT_EQUAL_INT(a->paddle_hits, b->paddle_hits);
+    TEST_ASSERT_EQUAL_MEMORY(&a->rng, &b->rng, sizeof a->rng);
+}
+
+/* Speichern, weiterspielen, laden, erneut spielen → gleicher Verlauf
+   (inkl. Punkten, also Zufall) */
+void test_restore_resumes_deterministically(void)
+{
+    game_state_t g = physics_create_game_seeded(80, 24, 4u, 1u);
+    for (int t = 0; t < 50; ++t)
+        step(&g);
+
+    physics_snapshot_t snap;
+    physics_save(&g, 50u, &snap);
+
+    game_state_t first = g;
+    for (int t = 0; t < 2000; ++t)
+        if (step(&first) & PHYS_EVENT_GAME_OVER)
+            break;
+
+    uint64_t tick = 0;
+    TEST_ASSERT_TRUE(physics_restore(&g, &tick, &snap));
+    TEST_ASSERT_EQUAL_UINT64(50u, tick);
+    for (int t = 0; t < 2000; ++t)
+        if (step(&g) & PHYS_EVENT_GAME_OVER)
+            break;
+    assert_same_game(&first, &g);
+}
+
+/* Fremde Version wird abgelehnt, Zustand bleibt unverändert */
+void test_restore_rejects_other_version(void)
+{
+    game_state_t g = physics_create_game(80, 24);
+    physics_snapshot_t snap;
+    physics_save(&g, 1u, &snap);
+    snap.version++;
+
+    game_state_t h = g;
+    h.score = 7;
+    TEST_ASSERT_FALSE(physics_restore(&h, NULL, &snap));
+    TEST_ASSERT_EQUAL_INT(7, h.score);
+}
+
+/* Löser und Zahlenformat sind Prozess-Einstellungen: ein Snapshot aus
+   einem anderen Modus wird abgelehnt und ändert sie nicht */
+void test_restore_rejects_other_modes(void)
+{
+    game_state_t g = physics_create_game(80, 24);
+    physics_set_numeric(PHYS_NUMERIC_FIXED);
+    physics_snapshot_t snap;
+    physics_save(&g, 0u, &snap);
+    physics_set_numeric(PHYS_NUMERIC_FLOAT);
+
+    TEST_ASSERT_FALSE(physics_restore(&g, NULL, &snap));
+    TEST_ASSERT_EQUAL_INT(PHYS_NUMERIC_FLOAT, physics_get_numeric());
+
+    physics_set_numeric(PHYS_NUMERIC_FIXED);
+    TEST_ASSERT_TRUE(physics_restore(&g, NULL, &snap));
+    physics_set_numeric(PHYS_NUMERIC_FLOAT);
+}
+
+/* Die Tickrate wird nur bei einem Wechsel neu gesetzt */
+void test_restore_switches_tick_rate(void)
+{
+    game_state_t g = physics_create_game(80, 24);
+    TEST_ASSERT_TRUE(physics_set_tick_rate(60));
+    physics_snapshot_t snap;
+    physics_save(&g, 0u, &snap);
+    TEST_ASSERT_TRUE(physics_set_tick_rate(PHYSICS_HZ_DEFAULT));
+
+    TEST_ASSERT_TRUE(physics_restore(&g, NULL, &snap));
+    TEST_ASSERT_EQUAL_UINT(60, physics_tick_rate());
+
+    snap.tick_hz = PHYSICS_HZ_MAX + 1;
+    TEST_ASSERT_FALSE(physics_restore(&g, NULL, &snap));
+    TEST_ASSERT_EQUAL_UINT(60, physics_tick_rate());
+    physics_set_tick_rate(PHYSICS_HZ_DEFAULT);
+}
+
+/* UI-Zähler reisen im Snapshot mit */
+void test_snapshot_keeps_ui(void)
+{
+    game_state_t g = physics_create_game(80, 24);
+    render_ui_t ui = { 3, 1, 2, false }, back;
+    render_ui_restore(&ui);
+
+    snapshot_t snap;
+    snapshot_take(&snap, &g, 0u);
+    render_ui_t other = { 0, 0, 0, true };
+    render_ui_restore(&other);
+
+    TEST_ASSERT_TRUE(snapshot_apply(&snap, &g, NULL));
+    render_ui_save(&back);
+    TEST_ASSERT_EQUAL_INT(3, back.player_flash);
+    TEST_ASSERT_EQUAL_INT(1, back.bot_flash);
+    TEST_ASSERT_EQUAL_INT(2, back.countdown);
+    TEST_ASSERT_FALSE(back.game_over);
+}
+
+/* Ring: 10 Ticks zurückspulen und neu simulieren ergibt denselben Zustand,
+   danach geht es im Ring nahtlos weiter */
+void test_ring_rewind_and_resimulate(void)
+{
+    game_state_t g = physics_create_game_seeded(80, 24, 9u, 0u);
+    game_state_t at[201];
+    for (uint64_t t = 0; t <= 200; ++t) {
+        snap_ring_push(&ring, &g, t);
+        at[t] = g;
+        step(&g);
+    }
+
+    uint64_t tick;
+    TEST_ASSERT_TRUE(snap_ring_rewind(&ring, 190u, &g, &tick));
+    TEST_ASSERT_EQUAL_UINT64(190u, tick);
+    assert_same_game(&at[190], &g);
+
+    for (uint64_t t = 190; t < 200; ++t) {
+        step(&g);
+        snap_ring_push(&ring, &g, t + 1);
+    }
+    assert_same_game(&at[200], &g);
+    TEST_ASSERT_EQUAL_UINT64(200u, snap_ring_find(&ring, 1000u)->phys.tick);
+
+    /* zu alt für den Ring */
+    TEST_ASSERT_FALSE(snap_ring_rewind(&ring, 200u - SNAP_RING_LEN, &g, NULL));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_restore_resumes_deterministically);
+    RUN_TEST(test_restore_rejects_other_version);
+    RUN_TEST(test_restore_rejects_other_modes);
+    RUN_TEST(test_restore_switches_tick_rate);
+    RUN_TEST(test_snapshot_keeps_ui);
+    RUN_TEST(test_ring_rewind_and_resimulate);
+
+    return UNITY_END();
+}
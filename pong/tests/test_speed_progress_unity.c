@@ -42,7 +42,8 @@ void test_min_speed_scaling(void)
 {
     game_state_t g = physics_create_game(80, 24);
 
-    float base_min = BALL_MIN_SPEED;
+    const physics_rate_t *r = physics_rate();
+    float base_min = r->ball_min_speed;          /* Zellen je Tick */
     float expect;
 
     /* Fünf Paddle-Hits erzwingen                                   */
@@ -52,8 +53,8 @@ void test_min_speed_scaling(void)
 
         /* erwartetes dynamisches Minimum in diesem Frame            */
         expect = base_min * (1.0f + n * BALL_MIN_SPEED_INC);
-        if (expect > BALL_MAX_SPEED)
-            expect = BALL_MAX_SPEED;
+        if (expect > r->ball_max_speed)
+            expect = r->ball_max_speed;
 
         float speed = sqrtf(g.ball.vx * g.ball.vx +
                             g.ball.vy * g.ball.vy);
@@ -70,7 +71,7 @@ void test_bounce_growth(void)
 
     /* Ball so langsam wie möglich starten                          */
     g.ball.vx = 0.0f;
-    g.ball.vy = BALL_MIN_SPEED;
+    g.ball.vy = physics_rate()->ball_min_speed;
 
     float last_speed = sqrtf(g.ball.vx * g.ball.vx +
                              g.ball.vy * g.ball.vy);
@@ -0,0 +1,222 @@
+/* ------------------------------------------------------------------
+ * test_tickrate_unity.c - Unity-Tests für die wählbare Tickrate
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#include <math.h>
+#include <string.h>
+#include "unity.h"
+#include "ai.h"
+#include "loop.h"
+#include "render.h"
+#include "physics.h"
+#include "fixed.h"
+#include "config.h"
+
+/* Verhaltensgleichheit: dieselbe Szene in Sekunden gemessen muss bei
+   jeder Tickrate (nahezu) gleich ablaufen wie bei 10 Hz */
+static const unsigned rates[] = { 10, 60, 250, PHYSICS_HZ_MAX };
+#define N_RATES (sizeof rates / sizeof rates[0])
+
+void setUp(void)
+{
+    TEST_ASSERT_TRUE(render_select("null"));
+    TEST_ASSERT_TRUE(render_init());
+}
+
+void tearDown(void)
+{
+    render_shutdown();
+    physics_set_tick_rate(PHYSICS_HZ_DEFAULT);
+}
+
+/* Prüft, dass 10 Hz genau die früheren Konstanten je Physik-Frame
+   ergibt (Replays, Prüfsummen und Balancing bleiben gültig) */
+void test_default_rate_matches_frame_constants(void)
+{
+    TEST_ASSERT_TRUE(physics_set_tick_rate(PHYSICS_HZ_DEFAULT));
+    const physics_rate_t *r = physics_rate();
+
+    TEST_ASSERT_EQUAL_UINT(10, r->hz);
+    TEST_ASSERT_EQUAL_FLOAT(0.70f, r->player_accel);
+    TEST_ASSERT_EQUAL_FLOAT(12.0f, r->player_max_speed);
+    TEST_ASSERT_EQUAL_FLOAT(0.20f, r->bot_accel);
+    TEST_ASSERT_EQUAL_FLOAT(0.04f, r->bot_accel_per_point);
+    TEST_ASSERT_EQUAL_FLOAT(10.0f, r->bot_max_speed);
+    TEST_ASSERT_EQUAL_FLOAT(0.80f, r->damping);
+    TEST_ASSERT_EQUAL_FLOAT(0.05f, r->stop_eps);
+    TEST_ASSERT_EQUAL_FLOAT(0.5f,  r->ball_initial_speed);
+    TEST_ASSERT_EQUAL_FLOAT(5.0f,  r->ball_max_speed);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f,  r->ball_min_speed);
+}
+
+/* Prüft, dass die statische Vorbelegung (ohne physics_set_tick_rate)
+   bitgleich zur Rechnung für PHYSICS_HZ_DEFAULT ist; läuft als erster
+   Test, solange die Rate noch nicht gesetzt wurde */
+void test_static_default_equals_set_rate(void)
+{
+    physics_rate_t before = *physics_rate();
+    TEST_ASSERT_TRUE(physics_set_tick_rate(PHYSICS_HZ_DEFAULT));
+    TEST_ASSERT_EQUAL_MEMORY(physics_rate(), &before, sizeof before);
+}
+
+/* Prüft die Q16.16-Kopien: höchstens ein LSB neben der float-Rechnung
+   (die Dämpfung kommt aus der Ganzzahl-Wurzel, nicht aus pow) */
+void test_fixed_copies_follow_rate(void)
+{
+    for (unsigned i = 0; i < N_RATES; i++) {
+        TEST_ASSERT_TRUE(physics_set_tick_rate(rates[i]));
+        const physics_rate_t *r = physics_rate();
+        TEST_ASSERT_INT_WITHIN(1, fix_from_float(r->damping), r->fx_damping);
+        TEST_ASSERT_EQUAL_INT(fix_from_float(r->stop_eps), r->fx_stop_eps);
+        TEST_ASSERT_EQUAL_INT(fix_from_float(r->ball_max_speed), r->fx_ball_max_speed);
+        TEST_ASSERT_EQUAL_INT(fix_from_float(r->ball_min_speed), r->fx_ball_min_speed);
+    }
+}
+
+/* Prüft die Grenzen der Tickrate; eine ungültige lässt die alte stehen */
+void test_rate_limits(void)
+{
+    TEST_ASSERT_TRUE(physics_set_tick_rate(PHYSICS_HZ_MAX));
+    TEST_ASSERT_FALSE(physics_set_tick_rate(PHYSICS_HZ_MIN - 1));
+    TEST_ASSERT_FALSE(physics_set_tick_rate(PHYSICS_HZ_MAX + 1));
+    TEST_ASSERT_EQUAL_UINT(PHYSICS_HZ_MAX, physics_tick_rate());
+    TEST_ASSERT_EQUAL_FLOAT(BALL_MAX_SPEED / PHYSICS_HZ_MAX, physics_rate()->ball_max_speed);
+}
+
+/* Prüft, dass der Ball in einer Sekunde samt Wandkontakt überall
+   gleich weit fliegt */
+void test_ball_flight_equivalent(void)
+{
+    for (size_t k = 0; k < N_RATES; ++k) {
+        unsigned hz = rates[k];
+        TEST_ASSERT_TRUE(physics_set_tick_rate(hz));
+
+        game_state_t g = physics_create_game(80, 24);
+        g.ball.x  = 70.0f;
+        g.ball.y  = 12.0f;
+        g.ball.vx = 40.0f / hz;      /* 40 Zellen / s → Wand bei x = 79 */
+        g.ball.vy = -3.0f / hz;
+        for (unsigned i = 0; i < hz; ++i)
+            physics_update_ball_events(&g);
+
+        TEST_ASSERT_FLOAT_WITHIN(0.01f, 48.0f, g.ball.x);
+        TEST_ASSERT_FLOAT_WITHIN(0.01f, 9.0f,  g.ball.y);
+    }
+}
+
+/* Prüft, dass das Spieler-Paddle bei gehaltener Taste gleich schnell
+   wird und danach an derselben Stelle ausrollt */
+void test_paddle_equivalent(void)
+{
+    float ref_v = 0.0f, ref_rest = 0.0f;
+
+    for (size_t k = 0; k < N_RATES; ++k) {
+        unsigned hz = rates[k];
+        TEST_ASSERT_TRUE(physics_set_tick_rate(hz));
+
+        game_state_t g = physics_create_game(80, 24);
+        g.player.x = 5.0f;
+        for (unsigned i = 0; i < hz / 2; ++i)        /* 0.5 s rechts */
+            physics_player_update(&g, 1);
+        float v = g.player.vx * hz;                  /* Zellen / s   */
+        for (unsigned i = 0; i < 2 * hz; ++i)        /* 2 s ausrollen */
+            physics_player_update(&g, 0);
+
+        TEST_ASSERT_EQUAL_FLOAT(0.0f, g.player.vx);
+        if (k == 0) {
+            ref_v    = v;
+            ref_rest = g.player.x;
+            continue;
+        }
+        TEST_ASSERT_FLOAT_WITHIN(0.01f * ref_v, ref_v, v);
+        TEST_ASSERT_FLOAT_WITHIN(0.25f, ref_rest, g.player.x);
+    }
+}
+
+/* Prüft, dass der Bot eine ferne Ballposition in derselben Zeit erreicht */
+void test_bot_chase_equivalent(void)
+{
+    float ref_s = 0.0f;
+
+    for (size_t k = 0; k < N_RATES; ++k) {
+        unsigned hz = rates[k];
+        TEST_ASSERT_TRUE(physics_set_tick_rate(hz));
+
+        game_state_t g = physics_create_game(80, 24);
+        g.bot.x   = 2.0f;
+        g.ball.x  = 60.0f;
+        g.ball.vx = g.ball.vy = 0.0f;
+        unsigned t = 0;
+        while (g.bot.x + g.bot.width / 2.0f < 59.5f && t < 10 * hz) {
+            ai_update(&g);
+            t++;
+        }
+        float s = (float)t / hz;
+        if (k == 0)
+            ref_s = s;
+        TEST_ASSERT_FLOAT_WITHIN(0.1f, ref_s, s);
+    }
+}
+
+/* Eingabe für die Schleife: ein einzelner Tastendruck in Frame 0 */
+typedef struct
+{
+    int frame;
+} tap_t;
+
+static input_action_t tap_poll(void *user)
+{
+    tap_t *t = user;
+    int dx = t->frame == 0 ? 1 : 0;
+    input_action_t a = { dx, 0, dx != 0, 0, 0 };
+    t->frame++;
+    return a;
+}
+
+/* Prüft, dass ein Tastendruck das Paddle in der Schleife bei jeder
+   Tickrate gleich weit schiebt (INPUT_HOLD_MS statt eines Ticks) */
+void test_key_press_equivalent(void)
+{
+    float ref_x = 0.0f;
+
+    for (size_t k = 0; k < N_RATES; ++k) {
+        TEST_ASSERT_TRUE(physics_set_tick_rate(rates[k]));
+
+        game_state_t g = physics_create_game(80, 24);
+        g.ball.vx = g.ball.vy = 0.0f;        /* Ball steht, kein Punkt */
+        tap_t tap = { 0 };
+        loop_config_t cfg = { 0 };
+        cfg.headless   = true;
+        cfg.max_frames = 3000 / RENDER_DT_MS;
+        cfg.poll       = tap_poll;
+        cfg.user       = &tap;
+        loop_result_t res;
+        loop_run(&g, &cfg, &res);
+
+        TEST_ASSERT_EQUAL_FLOAT(0.0f, g.player.vx);
+        if (k == 0) {
+            ref_x = g.player.x;
+            TEST_ASSERT_TRUE(ref_x > 36.0f);  /* hat sich überhaupt bewegt */
+            continue;
+        }
+        TEST_ASSERT_FLOAT_WITHIN(0.25f, ref_x, g.player.x);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_static_default_equals_set_rate);
+    RUN_TEST(test_default_rate_matches_frame_constants);
+    RUN_TEST(test_fixed_copies_follow_rate);
+    RUN_TEST(test_rate_limits);
+    RUN_TEST(test_ball_flight_equivalent);
+    RUN_TEST(test_paddle_equivalent);
+    RUN_TEST(test_bot_chase_equivalent);
+    RUN_TEST(test_key_press_equivalent);
+
+    return UNITY_END();
+}
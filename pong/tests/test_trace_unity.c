@@ -0,0 +1,161 @@
+/* ------------------------------------------------------------------
+ * test_trace_unity.c - Unity-Tests für den Ereignis-Tracer
+ * Copyright 2025 Hochschule Hannover
+ * Autor: Mats-Luca Dagott
+ * ------------------------------------------------------------------ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+#include "trace.h"
+#include "loop.h"
+#include "render.h"
+#include "physics.h"
+#include "config.h"
+
+#define TRACE_FILE "build/test_trace.json"
+
+static char json[1 << 20];
+
+void setUp(void)
+{
+    TEST_ASSERT_TRUE(render_select("null"));
+    TEST_ASSERT_TRUE(render_init());
+}
+
+void tearDown(void)
+{
+    trace_stop();
+    render_shutdown();
+    remove(TRACE_FILE);
+}
+
+/* Schreibt den Trace und lädt ihn nach json */
+static void write_and_load(void)
+{
+    TEST_ASSERT_TRUE(trace_write(TRACE_FILE));
+    FILE *f = fopen(TRACE_FILE, "r");
+    TEST_ASSERT_NOT_NULL(f);
+    size_t n = fread(json, 1, sizeof json - 1, f);
+    fclose(f);
+    json[n] = '\0';
+    TEST_ASSERT_EQUAL_STRING_LEN("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", json, 39);
+}
+
+/* Vorkommen eines Teilstrings im geladenen Trace */
+static unsigned count(const char *needle)
+{
+    unsigned n = 0;
+    for (const char *p = json; (p = strstr(p, needle)) != NULL; p++)
+        n++;
+    return n;
+}
+
+/* Ball fliegt im ersten Tick oben heraus (wie in test_loop_unity.c) */
+static game_state_t make_scoring_game(void)
+{
+    game_state_t g = physics_create_game(80, 24);
+    g.bot.x   = 0.0f;
+    g.ball.x  = 60.0f;
+    g.ball.y  = 0.5f;
+    g.ball.vx = 0.0f;
+    g.ball.vy = -1.0f;
+    return g;
+}
+
+/* Ein Frame-, Eingabe- und Render-Abschnitt je Frame, ein
+   Physik-Abschnitt je Tick, der Countdown als eigener Zeitraum */
+void test_loop_timeline(void)
+{
+    game_state_t  g   = make_scoring_game();
+    loop_config_t cfg = { .headless = true, .max_frames = 200 };
+    loop_result_t res;
+
+    TEST_ASSERT_TRUE(trace_start(0));
+    TEST_ASSERT_TRUE(trace_thread_init("loop"));
+    loop_run(&g, &cfg, &res);
+    write_and_load();
+
+    TEST_ASSERT_EQUAL_INT(1, g.score);
+    TEST_ASSERT_EQUAL_UINT(res.frames, count("\"name\":\"frame\",\"ph\":\"B\""));
+    TEST_ASSERT_EQUAL_UINT(res.frames, count("\"name\":\"input\",\"ph\":\"E\""));
+    TEST_ASSERT_EQUAL_UINT(res.frames, count("\"name\":\"render\",\"ph\":\"B\""));
+    TEST_ASSERT_EQUAL_UINT(res.ticks,  count("\"name\":\"physics\",\"ph\":\"B\""));
+    TEST_ASSERT_EQUAL_UINT(res.ticks,  count("\"name\":\"physics\",\"ph\":\"E\""));
+    TEST_ASSERT_EQUAL_UINT(1, count("\"name\":\"countdown\",\"ph\":\"b\""));
+    TEST_ASSERT_EQUAL_UINT(1, count("\"name\":\"countdown\",\"ph\":\"e\""));
+    TEST_ASSERT_EQUAL_UINT(0, count("\"name\":\"sleep\""));      /* headless */
+    TEST_ASSERT_EQUAL_UINT(1, count("\"args\":{\"name\":\"loop\"}"));
+}
+
+/* Voller Ring: die neuesten Ereignisse bleiben, Enden ohne Beginn
+   fallen weg */
+void test_ring_overflow_keeps_newest(void)
+{
+    TEST_ASSERT_TRUE(trace_start(7));           /* → 8 Plätze */
+    for (int i = 0; i < 10; ++i) {
+        trace_begin("outer");
+        trace_begin("inner");
+        trace_end("inner");
+        trace_end("outer");
+    }
+    TEST_ASSERT_EQUAL_UINT64(32, trace_dropped());
+    write_and_load();
+
+    TEST_ASSERT_EQUAL_UINT(2, count("\"name\":\"outer\",\"ph\":\"B\""));
+    TEST_ASSERT_EQUAL_UINT(2, count("\"name\":\"outer\",\"ph\":\"E\""));
+    TEST_ASSERT_EQUAL_UINT(2, count("\"name\":\"inner\",\"ph\":\"E\""));
+}
+
+static void *worker(void *arg)
+{
+    (void)arg;
+    trace_thread_init("worker");
+    for (int i = 0; i < 100; ++i) {
+        trace_begin("work");
+        trace_end("work");
+    }
+    return NULL;
+}
+
+/* Jeder Thread schreibt in seinen eigenen Ring und bekommt eine Spur */
+void test_threads_get_own_tracks(void)
+{
+    pthread_t t[2];
+
+    TEST_ASSERT_TRUE(trace_start(0));
+    trace_begin("main");
+    for (int i = 0; i < 2; ++i)
+        TEST_ASSERT_EQUAL_INT(0, pthread_create(&t[i], NULL, worker, NULL));
+    for (int i = 0; i < 2; ++i)
+        pthread_join(t[i], NULL);
+    trace_end("main");
+    write_and_load();
+
+    TEST_ASSERT_EQUAL_UINT(200, count("\"name\":\"work\",\"ph\":\"B\""));
+    TEST_ASSERT_EQUAL_UINT(2, count("\"args\":{\"name\":\"worker\"}"));
+    TEST_ASSERT_EQUAL_UINT(1, count("\"args\":{\"name\":\"thread 1\"}"));
+    TEST_ASSERT_EQUAL_UINT(201, count("\"tid\":2"));      /* Metadaten + 100 Paare */
+    TEST_ASSERT_EQUAL_UINT64(0, trace_dropped());
+}
+
+/* Ohne trace_start wird nichts aufgezeichnet */
+void test_disabled_is_noop(void)
+{
+    trace_begin("x");
+    trace_end("x");
+    TEST_ASSERT_FALSE(trace_enabled());
+    TEST_ASSERT_FALSE(trace_write(TRACE_FILE));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_loop_timeline);
+    RUN_TEST(test_ring_overflow_keeps_newest);
+    RUN_TEST(test_threads_get_own_tracks);
+    RUN_TEST(test_disabled_is_noop);
+    return UNITY_END();
+}